@@ -301,7 +301,7 @@ bs_upload(char *buf, int len)
             goto out_invalid_data;
         }
 #ifndef CONFIG_BOOT_ERASE_PROGRESSIVELY
-        rc = flash_area_erase(fap, 0, fap->fa_size);
+        rc = boot_erase_region(fap, 0, fap->fa_size);
         if (rc) {
             goto out_invalid_data;
         }
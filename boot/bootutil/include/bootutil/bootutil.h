@@ -100,7 +100,9 @@ int boot_swap_type_multi(int image_index);
 int boot_swap_type(void);
 
 int boot_set_pending(int permanent);
+int boot_set_pending_slot(int slot, int permanent);
 int boot_set_confirmed(void);
+int boot_set_confirmed_slot(int slot);
 
 #define SPLIT_GO_OK                 (0)
 #define SPLIT_GO_NON_MATCHING       (-1)
@@ -46,6 +46,11 @@ uint32_t bootutil_get_caps(void);
 #define BOOTUTIL_CAP_SWAP_USING_MOVE        (1<<11)
 #define BOOTUTIL_CAP_DOWNGRADE_PREVENTION   (1<<12)
 #define BOOTUTIL_CAP_ENC_X25519             (1<<13)
+#define BOOTUTIL_CAP_DIRECT_XIP             (1<<14)
+#define BOOTUTIL_CAP_DELTA_UPGRADE          (1<<15)
+#define BOOTUTIL_CAP_COMPRESSED_IMAGES      (1<<16)
+#define BOOTUTIL_CAP_IMAGE_MANIFEST         (1<<17)
+#define BOOTUTIL_CAP_SWAP_USING_RAM         (1<<18)
 
 /*
  * Query the number of images this bootloader is configured for.  This
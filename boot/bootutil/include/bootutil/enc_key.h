@@ -46,6 +46,15 @@ extern "C" {
 #define BOOT_ENC_KEY_SIZE       16
 #define BOOT_ENC_KEY_SIZE_BITS  (BOOT_ENC_KEY_SIZE * 8)
 
+#define BOOT_ENC_BLOCK_SIZE     16
+
+/* Number of AES-CTR counter blocks encrypted at once. */
+#ifndef MCUBOOT_ENC_KS_BLOCKS
+#define BOOT_ENC_KS_BLOCKS      8
+#else
+#define BOOT_ENC_KS_BLOCKS      MCUBOOT_ENC_KS_BLOCKS
+#endif
+
 #define TLV_ENC_RSA_SZ    256
 #define TLV_ENC_KW_SZ     24
 #define TLV_ENC_EC256_SZ  (65 + 32 + 16)
@@ -64,6 +73,16 @@ extern "C" {
 #define BOOT_ENC_TLV_ALIGN_SIZE \
     ((((BOOT_ENC_TLV_SIZE - 1) / BOOT_MAX_ALIGN) + 1) * BOOT_MAX_ALIGN)
 
+/*
+ * A sealed key is the AES-KW wrapping of an image key followed by the
+ * truncated SHA-256 of the encrypted key TLV it was decrypted from.
+ */
+#define BOOT_ENC_SEAL_DIGEST_SIZE 16
+#define BOOT_ENC_SEALED_SIZE \
+    (8 + BOOT_ENC_KEY_SIZE + BOOT_ENC_SEAL_DIGEST_SIZE)
+#define BOOT_ENC_SEALED_ALIGN_SIZE \
+    ((((BOOT_ENC_SEALED_SIZE - 1) / BOOT_MAX_ALIGN) + 1) * BOOT_MAX_ALIGN)
+
 struct enc_key_data {
     uint8_t valid;
 #if defined(MCUBOOT_USE_MBED_TLS)
@@ -89,6 +108,39 @@ void boot_encrypt(struct enc_key_data *enc_state, int image_index,
         uint32_t blk_off, uint8_t *buf);
 void boot_enc_zeroize(struct enc_key_data *enc_state);
 
+#if MCUBOOT_SWAP_SEAL_ENCKEY
+/**
+ * Provided by the platform: writes the device-unique AES-128 key used to
+ * seal the image keys saved in the swap status.  It must not be readable
+ * by the images.
+ *
+ * @param kek       Output, BOOT_ENC_KEY_SIZE bytes
+ *
+ * @return 0 on success
+ */
+int boot_enc_get_seal_key(uint8_t *kek);
+
+int boot_enc_seal(const uint8_t *enckey, const uint8_t *digest,
+        uint8_t *sealed);
+int boot_enc_unseal(const uint8_t *sealed, uint8_t *enckey, uint8_t *digest);
+#endif
+
+#ifdef MCUBOOT_ENC_HW_KEYSTREAM
+/**
+ * Provided by the platform to use an AES engine: writes the AES-128
+ * encryption of nblk consecutive counter blocks, starting at nonce, to ks,
+ * and leaves nonce incremented past them.  The counter is the whole
+ * 16-byte nonce, big-endian.  nblk is at most BOOT_ENC_KS_BLOCKS.
+ *
+ * @param enc       Key, as set up by boot_enc_set_key()
+ * @param nonce     First counter block, updated on return
+ * @param ks        Output, nblk * BOOT_ENC_BLOCK_SIZE bytes
+ * @param nblk      Number of counter blocks
+ */
+void boot_enc_hw_keystream(struct enc_key_data *enc, uint8_t *nonce,
+        uint8_t *ks, uint32_t nblk);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -58,6 +58,26 @@ struct flash_area;
  */
 #define IMAGE_F_RAM_LOAD                 0x00000020
 
+/*
+ * Indicates that the payload is not an image but a patch that rebuilds the
+ * image from the one currently in the primary slot, identified by the
+ * IMAGE_TLV_DELTA_BASE TLV.
+ */
+#define IMAGE_F_DELTA                    0x00000040
+
+/*
+ * Indicates that the payload is an LZ4 block which decompresses to a full
+ * image, described by the IMAGE_TLV_DECOMP_SIZE and IMAGE_TLV_DECOMP_SHA256
+ * TLVs.
+ */
+#define IMAGE_F_COMPRESSED               0x00000080
+
+/*
+ * Indicates that the image is linked to run in place from a fixed address,
+ * the offset of its slot in the ih_load_addr field of the header.
+ */
+#define IMAGE_F_ROM_FIXED                0x00000100
+
 /*
  * ECSDA224 is with NIST P-224
  * ECSDA256 is with NIST P-256
@@ -88,6 +108,10 @@ struct flash_area;
 #define IMAGE_TLV_DEPENDENCY        0x40   /* Image depends on other image */
 #define IMAGE_TLV_SEC_CNT           0x50   /* security counter */
 #define IMAGE_TLV_BOOT_RECORD       0x60   /* measured boot record */
+#define IMAGE_TLV_DELTA_BASE        0x70   /* SHA256 of the patched image */
+#define IMAGE_TLV_DECOMP_SIZE       0x71   /* Size of the decompressed image */
+#define IMAGE_TLV_DECOMP_SHA256     0x72   /* SHA256 of the decompressed image */
+#define IMAGE_TLV_MANIFEST          0x73   /* SHA256 of a member of the set */
 #define IMAGE_TLV_ANY               0xffff /* Used to iterate over all TLV */
 
 struct image_version {
@@ -107,6 +131,13 @@ struct image_dependency {
                                              */
 };
 
+struct image_manifest_entry {
+    uint8_t image_id;                       /* Image index (from 0) */
+    uint8_t _pad1;
+    uint16_t _pad2;
+    uint8_t image_hash[32];                 /* SHA256 TLV of the image */
+};
+
 /** Image header.  All fields are in little endian byte order. */
 struct image_header {
     uint32_t ih_magic;
@@ -33,6 +33,11 @@ extern "C" {
 struct bootutil_key {
     const uint8_t *key;
     const unsigned int *len;
+    const uint8_t *hash;    /* SHA256 of the key, NULL to compute it */
+#if defined(MCUBOOT_EC256_FIXED_BASE) || \
+    defined(MCUBOOT_ED25519_FIXED_BASE) || defined(MCUBOOT_RSA_PRECOMP)
+    const uint8_t *table;   /* Precomputed multiples of the key, or NULL */
+#endif
 };
 
 extern const struct bootutil_key bootutil_keys[];
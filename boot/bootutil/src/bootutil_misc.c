@@ -107,22 +107,181 @@ static const struct boot_swap_table boot_swap_tables[] = {
 #define BOOT_SWAP_TABLES_COUNT \
     (sizeof boot_swap_tables / sizeof boot_swap_tables[0])
 
+#ifdef MCUBOOT_ENC_IMAGES
+#if MCUBOOT_SWAP_SAVE_ENCTLV
+#define BOOT_ENC_KEY_ALIGN_SIZE     BOOT_ENC_TLV_ALIGN_SIZE
+#elif MCUBOOT_SWAP_SEAL_ENCKEY
+#define BOOT_ENC_KEY_ALIGN_SIZE     BOOT_ENC_SEALED_ALIGN_SIZE
+#else
+#define BOOT_ENC_KEY_ALIGN_SIZE     BOOT_ENC_KEY_SIZE
+#endif
+#define BOOT_TRAILER_ENC_SZ         (BOOT_ENC_KEY_ALIGN_SIZE * BOOT_NUM_SLOTS)
+#else
+#define BOOT_TRAILER_ENC_SZ         0
+#endif
+
+#ifdef MCUBOOT_VALIDATED_MARKER
+#define BOOT_TRAILER_VALIDATED_SZ \
+    (BOOT_VALIDATED_ALIGN_SIZE + BOOT_VALIDATED_BOOTS_SZ)
+#else
+#define BOOT_TRAILER_VALIDATED_SZ   0
+#endif
+
+/* swap_info, copy_done and image_ok, each in its own write block, and the
+ * magic, which ends the trailer.
+ */
+#define BOOT_TRAILER_STATE_SZ       (BOOT_MAX_ALIGN * 3 + BOOT_MAGIC_SZ)
+
+/* Everything in a trailer that follows the swap status. */
+#define BOOT_TRAILER_META_SZ                                \
+    (BOOT_TRAILER_ENC_SZ + BOOT_TRAILER_VALIDATED_SZ +      \
+     BOOT_MAX_ALIGN /* swap_size */ + BOOT_TRAILER_STATE_SZ)
+
+/*
+ * Trailers read while the bootloader runs, keyed by flash area.  Everything
+ * that follows the swap status, up to the magic, is read at once and kept
+ * along with the swap state decoded from it, so that the swap type, swap size
+ * and encryption keys of a slot cost a single read for the whole boot.  The
+ * cache is only used between boot_trailer_cache_start() and
+ * boot_trailer_cache_stop(), so that an application writing to the slots
+ * through other means never sees stale data.  An entry is dropped when the
+ * bootloader writes to, or erases, that part of its area.
+ */
+#define BOOT_TRAILER_CACHE_SZ       (BOOT_IMAGE_NUMBER * BOOT_NUM_SLOTS + 1)
+
+struct boot_trailer_cache_entry {
+    uint8_t meta[BOOT_TRAILER_META_SZ];
+    struct boot_swap_state state;
+    uint8_t fa_id;
+    uint8_t valid;
+};
+
+static struct boot_trailer_cache_entry
+    boot_trailer_cache[BOOT_TRAILER_CACHE_SZ];
+static bool boot_trailer_cache_on;
+
+static int boot_read_trailer_meta(const struct flash_area *fap, uint8_t *meta,
+                                  struct boot_swap_state *state);
+
+static void
+boot_trailer_cache_clear(void)
+{
+    size_t i;
+
+    for (i = 0; i < BOOT_TRAILER_CACHE_SZ; i++) {
+        boot_trailer_cache[i].valid = 0;
+    }
+}
+
+void
+boot_trailer_cache_start(void)
+{
+    boot_trailer_cache_clear();
+    boot_trailer_cache_on = true;
+}
+
+void
+boot_trailer_cache_stop(void)
+{
+    boot_trailer_cache_clear();
+    boot_trailer_cache_on = false;
+}
+
+static inline uint32_t
+boot_trailer_meta_off(const struct flash_area *fap)
+{
+    return fap->fa_size - BOOT_TRAILER_META_SZ;
+}
+
+/**
+ * Drops the cached trailer of a flash area if the given region, about to be
+ * written or erased, overlaps it.
+ *
+ * @param fap                   The flash area being written.
+ * @param off                   The offset of the region within the area.
+ * @param len                   The size of the region.
+ */
+void
+boot_trailer_cache_invalidate(const struct flash_area *fap, uint32_t off,
+                              uint32_t len)
+{
+    size_t i;
+
+    if (off + len <= boot_trailer_meta_off(fap)) {
+        return;
+    }
+
+    for (i = 0; i < BOOT_TRAILER_CACHE_SZ; i++) {
+        if (boot_trailer_cache[i].fa_id == fap->fa_id) {
+            boot_trailer_cache[i].valid = 0;
+        }
+    }
+}
+
+/*
+ * Returns the cached trailer of a flash area, reading it on first use, or
+ * NULL if the cache is not in use or the trailer cannot be read.
+ */
+static struct boot_trailer_cache_entry *
+boot_trailer_cache_get(const struct flash_area *fap)
+{
+    struct boot_trailer_cache_entry *entry;
+    size_t i;
+
+    if (!boot_trailer_cache_on) {
+        return NULL;
+    }
+
+    entry = NULL;
+    for (i = 0; i < BOOT_TRAILER_CACHE_SZ; i++) {
+        if (!boot_trailer_cache[i].valid) {
+            if (entry == NULL) {
+                entry = &boot_trailer_cache[i];
+            }
+        } else if (boot_trailer_cache[i].fa_id == fap->fa_id) {
+            return &boot_trailer_cache[i];
+        }
+    }
+
+    if (entry == NULL ||
+        boot_read_trailer_meta(fap, entry->meta, &entry->state) != 0) {
+        return NULL;
+    }
+
+    entry->fa_id = fap->fa_id;
+    entry->valid = 1;
+
+    return entry;
+}
+
+/*
+ * Reads a field that follows the swap status of a trailer, from the cache
+ * when it is in use.
+ */
 static int
-boot_magic_decode(const uint32_t *magic)
+boot_read_trailer_field(const struct flash_area *fap, uint32_t off,
+                        void *dst, uint32_t len)
 {
-    if (memcmp(magic, boot_img_magic, BOOT_MAGIC_SZ) == 0) {
-        return BOOT_MAGIC_GOOD;
+    struct boot_trailer_cache_entry *entry;
+
+    assert(off >= boot_trailer_meta_off(fap));
+
+    entry = boot_trailer_cache_get(fap);
+    if (entry != NULL) {
+        memcpy(dst, &entry->meta[off - boot_trailer_meta_off(fap)], len);
+        return 0;
     }
-    return BOOT_MAGIC_BAD;
+
+    return flash_area_read(fap, off, dst, len);
 }
 
 static int
-boot_flag_decode(uint8_t flag)
+boot_magic_decode(const uint8_t *magic)
 {
-    if (flag != BOOT_FLAG_SET) {
-        return BOOT_FLAG_BAD;
+    if (memcmp(magic, boot_img_magic, BOOT_MAGIC_SZ) == 0) {
+        return BOOT_MAGIC_GOOD;
     }
-    return BOOT_FLAG_SET;
+    return BOOT_MAGIC_BAD;
 }
 
 /**
@@ -155,25 +314,35 @@ uint32_t
 boot_status_sz(uint32_t min_write_sz)
 {
     return /* state for all sectors */
-           BOOT_STATUS_MAX_ENTRIES * BOOT_STATUS_STATE_COUNT * min_write_sz;
+           BOOT_STATUS_MAX_ENTRIES * BOOT_STATUS_STATE_COUNT * min_write_sz
+#ifdef MCUBOOT_SWAP_USING_RAM
+           /* hash of every sector staged in RAM */
+           + BOOT_STATUS_MAX_ENTRIES * BOOT_SWAP_RAM_HASH_ALIGN_SIZE
+#endif
+           ;
 }
 
+#ifdef MCUBOOT_SWAP_SECTOR_STATUS
+/*
+ * The progress of every sector in each state is only recorded in the primary
+ * slot, right before its trailer, so the other trailers keep their size.
+ */
+uint32_t
+boot_unit_status_sz(uint32_t min_write_sz)
+{
+    return BOOT_STATUS_MAX_ENTRIES * BOOT_STATUS_STATE_COUNT * min_write_sz;
+}
+#endif
+
 uint32_t
 boot_trailer_sz(uint32_t min_write_sz)
 {
     return /* state for all sectors */
            boot_status_sz(min_write_sz)           +
-#ifdef MCUBOOT_ENC_IMAGES
-           /* encryption keys */
-#  if MCUBOOT_SWAP_SAVE_ENCTLV
-           BOOT_ENC_TLV_ALIGN_SIZE * 2            +
-#  else
-           BOOT_ENC_KEY_SIZE * 2                  +
-#  endif
-#endif
-           /* swap_type + copy_done + image_ok + swap_size */
-           BOOT_MAX_ALIGN * 4                     +
-           BOOT_MAGIC_SZ;
+           /* encryption keys, validated marker + validated boots, swap_size,
+            * swap_type + copy_done + image_ok and magic
+            */
+           BOOT_TRAILER_META_SZ;
 }
 
 int
@@ -235,79 +404,200 @@ boot_swap_size_off(const struct flash_area *fap)
     return boot_swap_info_off(fap) - BOOT_MAX_ALIGN;
 }
 
+#ifdef MCUBOOT_VALIDATED_MARKER
+static inline uint32_t
+boot_validated_off(const struct flash_area *fap)
+{
+    return boot_swap_size_off(fap) - BOOT_VALIDATED_ALIGN_SIZE;
+}
+
+uint32_t
+boot_validated_boots_off(const struct flash_area *fap)
+{
+    return boot_validated_off(fap) - BOOT_VALIDATED_BOOTS_SZ;
+}
+#endif
+
 #ifdef MCUBOOT_ENC_IMAGES
 static inline uint32_t
 boot_enc_key_off(const struct flash_area *fap, uint8_t slot)
 {
-#if MCUBOOT_SWAP_SAVE_ENCTLV
-    return boot_swap_size_off(fap) - ((slot + 1) *
-            ((((BOOT_ENC_TLV_SIZE - 1) / BOOT_MAX_ALIGN) + 1) * BOOT_MAX_ALIGN));
+    uint32_t off;
+
+#ifdef MCUBOOT_VALIDATED_MARKER
+    off = boot_validated_boots_off(fap);
 #else
-    return boot_swap_size_off(fap) - ((slot + 1) * BOOT_ENC_KEY_SIZE);
+    off = boot_swap_size_off(fap);
 #endif
+
+    return off - ((slot + 1) * BOOT_ENC_KEY_ALIGN_SIZE);
 }
 #endif
 
-int
-boot_read_swap_state(const struct flash_area *fap,
-                     struct boot_swap_state *state)
+/*
+ * Checks whether a field of a trailer is erased.  A field reading as the
+ * erased value is; otherwise, as erased flash does not read back as the
+ * erased value on every port, the field is checked again through
+ * flash_area_read_is_empty().
+ *
+ * @returns 1 if the field is erased, 0 if not, and a negative value on
+ *          errors.
+ */
+static int
+boot_trailer_field_is_erased(const struct flash_area *fap, uint32_t off,
+                             const uint8_t *field, size_t len)
+{
+    uint8_t buf[BOOT_MAGIC_SZ];
+    uint8_t erased_val;
+    size_t i;
+
+    erased_val = flash_area_erased_val(fap);
+    for (i = 0; i < len; i++) {
+        if (field[i] != erased_val) {
+            break;
+        }
+    }
+    if (i == len) {
+        return 1;
+    }
+
+    assert(len <= sizeof buf);
+    return flash_area_read_is_empty(fap, off, buf, len);
+}
+
+static int
+boot_flag_decode_field(const struct flash_area *fap, uint32_t off,
+                       uint8_t flag)
 {
-    uint32_t magic[BOOT_MAGIC_ARR_SZ];
-    uint32_t off;
-    uint8_t swap_info;
     int rc;
 
-    off = boot_magic_off(fap);
-    rc = flash_area_read_is_empty(fap, off, magic, BOOT_MAGIC_SZ);
+    if (flag == BOOT_FLAG_SET) {
+        return BOOT_FLAG_SET;
+    }
+
+    rc = boot_trailer_field_is_erased(fap, off, &flag, 1);
     if (rc < 0) {
-        return BOOT_EFLASH;
+        return -1;
     }
-    if (rc == 1) {
+
+    return rc ? BOOT_FLAG_UNSET : BOOT_FLAG_BAD;
+}
+
+/*
+ * Decodes the swap state from the end of a trailer, read at once.  Every
+ * field is decoded from that single read; only a field that holds neither
+ * the erased value nor a valid encoding is read again, to tell whether it is
+ * erased.
+ *
+ * @param fap                   The flash area holding the trailer.
+ * @param buf                   The last BOOT_TRAILER_STATE_SZ bytes of the
+ *                                  trailer.
+ * @param erased                Whether flash_area_read_is_empty() reported
+ *                                  them all erased.
+ * @param state                 On success, the decoded swap state.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+static int
+boot_swap_state_decode(const struct flash_area *fap, const uint8_t *buf,
+                       bool erased, struct boot_swap_state *state)
+{
+    const uint8_t *magic;
+    uint8_t swap_info;
+    int copy_done;
+    int image_ok;
+    int rc;
+
+    if (erased) {
         state->magic = BOOT_MAGIC_UNSET;
-    } else {
-        state->magic = boot_magic_decode(magic);
+        state->swap_type = BOOT_SWAP_TYPE_NONE;
+        state->image_num = 0;
+        state->copy_done = BOOT_FLAG_UNSET;
+        state->image_ok = BOOT_FLAG_UNSET;
+        return 0;
     }
 
-    off = boot_swap_info_off(fap);
-    rc = flash_area_read_is_empty(fap, off, &swap_info, sizeof swap_info);
-    if (rc < 0) {
-        return BOOT_EFLASH;
+    magic = &buf[BOOT_MAX_ALIGN * 3];
+    state->magic = boot_magic_decode(magic);
+    if (state->magic != BOOT_MAGIC_GOOD) {
+        rc = boot_trailer_field_is_erased(fap, boot_magic_off(fap), magic,
+                                          BOOT_MAGIC_SZ);
+        if (rc < 0) {
+            return BOOT_EFLASH;
+        }
+        if (rc == 1) {
+            state->magic = BOOT_MAGIC_UNSET;
+        }
     }
 
-    /* Extract the swap type and image number */
+    /* Extract the swap type and image number; an erased field decodes as no
+     * swap, like any other invalid one.
+     */
+    swap_info = buf[0];
     state->swap_type = BOOT_GET_SWAP_TYPE(swap_info);
     state->image_num = BOOT_GET_IMAGE_NUM(swap_info);
 
-    if (rc == 1 || state->swap_type > BOOT_SWAP_TYPE_REVERT) {
+    if (swap_info == flash_area_erased_val(fap) ||
+        state->swap_type > BOOT_SWAP_TYPE_REVERT) {
         state->swap_type = BOOT_SWAP_TYPE_NONE;
         state->image_num = 0;
     }
 
-    off = boot_copy_done_off(fap);
-    rc = flash_area_read_is_empty(fap, off, &state->copy_done,
-            sizeof state->copy_done);
+    copy_done = boot_flag_decode_field(fap, boot_copy_done_off(fap),
+                                       buf[BOOT_MAX_ALIGN]);
+    image_ok = boot_flag_decode_field(fap, boot_image_ok_off(fap),
+                                      buf[BOOT_MAX_ALIGN * 2]);
+    if (copy_done < 0 || image_ok < 0) {
+        return BOOT_EFLASH;
+    }
+    state->copy_done = copy_done;
+    state->image_ok = image_ok;
+
+    return 0;
+}
+
+/*
+ * Reads everything that follows the swap status of a trailer at once, and
+ * decodes the swap state from it.
+ */
+static int
+boot_read_trailer_meta(const struct flash_area *fap, uint8_t *meta,
+                       struct boot_swap_state *state)
+{
+    int rc;
+
+    rc = flash_area_read_is_empty(fap, boot_trailer_meta_off(fap), meta,
+                                  BOOT_TRAILER_META_SZ);
     if (rc < 0) {
         return BOOT_EFLASH;
     }
-    if (rc == 1) {
-        state->copy_done = BOOT_FLAG_UNSET;
-    } else {
-        state->copy_done = boot_flag_decode(state->copy_done);
+
+    return boot_swap_state_decode(fap,
+            &meta[BOOT_TRAILER_META_SZ - BOOT_TRAILER_STATE_SZ], rc == 1,
+            state);
+}
+
+int
+boot_read_swap_state(const struct flash_area *fap,
+                     struct boot_swap_state *state)
+{
+    struct boot_trailer_cache_entry *entry;
+    uint8_t buf[BOOT_TRAILER_STATE_SZ];
+    int rc;
+
+    entry = boot_trailer_cache_get(fap);
+    if (entry != NULL) {
+        *state = entry->state;
+        return 0;
     }
 
-    off = boot_image_ok_off(fap);
-    rc = flash_area_read_is_empty(fap, off, &state->image_ok,
-                                  sizeof state->image_ok);
+    rc = flash_area_read_is_empty(fap, boot_swap_info_off(fap), buf,
+                                  sizeof buf);
     if (rc < 0) {
         return BOOT_EFLASH;
     }
-    if (rc == 1) {
-        state->image_ok = BOOT_FLAG_UNSET;
-    } else {
-        state->image_ok = boot_flag_decode(state->image_ok);
-    }
 
-    return 0;
+    return boot_swap_state_decode(fap, buf, rc == 1, state);
 }
 
 /**
@@ -341,9 +631,8 @@ boot_read_swap_state_by_id(int flash_area_id, struct boot_swap_state *state)
 static int
 boot_find_status(int image_index, const struct flash_area **fap)
 {
-    uint32_t magic[BOOT_MAGIC_ARR_SZ];
-    uint32_t off;
-    uint8_t areas[2] = {
+    struct boot_swap_state swap_state;
+    uint8_t areas[] = {
 #if MCUBOOT_SWAP_USING_SCRATCH
         FLASH_AREA_IMAGE_SCRATCH,
 #endif
@@ -366,14 +655,13 @@ boot_find_status(int image_index, const struct flash_area **fap)
             return rc;
         }
 
-        off = boot_magic_off(*fap);
-        rc = flash_area_read(*fap, off, magic, BOOT_MAGIC_SZ);
+        rc = boot_read_swap_state(*fap, &swap_state);
         if (rc != 0) {
             flash_area_close(*fap);
             return rc;
         }
 
-        if (memcmp(magic, boot_img_magic, BOOT_MAGIC_SZ) == 0) {
+        if (swap_state.magic == BOOT_MAGIC_GOOD) {
             return 0;
         }
 
@@ -394,7 +682,7 @@ boot_read_swap_size(int image_index, uint32_t *swap_size)
     rc = boot_find_status(image_index, &fap);
     if (rc == 0) {
         off = boot_swap_size_off(fap);
-        rc = flash_area_read(fap, off, swap_size, sizeof *swap_size);
+        rc = boot_read_trailer_field(fap, off, swap_size, sizeof *swap_size);
         flash_area_close(fap);
     }
 
@@ -407,8 +695,11 @@ boot_read_enc_key(int image_index, uint8_t slot, struct boot_status *bs)
 {
     uint32_t off;
     const struct flash_area *fap;
-#if MCUBOOT_SWAP_SAVE_ENCTLV
+#if MCUBOOT_SWAP_SAVE_ENCTLV || MCUBOOT_SWAP_SEAL_ENCKEY
     int i;
+#endif
+#if MCUBOOT_SWAP_SEAL_ENCKEY
+    uint8_t digest[BOOT_ENC_SEAL_DIGEST_SIZE];
 #endif
     int rc;
 
@@ -416,7 +707,8 @@ boot_read_enc_key(int image_index, uint8_t slot, struct boot_status *bs)
     if (rc == 0) {
         off = boot_enc_key_off(fap, slot);
 #if MCUBOOT_SWAP_SAVE_ENCTLV
-        rc = flash_area_read(fap, off, bs->enctlv[slot], BOOT_ENC_TLV_ALIGN_SIZE);
+        rc = boot_read_trailer_field(fap, off, bs->enctlv[slot],
+                                     BOOT_ENC_TLV_ALIGN_SIZE);
         if (rc == 0) {
             for (i = 0; i < BOOT_ENC_TLV_ALIGN_SIZE; i++) {
                 if (bs->enctlv[slot][i] != 0xff) {
@@ -428,14 +720,77 @@ boot_read_enc_key(int image_index, uint8_t slot, struct boot_status *bs)
                 rc = boot_enc_decrypt(bs->enctlv[slot], bs->enckey[slot]);
             }
         }
+#elif MCUBOOT_SWAP_SEAL_ENCKEY
+        rc = boot_read_trailer_field(fap, off, bs->enckey_sealed[slot],
+                                     BOOT_ENC_SEALED_ALIGN_SIZE);
+        if (rc == 0) {
+            for (i = 0; i < BOOT_ENC_SEALED_ALIGN_SIZE; i++) {
+                if (bs->enckey_sealed[slot][i] != 0xff) {
+                    break;
+                }
+            }
+            /* Only try to unseal non-erased keys */
+            if (i != BOOT_ENC_SEALED_ALIGN_SIZE) {
+                rc = boot_enc_unseal(bs->enckey_sealed[slot],
+                                     bs->enckey[slot], digest);
+            } else {
+                memset(bs->enckey[slot], 0xff, BOOT_ENC_KEY_SIZE);
+            }
+        }
 #else
-        rc = flash_area_read(fap, off, bs->enckey[slot], BOOT_ENC_KEY_SIZE);
+        rc = boot_read_trailer_field(fap, off, bs->enckey[slot],
+                                     BOOT_ENC_KEY_SIZE);
 #endif
         flash_area_close(fap);
     }
 
     return rc;
 }
+
+#if MCUBOOT_SWAP_SEAL_ENCKEY
+/**
+ * Looks in the swap status of an image for a key sealed from the key TLV
+ * with the given digest, such as the key of an image being reverted.
+ *
+ * @return 0 if found, with the key and its sealed copy stored; -1 otherwise.
+ */
+int
+boot_find_enc_key(int image_index, const uint8_t *digest, uint8_t *enckey,
+                  uint8_t *sealed)
+{
+    const struct flash_area *fap;
+    uint8_t buf[BOOT_ENC_SEALED_ALIGN_SIZE];
+    uint8_t key[BOOT_ENC_KEY_SIZE];
+    uint8_t sealed_digest[BOOT_ENC_SEAL_DIGEST_SIZE];
+    uint8_t slot;
+    int found;
+    int rc;
+
+    rc = boot_find_status(image_index, &fap);
+    if (rc != 0) {
+        return -1;
+    }
+
+    found = -1;
+    for (slot = 0; slot < BOOT_NUM_SLOTS && found != 0; slot++) {
+        rc = boot_read_trailer_field(fap, boot_enc_key_off(fap, slot), buf,
+                                     sizeof buf);
+        if (rc != 0 || boot_enc_unseal(buf, key, sealed_digest) != 0) {
+            continue;
+        }
+        if (memcmp(sealed_digest, digest, BOOT_ENC_SEAL_DIGEST_SIZE) == 0) {
+            memcpy(enckey, key, BOOT_ENC_KEY_SIZE);
+            memcpy(sealed, buf, BOOT_ENC_SEALED_ALIGN_SIZE);
+            found = 0;
+        }
+    }
+
+    flash_area_close(fap);
+    memset(key, 0, sizeof key);
+
+    return found;
+}
+#endif
 #endif
 
 int
@@ -449,6 +804,7 @@ boot_write_magic(const struct flash_area *fap)
     BOOT_LOG_DBG("writing magic; fa_id=%d off=0x%lx (0x%lx)",
                  fap->fa_id, (unsigned long)off,
                  (unsigned long)(fap->fa_off + off));
+    boot_trailer_cache_invalidate(fap, off, BOOT_MAGIC_SZ);
     rc = flash_area_write(fap, off, boot_img_magic, BOOT_MAGIC_SZ);
     if (rc != 0) {
         return BOOT_EFLASH;
@@ -469,22 +825,35 @@ boot_write_trailer(const struct flash_area *fap, uint32_t off,
     uint8_t buf[BOOT_MAX_ALIGN];
     uint8_t align;
     uint8_t erased_val;
+    uint8_t tail;
     int rc;
 
     align = flash_area_align(fap);
-    if (inlen > BOOT_MAX_ALIGN || align > BOOT_MAX_ALIGN) {
+    if (align > BOOT_MAX_ALIGN) {
         return -1;
     }
     erased_val = flash_area_erased_val(fap);
-    if (align < inlen) {
-        align = inlen;
+
+    boot_trailer_cache_invalidate(fap, off, inlen);
+
+    /* Whole write blocks are written from the input, and what is left is
+     * padded with the erased value to a last write block.
+     */
+    tail = inlen % align;
+    if (inlen > tail) {
+        rc = flash_area_write(fap, off, inbuf, inlen - tail);
+        if (rc != 0) {
+            return BOOT_EFLASH;
+        }
     }
-    memcpy(buf, inbuf, inlen);
-    memset(&buf[inlen], erased_val, align - inlen);
 
-    rc = flash_area_write(fap, off, buf, align);
-    if (rc != 0) {
-        return BOOT_EFLASH;
+    if (tail > 0) {
+        memcpy(buf, &inbuf[inlen - tail], tail);
+        memset(&buf[tail], erased_val, align - tail);
+        rc = flash_area_write(fap, off + inlen - tail, buf, align);
+        if (rc != 0) {
+            return BOOT_EFLASH;
+        }
     }
 
     return 0;
@@ -555,6 +924,152 @@ boot_write_swap_size(const struct flash_area *fap, uint32_t swap_size)
     return boot_write_trailer(fap, off, (const uint8_t *) &swap_size, 4);
 }
 
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+/*
+ * With scratch wear leveling, the swap_size field also holds the offset in the
+ * scratch area of the first range of the swap, in the 4 bytes following the
+ * size.  Both are written at once, as they share a single write block.
+ */
+int
+boot_write_swap_size_scratch(const struct flash_area *fap, uint32_t swap_size,
+                             uint32_t scratch_off)
+{
+    uint32_t buf[2];
+    uint32_t off;
+
+    buf[0] = swap_size;
+    buf[1] = scratch_off;
+
+    off = boot_swap_size_off(fap);
+    BOOT_LOG_DBG("writing swap_size; fa_id=%d off=0x%lx (0x%lx) scratch=0x%lx",
+                 fap->fa_id, (unsigned long)off,
+                 (unsigned long)fap->fa_off + off, (unsigned long)scratch_off);
+    return boot_write_trailer(fap, off, (const uint8_t *)buf, sizeof buf);
+}
+
+int
+boot_read_swap_size_scratch(const struct flash_area *fap, uint32_t *swap_size,
+                            uint32_t *scratch_off)
+{
+    uint32_t buf[2];
+    int rc;
+
+    rc = boot_read_trailer_field(fap, boot_swap_size_off(fap), buf,
+                                 sizeof buf);
+    if (rc != 0) {
+        return BOOT_EFLASH;
+    }
+
+    *swap_size = buf[0];
+    *scratch_off = buf[1];
+
+    return 0;
+}
+#endif /* MCUBOOT_SCRATCH_WEAR_LEVELING */
+
+#ifdef MCUBOOT_VALIDATED_MARKER
+/**
+ * Reads the validated marker of an image trailer, along with the number of
+ * boots that have already been accepted on it.
+ *
+ * @param fap                   The flash area holding the trailer.
+ * @param marker                Buffer of BOOT_VALIDATED_SZ bytes that
+ *                                  receives the marker.
+ * @param boots                 On success, the number of boots recorded
+ *                                  against the marker.
+ *
+ * @return                      0 if a marker was read; 1 if the marker is
+ *                                  erased; BOOT_EFLASH on failure.
+ */
+int
+boot_read_validated(const struct flash_area *fap, uint8_t *marker,
+                    uint32_t *boots)
+{
+#if MCUBOOT_VALIDATED_MARKER_MAX_BOOTS > 0
+    uint8_t buf[BOOT_MAX_ALIGN * 4];
+    uint32_t off;
+    uint32_t len;
+    uint32_t i;
+    uint8_t erased_val;
+#endif
+    int rc;
+
+    rc = flash_area_read_is_empty(fap, boot_validated_off(fap), marker,
+                                  BOOT_VALIDATED_SZ);
+    if (rc < 0) {
+        return BOOT_EFLASH;
+    }
+    if (rc == 1) {
+        return 1;
+    }
+
+    *boots = 0;
+
+#if MCUBOOT_VALIDATED_MARKER_MAX_BOOTS > 0
+    /* Boots are recorded in order, so count up to the first erased entry. */
+    erased_val = flash_area_erased_val(fap);
+    for (off = 0; off < BOOT_VALIDATED_BOOTS_SZ; off += len) {
+        len = BOOT_VALIDATED_BOOTS_SZ - off;
+        if (len > sizeof buf) {
+            len = sizeof buf;
+        }
+
+        rc = flash_area_read(fap, boot_validated_boots_off(fap) + off, buf,
+                             len);
+        if (rc != 0) {
+            return BOOT_EFLASH;
+        }
+
+        for (i = 0; i < len; i += BOOT_MAX_ALIGN) {
+            if (buf[i] == erased_val) {
+                return 0;
+            }
+            (*boots)++;
+        }
+    }
+#endif
+
+    return 0;
+}
+
+int
+boot_write_validated(const struct flash_area *fap, const uint8_t *marker)
+{
+    uint32_t off;
+
+    off = boot_validated_off(fap);
+    BOOT_LOG_DBG("writing validated marker; fa_id=%d off=0x%lx (0x%lx)",
+                 fap->fa_id, (unsigned long)off,
+                 (unsigned long)(fap->fa_off + off));
+    return boot_write_trailer(fap, off, marker, BOOT_VALIDATED_SZ);
+}
+
+#if MCUBOOT_VALIDATED_MARKER_MAX_BOOTS > 0
+
+/**
+ * Records that the image was booted on the strength of its validated marker.
+ *
+ * @param fap                   The flash area holding the trailer.
+ * @param boot                  Index of the boot being recorded, as returned
+ *                                  in boots by boot_read_validated().
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+int
+boot_write_validated_boot(const struct flash_area *fap, uint32_t boot)
+{
+    uint32_t off;
+
+    if (boot >= MCUBOOT_VALIDATED_MARKER_MAX_BOOTS) {
+        return BOOT_EBADARGS;
+    }
+
+    off = boot_validated_boots_off(fap) + boot * BOOT_MAX_ALIGN;
+    return boot_write_trailer_flag(fap, off, BOOT_FLAG_SET);
+}
+#endif
+#endif /* MCUBOOT_VALIDATED_MARKER */
+
 #ifdef MCUBOOT_ENC_IMAGES
 int
 boot_write_enc_key(const struct flash_area *fap, uint8_t slot,
@@ -567,8 +1082,12 @@ boot_write_enc_key(const struct flash_area *fap, uint8_t slot,
     BOOT_LOG_DBG("writing enc_key; fa_id=%d off=0x%lx (0x%lx)",
                  fap->fa_id, (unsigned long)off,
                  (unsigned long)fap->fa_off + off);
+    boot_trailer_cache_invalidate(fap, off, BOOT_ENC_KEY_ALIGN_SIZE);
 #if MCUBOOT_SWAP_SAVE_ENCTLV
     rc = flash_area_write(fap, off, bs->enctlv[slot], BOOT_ENC_TLV_ALIGN_SIZE);
+#elif MCUBOOT_SWAP_SEAL_ENCKEY
+    rc = flash_area_write(fap, off, bs->enckey_sealed[slot],
+                          BOOT_ENC_SEALED_ALIGN_SIZE);
 #else
     rc = flash_area_write(fap, off, bs->enckey[slot], BOOT_ENC_KEY_SIZE);
 #endif
@@ -643,37 +1162,51 @@ boot_swap_type(void)
 }
 
 /**
- * Marks the image in the secondary slot as pending.  On the next reboot,
- * the system will perform a one-time boot of the the secondary slot image.
+ * Marks the image in the given slot as pending.  On the next reboot, the
+ * system will perform a one-time boot of that image: with a swap upgrade, the
+ * image must be in the secondary slot, while with MCUBOOT_DIRECT_XIP, it can
+ * be in either slot and is run in place.
  *
+ * @param slot              The slot holding the image (0=primary,
+ *                              1=secondary).
  * @param permanent         Whether the image should be used permanently or
  *                              only tested once:
  *                                  0=run image once, then confirm or revert.
  *                                  1=run image forever.
+ *                              With MCUBOOT_SWAP_USING_RAM, only permanent
+ *                              upgrades are supported.
  *
  * @return                  0 on success; nonzero on failure.
  */
 int
-boot_set_pending(int permanent)
+boot_set_pending_slot(int slot, int permanent)
 {
     const struct flash_area *fap;
-    struct boot_swap_state state_secondary_slot;
+    struct boot_swap_state state_slot;
     uint8_t swap_type;
+    int area_id;
     int rc;
 
-    rc = boot_read_swap_state_by_id(FLASH_AREA_IMAGE_SECONDARY(0),
-                                    &state_secondary_slot);
+#ifdef MCUBOOT_SWAP_USING_RAM
+    if (!permanent) {
+        /* Test upgrades cannot be reverted. */
+        return BOOT_EBADARGS;
+    }
+#endif
+
+    area_id = flash_area_id_from_multi_image_slot(0, slot);
+    rc = boot_read_swap_state_by_id(area_id, &state_slot);
     if (rc != 0) {
         return rc;
     }
 
-    switch (state_secondary_slot.magic) {
+    switch (state_slot.magic) {
     case BOOT_MAGIC_GOOD:
         /* Swap already scheduled. */
         return 0;
 
     case BOOT_MAGIC_UNSET:
-        rc = flash_area_open(FLASH_AREA_IMAGE_SECONDARY(0), &fap);
+        rc = flash_area_open(area_id, &fap);
         if (rc != 0) {
             rc = BOOT_EFLASH;
         } else {
@@ -700,11 +1233,12 @@ boot_set_pending(int permanent)
         /* The image slot is corrupt.  There is no way to recover, so erase the
          * slot to allow future upgrades.
          */
-        rc = flash_area_open(FLASH_AREA_IMAGE_SECONDARY(0), &fap);
+        rc = flash_area_open(area_id, &fap);
         if (rc != 0) {
             return BOOT_EFLASH;
         }
 
+        boot_trailer_cache_invalidate(fap, 0, fap->fa_size);
         flash_area_erase(fap, 0, fap->fa_size);
         flash_area_close(fap);
         return BOOT_EBADIMAGE;
@@ -716,26 +1250,47 @@ boot_set_pending(int permanent)
 }
 
 /**
- * Marks the image in the primary slot as confirmed.  The system will continue
- * booting into the image in the primary slot until told to boot from a
- * different slot.
+ * Marks the image in the secondary slot as pending.  On the next reboot,
+ * the system will perform a one-time boot of the the secondary slot image.
+ *
+ * @param permanent         Whether the image should be used permanently or
+ *                              only tested once:
+ *                                  0=run image once, then confirm or revert.
+ *                                  1=run image forever.
+ *
+ * @return                  0 on success; nonzero on failure.
+ */
+int
+boot_set_pending(int permanent)
+{
+    return boot_set_pending_slot(1, permanent);
+}
+
+/**
+ * Marks the image in the given slot as confirmed.  With a swap upgrade, the
+ * running image is always in the primary slot; with MCUBOOT_DIRECT_XIP, it is
+ * in the slot it was started from.
+ *
+ * @param slot              The slot holding the image (0=primary,
+ *                              1=secondary).
  *
  * @return                  0 on success; nonzero on failure.
  */
 int
-boot_set_confirmed(void)
+boot_set_confirmed_slot(int slot)
 {
     const struct flash_area *fap;
-    struct boot_swap_state state_primary_slot;
+    struct boot_swap_state state_slot;
+    int area_id;
     int rc;
 
-    rc = boot_read_swap_state_by_id(FLASH_AREA_IMAGE_PRIMARY(0),
-                                    &state_primary_slot);
+    area_id = flash_area_id_from_multi_image_slot(0, slot);
+    rc = boot_read_swap_state_by_id(area_id, &state_slot);
     if (rc != 0) {
         return rc;
     }
 
-    switch (state_primary_slot.magic) {
+    switch (state_slot.magic) {
     case BOOT_MAGIC_GOOD:
         /* Confirm needed; proceed. */
         break;
@@ -749,19 +1304,19 @@ boot_set_confirmed(void)
         return BOOT_EBADVECT;
     }
 
-    rc = flash_area_open(FLASH_AREA_IMAGE_PRIMARY(0), &fap);
+    rc = flash_area_open(area_id, &fap);
     if (rc) {
         rc = BOOT_EFLASH;
         goto done;
     }
 
-    if (state_primary_slot.copy_done == BOOT_FLAG_UNSET) {
+    if (state_slot.copy_done == BOOT_FLAG_UNSET) {
         /* Swap never completed.  This is unexpected. */
         rc = BOOT_EBADVECT;
         goto done;
     }
 
-    if (state_primary_slot.image_ok != BOOT_FLAG_UNSET) {
+    if (state_slot.image_ok != BOOT_FLAG_UNSET) {
         /* Already confirmed. */
         goto done;
     }
@@ -772,3 +1327,42 @@ done:
     flash_area_close(fap);
     return rc;
 }
+
+/**
+ * Marks the running image as confirmed.  The system will continue booting
+ * into that image until told to boot from a different slot.  With a swap
+ * upgrade, the running image is in the primary slot; with
+ * MCUBOOT_DIRECT_XIP, it is the test image which was selected, whichever slot
+ * holds it.
+ *
+ * @return                  0 on success; nonzero on failure.
+ */
+int
+boot_set_confirmed(void)
+{
+#ifdef MCUBOOT_DIRECT_XIP
+    struct boot_swap_state state_slot;
+    int slot;
+    int rc;
+
+    for (slot = 0; slot < BOOT_NUM_SLOTS; slot++) {
+        rc = boot_read_swap_state_by_id(
+                flash_area_id_from_multi_image_slot(0, slot), &state_slot);
+        if (rc != 0) {
+            return rc;
+        }
+
+        /* Only the test image being run has copy_done without image_ok. */
+        if (state_slot.magic == BOOT_MAGIC_GOOD &&
+            state_slot.copy_done == BOOT_FLAG_SET &&
+            state_slot.image_ok == BOOT_FLAG_UNSET) {
+            return boot_set_confirmed_slot(slot);
+        }
+    }
+
+    /* The running image is already confirmed. */
+    return 0;
+#else
+    return boot_set_confirmed_slot(0);
+#endif
+}
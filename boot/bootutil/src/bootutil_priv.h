@@ -39,6 +39,12 @@
 #ifdef MCUBOOT_ENC_IMAGES
 #include "bootutil/enc_key.h"
 #endif
+#if defined(MCUBOOT_HASH_ON_COPY) || defined(MCUBOOT_COMPRESSED_IMAGES)
+#include "bootutil/sha256.h"
+#endif
+#ifdef MCUBOOT_FLASH_AREA_GET_PTR
+#include <string.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -63,6 +69,25 @@ struct flash_area;
 
 #define BOOT_TMPBUF_SZ  256
 
+/*
+ * Size of the buffer used to copy images between slots; each copy step reads
+ * and programs one buffer.  With MCUBOOT_COPY_DOUBLE_BUF or MCUBOOT_FLASH_ASYNC
+ * two of them are used, so that the next chunk is fetched while the current
+ * one is programmed.
+ */
+#ifndef MCUBOOT_COPY_BUF_SIZE
+#define MCUBOOT_COPY_BUF_SIZE   1024
+#endif
+#if (MCUBOOT_COPY_BUF_SIZE < BOOT_MAX_ALIGN) || \
+    (MCUBOOT_COPY_BUF_SIZE % BOOT_MAX_ALIGN) != 0
+#error "MCUBOOT_COPY_BUF_SIZE must be a multiple of BOOT_MAX_ALIGN"
+#endif
+#if defined(MCUBOOT_COPY_DOUBLE_BUF) || defined(MCUBOOT_FLASH_ASYNC)
+#define BOOT_COPY_BUF_CNT       2
+#else
+#define BOOT_COPY_BUF_CNT       1
+#endif
+
 /** Number of image slots in flash; currently limited to two. */
 #define BOOT_NUM_SLOTS                  2
 
@@ -70,10 +95,83 @@ struct flash_area;
 #error "Please enable only one of MCUBOOT_OVERWRITE_ONLY or MCUBOOT_SWAP_USING_MOVE"
 #endif
 
-#if !defined(MCUBOOT_OVERWRITE_ONLY) && !defined(MCUBOOT_SWAP_USING_MOVE)
+#if defined(MCUBOOT_SWAP_USING_RAM) && \
+    (defined(MCUBOOT_OVERWRITE_ONLY) || defined(MCUBOOT_SWAP_USING_MOVE))
+#error "Please enable only one of MCUBOOT_OVERWRITE_ONLY, MCUBOOT_SWAP_USING_MOVE or MCUBOOT_SWAP_USING_RAM"
+#endif
+
+#if !defined(MCUBOOT_OVERWRITE_ONLY) && !defined(MCUBOOT_SWAP_USING_MOVE) && \
+    !defined(MCUBOOT_SWAP_USING_RAM)
 #define MCUBOOT_SWAP_USING_SCRATCH 1
 #endif
 
+#ifdef MCUBOOT_SWAP_USING_RAM
+/*
+ * Size of the buffer a sector is staged in while it is swapped; every sector
+ * of the slots must fit in it.
+ */
+#ifndef MCUBOOT_SWAP_RAM_BUF_SIZE
+#define MCUBOOT_SWAP_RAM_BUF_SIZE   4096
+#endif
+
+/*
+ * Each sector swapped through RAM has the first bytes of its SHA-256 kept in
+ * the swap status, to tell after a reset whether a copy of it is still intact.
+ */
+#define BOOT_SWAP_RAM_HASH_SIZE     16
+#define BOOT_SWAP_RAM_HASH_ALIGN_SIZE \
+    ((((BOOT_SWAP_RAM_HASH_SIZE - 1) / BOOT_MAX_ALIGN) + 1) * BOOT_MAX_ALIGN)
+#endif
+
+#if defined(MCUBOOT_DELTA_UPGRADE) && !defined(MCUBOOT_SWAP_USING_SCRATCH)
+#error "MCUBOOT_DELTA_UPGRADE requires swap using scratch"
+#endif
+
+#if defined(MCUBOOT_SCRATCH_WEAR_LEVELING) && \
+    !defined(MCUBOOT_SWAP_USING_SCRATCH)
+#error "MCUBOOT_SCRATCH_WEAR_LEVELING requires swap using scratch"
+#endif
+
+#if defined(MCUBOOT_SWAP_SECTOR_STATUS) && !defined(MCUBOOT_SWAP_USING_SCRATCH)
+#error "MCUBOOT_SWAP_SECTOR_STATUS requires swap using scratch"
+#endif
+
+#ifdef MCUBOOT_DIRECT_XIP
+#if defined(MCUBOOT_OVERWRITE_ONLY) || defined(MCUBOOT_SWAP_USING_MOVE) || \
+    defined(MCUBOOT_SWAP_USING_RAM)
+#error "MCUBOOT_DIRECT_XIP runs images in place and cannot upgrade them"
+#endif
+#if defined(MCUBOOT_ENC_IMAGES) || defined(MCUBOOT_DELTA_UPGRADE)
+#error "MCUBOOT_DIRECT_XIP requires images that can be run as stored"
+#endif
+#if defined(MCUBOOT_IMAGE_NUMBER) && (MCUBOOT_IMAGE_NUMBER > 1)
+#error "MCUBOOT_DIRECT_XIP only supports a single image"
+#endif
+#endif
+
+#ifdef MCUBOOT_VALIDATED_MARKER
+#ifndef MCUBOOT_VALIDATE_PRIMARY_SLOT
+#error "MCUBOOT_VALIDATED_MARKER requires MCUBOOT_VALIDATE_PRIMARY_SLOT"
+#endif
+#ifndef MCUBOOT_VALIDATED_MARKER_MAX_BOOTS
+#define MCUBOOT_VALIDATED_MARKER_MAX_BOOTS 0
+#endif
+#define BOOT_VALIDATED_SZ       32
+#define BOOT_VALIDATED_ALIGN_SIZE \
+    ((((BOOT_VALIDATED_SZ - 1) / BOOT_MAX_ALIGN) + 1) * BOOT_MAX_ALIGN)
+#define BOOT_VALIDATED_BOOTS_SZ \
+    (MCUBOOT_VALIDATED_MARKER_MAX_BOOTS * BOOT_MAX_ALIGN)
+#endif
+
+#if MCUBOOT_SWAP_SEAL_ENCKEY
+#if !defined(MCUBOOT_ENC_IMAGES) || defined(MCUBOOT_OVERWRITE_ONLY)
+#error "MCUBOOT_SWAP_SEAL_ENCKEY requires MCUBOOT_ENC_IMAGES with swap upgrades"
+#endif
+#if MCUBOOT_SWAP_SAVE_ENCTLV
+#error "Please enable only one of MCUBOOT_SWAP_SEAL_ENCKEY or MCUBOOT_SWAP_SAVE_ENCTLV"
+#endif
+#endif
+
 #define BOOT_STATUS_OP_MOVE     1
 #define BOOT_STATUS_OP_SWAP     2
 
@@ -87,15 +185,110 @@ struct boot_status {
     uint8_t use_scratch;  /* Are status bytes ever written to scratch? */
     uint8_t swap_type;    /* The type of swap in effect */
     uint32_t swap_size;   /* Total size of swapped image */
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+    uint32_t scratch_off; /* Where the first range is saved in scratch */
+#endif
+#ifdef MCUBOOT_SWAP_SKIP_IDENTICAL
+    uint8_t skipped;      /* Is the current range identical in both slots? */
+#endif
 #ifdef MCUBOOT_ENC_IMAGES
     uint8_t enckey[BOOT_NUM_SLOTS][BOOT_ENC_KEY_SIZE];
 #if MCUBOOT_SWAP_SAVE_ENCTLV
     uint8_t enctlv[BOOT_NUM_SLOTS][BOOT_ENC_TLV_ALIGN_SIZE];
+#elif MCUBOOT_SWAP_SEAL_ENCKEY
+    uint8_t enckey_sealed[BOOT_NUM_SLOTS][BOOT_ENC_SEALED_ALIGN_SIZE];
 #endif
 #endif
     int source;           /* Which slot contains swap status metadata */
 };
 
+#ifdef MCUBOOT_HASH_ON_COPY
+#define BOOT_COPY_HASH_NONE     0
+#define BOOT_COPY_HASH_RUNNING  1
+#define BOOT_COPY_HASH_DONE     2
+
+/*
+ * Running hash of an image being copied into the primary slot.
+ */
+struct boot_copy_hash {
+    bootutil_sha256_context sha256_ctx;
+    uint32_t off;         /* Primary slot offset of the next expected chunk */
+    uint32_t size;        /* Number of bytes covered by the image hash */
+    uint8_t state;        /* BOOT_COPY_HASH_[...] */
+    uint8_t hash[32];     /* Image hash, valid once state is DONE */
+};
+#endif
+
+#ifdef MCUBOOT_ENC_DECRYPT_ONCE
+#if !defined(MCUBOOT_ENC_IMAGES) || !defined(MCUBOOT_HASH_ON_COPY)
+#error "MCUBOOT_ENC_DECRYPT_ONCE requires MCUBOOT_ENC_IMAGES and MCUBOOT_HASH_ON_COPY"
+#endif
+#ifndef MCUBOOT_SWAP_USING_MOVE
+#error "MCUBOOT_ENC_DECRYPT_ONCE requires MCUBOOT_SWAP_USING_MOVE"
+#endif
+#endif
+
+#ifdef MCUBOOT_COMPRESSED_IMAGES
+#ifndef MCUBOOT_OVERWRITE_ONLY
+#error "MCUBOOT_COMPRESSED_IMAGES requires MCUBOOT_OVERWRITE_ONLY"
+#endif
+
+/* Largest match distance in a compressed payload. */
+#define BOOT_DECOMP_WINDOW_SZ   4096
+
+/*
+ * State of the decompression of an LZ4 block stream.  The window doubles as
+ * the output buffer, and is written to flash each time it fills up.
+ */
+struct boot_decomp {
+    uint8_t window[BOOT_DECOMP_WINDOW_SZ];
+    bootutil_sha256_context sha256_ctx;
+    const struct flash_area *fap; /* Output area */
+    uint32_t off;         /* Offset in fap of the output */
+    uint32_t max_sz;      /* Largest output accepted */
+    uint32_t out_sz;      /* Number of bytes produced */
+    uint32_t flushed_sz;  /* Number of bytes hashed and written */
+    uint32_t len;         /* Remaining length of the current run */
+    uint16_t dist;        /* Distance of the current match */
+    uint8_t token;        /* Token of the current sequence */
+    uint8_t state;
+};
+
+void boot_decomp_init(struct boot_decomp *d, const struct flash_area *fap,
+                      uint32_t off, uint32_t max_sz);
+int boot_decomp_update(struct boot_decomp *d, const uint8_t *buf,
+                       uint32_t len);
+int boot_decomp_finish(struct boot_decomp *d, uint8_t *hash);
+#endif
+
+#ifdef MCUBOOT_IMAGE_MANIFEST
+#if !defined(MCUBOOT_IMAGE_NUMBER) || (MCUBOOT_IMAGE_NUMBER < 2)
+#error "MCUBOOT_IMAGE_MANIFEST requires MCUBOOT_IMAGE_NUMBER > 1"
+#endif
+
+/* Image whose protected TLVs list the hashes of the other images of the set. */
+#define BOOT_MANIFEST_IMAGE     0
+
+void bootutil_manifest_clear(int slot);
+int bootutil_manifest_load(int slot, struct image_header *hdr,
+                           const struct flash_area *fap);
+const uint8_t *bootutil_manifest_hash(int slot, int image_index);
+#endif
+
+#ifdef MCUBOOT_EC256_FIXED_BASE
+#if !defined(MCUBOOT_SIGN_EC256) || !defined(MCUBOOT_USE_TINYCRYPT)
+#error "MCUBOOT_EC256_FIXED_BASE requires MCUBOOT_SIGN_EC256 with tinycrypt"
+#endif
+
+#ifndef MCUBOOT_EC256_FIXED_BASE_WIDTH
+#define MCUBOOT_EC256_FIXED_BASE_WIDTH  4
+#endif
+
+bool bootutil_ec256_table_usable(const uint8_t *pubkey, const uint8_t *table);
+int bootutil_ec256_verify_fixed(const uint8_t *table, const uint8_t *hash,
+                                const uint8_t *signature);
+#endif
+
 #define BOOT_MAGIC_GOOD     1
 #define BOOT_MAGIC_BAD      2
 #define BOOT_MAGIC_UNSET    3
@@ -116,6 +309,12 @@ struct boot_status {
 #define BOOT_STATUS_STATE_1 2
 #define BOOT_STATUS_STATE_2 3
 
+/*
+ * Or'ed into the status entries of a range of sectors that holds the same
+ * data in both slots, and so is not swapped (MCUBOOT_SWAP_SKIP_IDENTICAL).
+ */
+#define BOOT_STATUS_SKIPPED 0x80
+
 /**
  * End-of-image slot structure.
  *
@@ -132,6 +331,13 @@ struct boot_status {
  *  |                 Encryption key 1 (16 octets) [*]              |
  *  |                                                               |
  *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *  ~                                                               ~
+ *  ~          Validated boots (MAX_BOOTS * 8 octets) [**]          ~
+ *  ~                                                               ~
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *  |               Validated marker (32 octets) [**]               |
+ *  ~                                                               ~
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
  *  |                      Swap size (4 octets)                     |
  *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
  *  |   Swap info   |           0xff padding (7 octets)             |
@@ -146,6 +352,8 @@ struct boot_status {
  *
  * [*]: Only present if the encryption option is enabled
  *      (`MCUBOOT_ENC_IMAGES`).
+ * [**]: Only present if the validated marker option is enabled
+ *       (`MCUBOOT_VALIDATED_MARKER`).
  */
 
 extern const uint32_t boot_img_magic[4];
@@ -211,6 +419,7 @@ _Static_assert(BOOT_IMAGE_NUMBER > 0, "Invalid value for BOOT_IMAGE_NUMBER");
 #define BOOT_STATUS_SOURCE_NONE         0
 #define BOOT_STATUS_SOURCE_SCRATCH      1
 #define BOOT_STATUS_SOURCE_PRIMARY_SLOT 2
+#define BOOT_STATUS_SOURCE_SECONDARY_SLOT 3
 
 #define BOOT_MAGIC_SZ (sizeof boot_img_magic)
 
@@ -249,17 +458,40 @@ struct boot_loader_state {
     struct enc_key_data enc[BOOT_IMAGE_NUMBER][BOOT_NUM_SLOTS];
 #endif
 
+#ifdef MCUBOOT_HASH_ON_COPY
+    struct boot_copy_hash copy_hash[BOOT_IMAGE_NUMBER];
+#endif
+
+#ifdef MCUBOOT_SWAP_USING_MOVE
+    /* How far the image in the primary slot is moved up before a swap. */
+    uint32_t move_sz[BOOT_IMAGE_NUMBER];
+#endif
+
 #if (BOOT_IMAGE_NUMBER > 1)
     uint8_t curr_img_idx;
 #endif
 };
 
-int bootutil_verify_sig(uint8_t *hash, uint32_t hlen, uint8_t *sig,
+int bootutil_verify_sig(uint8_t *hash, uint32_t hlen, const uint8_t *sig,
                         size_t slen, uint8_t key_id);
 
+int bootutil_img_hash(struct enc_key_data *enc_state, int image_index,
+                      struct image_header *hdr, const struct flash_area *fap,
+                      uint8_t *tmp_buf, uint32_t tmp_buf_sz,
+                      uint8_t *hash_result, uint8_t *seed, int seed_len);
+int bootutil_img_validate_hash(int image_index, struct image_header *hdr,
+                               const struct flash_area *fap, uint8_t *hash);
+#ifdef MCUBOOT_ENC_DECRYPT_ONCE
+int bootutil_img_validate_tlv_hash(int image_index, struct image_header *hdr,
+                                   const struct flash_area *fap);
+#endif
+
 int boot_magic_compatible_check(uint8_t tbl_val, uint8_t val);
 uint32_t boot_status_sz(uint32_t min_write_sz);
 uint32_t boot_trailer_sz(uint32_t min_write_sz);
+#ifdef MCUBOOT_SWAP_SECTOR_STATUS
+uint32_t boot_unit_status_sz(uint32_t min_write_sz);
+#endif
 int boot_status_entries(int image_index, const struct flash_area *fap);
 uint32_t boot_status_off(const struct flash_area *fap);
 uint32_t boot_swap_info_off(const struct flash_area *fap);
@@ -267,6 +499,10 @@ int boot_read_swap_state(const struct flash_area *fap,
                          struct boot_swap_state *state);
 int boot_read_swap_state_by_id(int flash_area_id,
                                struct boot_swap_state *state);
+void boot_trailer_cache_start(void);
+void boot_trailer_cache_stop(void);
+void boot_trailer_cache_invalidate(const struct flash_area *fap, uint32_t off,
+                                   uint32_t len);
 int boot_write_magic(const struct flash_area *fap);
 int boot_write_status(const struct boot_loader_state *state, struct boot_status *bs);
 int boot_write_copy_done(const struct flash_area *fap);
@@ -275,6 +511,12 @@ int boot_write_swap_info(const struct flash_area *fap, uint8_t swap_type,
                          uint8_t image_num);
 int boot_write_swap_size(const struct flash_area *fap, uint32_t swap_size);
 int boot_read_swap_size(int image_index, uint32_t *swap_size);
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+int boot_write_swap_size_scratch(const struct flash_area *fap,
+                                 uint32_t swap_size, uint32_t scratch_off);
+int boot_read_swap_size_scratch(const struct flash_area *fap,
+                                uint32_t *swap_size, uint32_t *scratch_off);
+#endif
 int boot_slots_compatible(struct boot_loader_state *state);
 uint32_t boot_status_internal_off(const struct boot_status *bs, int elem_sz);
 int boot_read_image_header(struct boot_loader_state *state, int slot,
@@ -283,13 +525,38 @@ int boot_copy_region(struct boot_loader_state *state,
                      const struct flash_area *fap_src,
                      const struct flash_area *fap_dst,
                      uint32_t off_src, uint32_t off_dst, uint32_t sz);
+#ifdef MCUBOOT_ENC_IMAGES
+void boot_encrypt_region(struct boot_loader_state *state,
+                         const struct flash_area *fap,
+                         const struct image_header *hdr, uint32_t off,
+                         uint8_t *buf, uint32_t sz);
+#endif
 int boot_erase_region(const struct flash_area *fap, uint32_t off, uint32_t sz);
+int boot_erase_region_start(const struct flash_area *fap, uint32_t off,
+                            uint32_t sz);
 bool boot_status_is_reset(const struct boot_status *bs);
 
+#ifdef MCUBOOT_VALIDATED_MARKER
+uint32_t boot_validated_boots_off(const struct flash_area *fap);
+int boot_read_validated(const struct flash_area *fap, uint8_t *marker,
+                        uint32_t *boots);
+int boot_write_validated(const struct flash_area *fap, const uint8_t *marker);
+#if MCUBOOT_VALIDATED_MARKER_MAX_BOOTS > 0
+int boot_write_validated_boot(const struct flash_area *fap, uint32_t boot);
+#endif
+int bootutil_img_validated_binding(int image_index, struct image_header *hdr,
+                                   const struct flash_area *fap,
+                                   uint8_t *binding);
+#endif
+
 #ifdef MCUBOOT_ENC_IMAGES
 int boot_write_enc_key(const struct flash_area *fap, uint8_t slot,
                        const struct boot_status *bs);
 int boot_read_enc_key(int image_index, uint8_t slot, struct boot_status *bs);
+#if MCUBOOT_SWAP_SEAL_ENCKEY
+int boot_find_enc_key(int image_index, const uint8_t *digest, uint8_t *enckey,
+                      uint8_t *sealed);
+#endif
 #endif
 
 /**
@@ -327,6 +594,60 @@ static inline bool boot_u16_safe_add(uint16_t *dest, uint16_t a, uint16_t b)
     }
 }
 
+/**
+ * Compares len bytes in a time that does not depend on their values.  Returns
+ * zero if they are equal.
+ */
+static inline int bootutil_constant_time_compare(const uint8_t *a,
+                                                 const uint8_t *b, size_t len)
+{
+    uint8_t diff = 0;
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        diff |= a[i] ^ b[i];
+    }
+
+    return diff != 0;
+}
+
+/**
+ * Makes *ptr point to len bytes at off in fap.  When the flash backend can
+ * map the data (MCUBOOT_FLASH_AREA_GET_PTR) it is used in place; otherwise it
+ * is read into buf, which must hold len bytes.  Returns 0 on success.
+ */
+static inline int
+bootutil_flash_ptr(const struct flash_area *fap, uint32_t off, void *buf,
+                   uint32_t len, const void **ptr)
+{
+#ifdef MCUBOOT_FLASH_AREA_GET_PTR
+    if (flash_area_get_ptr(fap, off, len, ptr) == 0) {
+        return 0;
+    }
+#endif
+    *ptr = buf;
+    return flash_area_read(fap, off, buf, len);
+}
+
+/**
+ * Like flash_area_read(), but copies directly from memory-mapped flash when
+ * the backend allows it, bypassing the flash driver.
+ */
+static inline int
+bootutil_flash_read(const struct flash_area *fap, uint32_t off, void *dst,
+                    uint32_t len)
+{
+#ifdef MCUBOOT_FLASH_AREA_GET_PTR
+    const void *ptr;
+
+    if (flash_area_get_ptr(fap, off, len, &ptr) == 0) {
+        memcpy(dst, ptr, len);
+        return 0;
+    }
+#endif
+    return flash_area_read(fap, off, dst, len);
+}
+
 /*
  * Accessors for the contents of struct boot_loader_state.
  */
@@ -342,6 +663,12 @@ static inline bool boot_u16_safe_add(uint16_t *dest, uint16_t a, uint16_t b)
 #else
 #define BOOT_CURR_ENC(state) NULL
 #endif
+#ifdef MCUBOOT_HASH_ON_COPY
+#define BOOT_CURR_COPY_HASH(state) ((state)->copy_hash[BOOT_CURR_IMG(state)])
+#endif
+#ifdef MCUBOOT_SWAP_USING_MOVE
+#define BOOT_MOVE_SZ(state) ((state)->move_sz[BOOT_CURR_IMG(state)])
+#endif
 #define BOOT_IMG(state, slot) ((state)->imgs[BOOT_CURR_IMG(state)][(slot)])
 #define BOOT_IMG_AREA(state, slot) (BOOT_IMG(state, slot).area)
 #define BOOT_WRITE_SZ(state) ((state)->write_sz)
@@ -395,6 +722,24 @@ boot_img_sector_off(const struct boot_loader_state *state, size_t slot,
            BOOT_IMG(state, slot).sectors[0].fa_off;
 }
 
+#if MCUBOOT_SWAP_USING_SCRATCH
+static inline size_t
+boot_scratch_sector_size(const struct boot_loader_state *state, size_t sector)
+{
+    return state->scratch.sectors[sector].fa_size;
+}
+
+/*
+ * Offset of the sector from the beginning of the scratch area.
+ */
+static inline uint32_t
+boot_scratch_sector_off(const struct boot_loader_state *state, size_t sector)
+{
+    return state->scratch.sectors[sector].fa_off -
+           state->scratch.sectors[0].fa_off;
+}
+#endif
+
 #else  /* defined(MCUBOOT_USE_FLASH_AREA_GET_SECTORS) */
 
 static inline size_t
@@ -412,6 +757,21 @@ boot_img_sector_off(const struct boot_loader_state *state, size_t slot,
            BOOT_IMG(state, slot).sectors[0].fs_off;
 }
 
+#if MCUBOOT_SWAP_USING_SCRATCH
+static inline size_t
+boot_scratch_sector_size(const struct boot_loader_state *state, size_t sector)
+{
+    return state->scratch.sectors[sector].fs_size;
+}
+
+static inline uint32_t
+boot_scratch_sector_off(const struct boot_loader_state *state, size_t sector)
+{
+    return state->scratch.sectors[sector].fs_off -
+           state->scratch.sectors[0].fs_off;
+}
+#endif
+
 #endif  /* !defined(MCUBOOT_USE_FLASH_AREA_GET_SECTORS) */
 
 #ifdef __cplusplus
@@ -40,10 +40,14 @@ uint32_t bootutil_get_caps(void)
 #if defined(MCUBOOT_SIGN_ED25519)
     res |= BOOTUTIL_CAP_ED25519;
 #endif
-#if defined(MCUBOOT_OVERWRITE_ONLY)
+#if defined(MCUBOOT_DIRECT_XIP)
+    res |= BOOTUTIL_CAP_DIRECT_XIP;
+#elif defined(MCUBOOT_OVERWRITE_ONLY)
     res |= BOOTUTIL_CAP_OVERWRITE_UPGRADE;
 #elif defined(MCUBOOT_SWAP_USING_MOVE)
     res |= BOOTUTIL_CAP_SWAP_USING_MOVE;
+#elif defined(MCUBOOT_SWAP_USING_RAM)
+    res |= BOOTUTIL_CAP_SWAP_USING_RAM;
 #else
     res |= BOOTUTIL_CAP_SWAP_USING_SCRATCH;
 #endif
@@ -65,6 +69,15 @@ uint32_t bootutil_get_caps(void)
 #if defined(MCUBOOT_DOWNGRADE_PREVENTION)
     res |= BOOTUTIL_CAP_DOWNGRADE_PREVENTION;
 #endif
+#if defined(MCUBOOT_DELTA_UPGRADE)
+    res |= BOOTUTIL_CAP_DELTA_UPGRADE;
+#endif
+#if defined(MCUBOOT_COMPRESSED_IMAGES)
+    res |= BOOTUTIL_CAP_COMPRESSED_IMAGES;
+#endif
+#if defined(MCUBOOT_IMAGE_MANIFEST)
+    res |= BOOTUTIL_CAP_IMAGE_MANIFEST;
+#endif
 
     return res;
 }
@@ -0,0 +1,264 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Streaming decompression of LZ4 blocks.
+ *
+ * A block is a sequence of sequences, each made of a token byte, literals and
+ * a match.  The high nibble of the token is the number of literals, the low
+ * nibble the length of the match minus 4; a nibble of 15 is followed by bytes
+ * adding to it, up to the first that is not 255.  The literals follow, then
+ * the distance of the match as a 16-bit little-endian value.  The last
+ * sequence stops after its literals.
+ *
+ * Images are compressed with match distances of at most
+ * BOOT_DECOMP_WINDOW_SZ bytes, so the decompressor only keeps that much of
+ * the output.  Input can be fed in chunks of any size.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bootutil/bootutil.h"
+#include "bootutil_priv.h"
+
+#include "mcuboot_config/mcuboot_config.h"
+
+#ifdef MCUBOOT_COMPRESSED_IMAGES
+
+#define BOOT_DECOMP_TOKEN       0
+#define BOOT_DECOMP_LIT_LEN     1
+#define BOOT_DECOMP_LITERALS    2
+#define BOOT_DECOMP_DIST_LO     3
+#define BOOT_DECOMP_DIST_HI     4
+#define BOOT_DECOMP_MATCH_LEN   5
+#define BOOT_DECOMP_ERROR       6
+
+#define BOOT_DECOMP_MIN_MATCH   4
+
+void
+boot_decomp_init(struct boot_decomp *d, const struct flash_area *fap,
+                 uint32_t off, uint32_t max_sz)
+{
+    d->fap = fap;
+    d->off = off;
+    d->max_sz = max_sz;
+    d->out_sz = 0;
+    d->flushed_sz = 0;
+    d->len = 0;
+    d->dist = 0;
+    d->token = 0;
+    d->state = BOOT_DECOMP_TOKEN;
+    bootutil_sha256_init(&d->sha256_ctx);
+}
+
+/*
+ * Hashes and writes the part of the window that was not yet, padding it to
+ * the write alignment.
+ */
+static int
+boot_decomp_flush(struct boot_decomp *d)
+{
+    uint32_t sz;
+    uint32_t write_sz;
+    uint8_t align;
+
+    sz = d->out_sz - d->flushed_sz;
+    if (sz == 0) {
+        return 0;
+    }
+
+    bootutil_sha256_update(&d->sha256_ctx, d->window, sz);
+
+    align = flash_area_align(d->fap);
+    write_sz = (sz + align - 1) & ~(align - 1);
+    memset(&d->window[sz], flash_area_erased_val(d->fap), write_sz - sz);
+    if (flash_area_write(d->fap, d->off + d->flushed_sz, d->window,
+                         write_sz) != 0) {
+        return -1;
+    }
+
+    d->flushed_sz = d->out_sz;
+
+    return 0;
+}
+
+/*
+ * Appends bytes to the output.  The window is flushed whenever it is full,
+ * so the output always starts at the beginning of the window.
+ */
+static int
+boot_decomp_put(struct boot_decomp *d, const uint8_t *buf, uint32_t len)
+{
+    uint32_t pos;
+    uint32_t sz;
+
+    if (len > d->max_sz - d->out_sz) {
+        return -1;
+    }
+
+    while (len > 0) {
+        pos = d->out_sz - d->flushed_sz;
+        sz = BOOT_DECOMP_WINDOW_SZ - pos;
+        if (sz > len) {
+            sz = len;
+        }
+
+        memcpy(&d->window[pos], buf, sz);
+        d->out_sz += sz;
+        buf += sz;
+        len -= sz;
+
+        if (d->out_sz - d->flushed_sz == BOOT_DECOMP_WINDOW_SZ &&
+            boot_decomp_flush(d) != 0) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Appends the d->len bytes found d->dist bytes back in the output, which
+ * may overlap the bytes being produced.
+ */
+static int
+boot_decomp_match(struct boot_decomp *d)
+{
+    uint8_t byte;
+
+    if (d->dist == 0 || d->dist > BOOT_DECOMP_WINDOW_SZ ||
+        d->dist > d->out_sz) {
+        return -1;
+    }
+
+    while (d->len > 0) {
+        byte = d->window[(d->out_sz - d->dist) % BOOT_DECOMP_WINDOW_SZ];
+        if (boot_decomp_put(d, &byte, 1) != 0) {
+            return -1;
+        }
+        d->len--;
+    }
+
+    return 0;
+}
+
+int
+boot_decomp_update(struct boot_decomp *d, const uint8_t *buf, uint32_t len)
+{
+    uint32_t sz;
+    uint8_t byte;
+
+    while (len > 0 && d->state != BOOT_DECOMP_ERROR) {
+        if (d->state == BOOT_DECOMP_LITERALS) {
+            sz = d->len;
+            if (sz > len) {
+                sz = len;
+            }
+            if (boot_decomp_put(d, buf, sz) != 0) {
+                d->state = BOOT_DECOMP_ERROR;
+                break;
+            }
+            buf += sz;
+            len -= sz;
+            d->len -= sz;
+            if (d->len == 0) {
+                d->state = BOOT_DECOMP_DIST_LO;
+            }
+            continue;
+        }
+
+        byte = *buf++;
+        len--;
+
+        switch (d->state) {
+        case BOOT_DECOMP_TOKEN:
+            d->token = byte;
+            d->len = byte >> 4;
+            if (d->len == 15) {
+                d->state = BOOT_DECOMP_LIT_LEN;
+            } else if (d->len > 0) {
+                d->state = BOOT_DECOMP_LITERALS;
+            } else {
+                d->state = BOOT_DECOMP_DIST_LO;
+            }
+            break;
+
+        case BOOT_DECOMP_LIT_LEN:
+            d->len += byte;
+            if (d->len > d->max_sz) {
+                d->state = BOOT_DECOMP_ERROR;
+            } else if (byte != 255) {
+                d->state = BOOT_DECOMP_LITERALS;
+            }
+            break;
+
+        case BOOT_DECOMP_DIST_LO:
+            d->dist = byte;
+            d->state = BOOT_DECOMP_DIST_HI;
+            break;
+
+        case BOOT_DECOMP_DIST_HI:
+            d->dist |= (uint16_t)byte << 8;
+            d->len = d->token & 0xf;
+            if (d->len == 15) {
+                d->state = BOOT_DECOMP_MATCH_LEN;
+                break;
+            }
+            d->len += BOOT_DECOMP_MIN_MATCH;
+            d->state = boot_decomp_match(d) == 0 ? BOOT_DECOMP_TOKEN :
+                                                   BOOT_DECOMP_ERROR;
+            break;
+
+        case BOOT_DECOMP_MATCH_LEN:
+            d->len += byte;
+            if (d->len > d->max_sz) {
+                d->state = BOOT_DECOMP_ERROR;
+            } else if (byte != 255) {
+                d->len += BOOT_DECOMP_MIN_MATCH;
+                d->state = boot_decomp_match(d) == 0 ? BOOT_DECOMP_TOKEN :
+                                                       BOOT_DECOMP_ERROR;
+            }
+            break;
+
+        default:
+            d->state = BOOT_DECOMP_ERROR;
+            break;
+        }
+    }
+
+    return d->state == BOOT_DECOMP_ERROR ? -1 : 0;
+}
+
+int
+boot_decomp_finish(struct boot_decomp *d, uint8_t *hash)
+{
+    /* A block ends with the literals of its last sequence. */
+    if (d->state != BOOT_DECOMP_DIST_LO) {
+        return -1;
+    }
+
+    if (boot_decomp_flush(d) != 0) {
+        return -1;
+    }
+
+    bootutil_sha256_finish(&d->sha256_ctx, hash);
+
+    return 0;
+}
+
+#endif /* MCUBOOT_COMPRESSED_IMAGES */
@@ -0,0 +1,1096 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * ECDSA P-256 verification with precomputed multiples of the generator and
+ * of the public key.
+ *
+ * u1 * G + u2 * Q is computed with the comb method: each scalar is split in
+ * W rows of D = ceil(256 / W) bits, and the bits of a column of the rows
+ * index a table of the 2^W - 1 sums of the 2^(j * D) multiples of the point.
+ * This takes D doublings and at most 2 * D additions, where the double-scalar
+ * multiplication of tinycrypt takes 256 doublings and up to 256 additions.
+ *
+ * The tables are generated by scripts/imgtool/ec256_table.py; imgtool getpub
+ * emits the one of a public key with --ec256-table-width.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "mcuboot_config/mcuboot_config.h"
+
+#if defined(MCUBOOT_SIGN_EC256) && defined(MCUBOOT_EC256_FIXED_BASE)
+
+#include "tinycrypt/ecc.h"
+
+#include "bootutil_priv.h"
+
+#define EC256_TABLE_HDR_SZ  4
+#define EC256_POINT_SZ      (2 * NUM_ECC_BYTES)
+#define EC256_COMB_COLS     \
+    ((256 + MCUBOOT_EC256_FIXED_BASE_WIDTH - 1) / MCUBOOT_EC256_FIXED_BASE_WIDTH)
+
+/* Table of the generator, see ec256_table.py. */
+#if MCUBOOT_EC256_FIXED_BASE_WIDTH == 4
+static const uint8_t ec256_g_table[] = {
+    0x04, 0x00, 0x00, 0x00, 0x6b, 0x17, 0xd1, 0xf2,
+    0xe1, 0x2c, 0x42, 0x47, 0xf8, 0xbc, 0xe6, 0xe5,
+    0x63, 0xa4, 0x40, 0xf2, 0x77, 0x03, 0x7d, 0x81,
+    0x2d, 0xeb, 0x33, 0xa0, 0xf4, 0xa1, 0x39, 0x45,
+    0xd8, 0x98, 0xc2, 0x96, 0x4f, 0xe3, 0x42, 0xe2,
+    0xfe, 0x1a, 0x7f, 0x9b, 0x8e, 0xe7, 0xeb, 0x4a,
+    0x7c, 0x0f, 0x9e, 0x16, 0x2b, 0xce, 0x33, 0x57,
+    0x6b, 0x31, 0x5e, 0xce, 0xcb, 0xb6, 0x40, 0x68,
+    0x37, 0xbf, 0x51, 0xf5, 0x0f, 0xa8, 0x22, 0xbc,
+    0x28, 0x11, 0xaa, 0xa5, 0x84, 0x92, 0x59, 0x2e,
+    0x32, 0x6e, 0x25, 0xde, 0x29, 0x49, 0x3b, 0xaa,
+    0xad, 0x65, 0x1f, 0x7e, 0x90, 0xe7, 0x5c, 0xb4,
+    0x8e, 0x14, 0xdb, 0x63, 0xbf, 0xf4, 0x4a, 0xe8,
+    0xf5, 0xdb, 0xa8, 0x0d, 0x6f, 0x4a, 0xd4, 0xbc,
+    0xb3, 0xdf, 0x18, 0x8b, 0x34, 0xb1, 0xa6, 0x50,
+    0x50, 0xfe, 0x82, 0xf5, 0xe4, 0x11, 0x24, 0x54,
+    0x5f, 0x46, 0x2e, 0xe7, 0x30, 0x0a, 0x4b, 0xbc,
+    0x89, 0xd6, 0x72, 0x6f, 0xb2, 0x57, 0xc0, 0xde,
+    0x95, 0xe0, 0x27, 0x89, 0xe9, 0x6c, 0x98, 0xfd,
+    0x0d, 0x35, 0xf1, 0xfa, 0x93, 0x39, 0x1c, 0xe2,
+    0x09, 0x79, 0x92, 0xaf, 0x72, 0xaa, 0xc7, 0xe0,
+    0xd0, 0x9b, 0x46, 0x44, 0x7f, 0x1d, 0xdb, 0x25,
+    0xff, 0x1e, 0x3c, 0x6f, 0x5b, 0xb1, 0xee, 0xad,
+    0xa9, 0xd8, 0x06, 0xa5, 0xaa, 0x54, 0xa2, 0x91,
+    0xc0, 0x81, 0x27, 0xa0, 0x44, 0x7d, 0x73, 0x9b,
+    0xee, 0xdb, 0x5e, 0x67, 0xfb, 0x98, 0x2f, 0xd5,
+    0x88, 0xc6, 0x76, 0x6e, 0xfc, 0x35, 0xff, 0x7d,
+    0xc2, 0x97, 0xea, 0xc3, 0x57, 0xc8, 0x4f, 0xc9,
+    0xd7, 0x89, 0xbd, 0x85, 0x2d, 0x48, 0x25, 0xab,
+    0x83, 0x41, 0x31, 0xee, 0xe1, 0x2e, 0x9d, 0x95,
+    0x3a, 0x4a, 0xaf, 0xf7, 0x3d, 0x34, 0x9b, 0x95,
+    0xa7, 0xfa, 0xe5, 0x00, 0x0c, 0x7e, 0x33, 0xc9,
+    0x72, 0xe2, 0x5b, 0x32, 0xef, 0x95, 0x19, 0x32,
+    0x8a, 0x9c, 0x72, 0xff, 0xdd, 0xc6, 0x06, 0x8b,
+    0xb9, 0x1d, 0xfc, 0x60, 0xef, 0x7f, 0xbd, 0x2b,
+    0x1a, 0x0a, 0x11, 0xb7, 0x13, 0x94, 0x9c, 0x93,
+    0x2a, 0x1d, 0x36, 0x7f, 0x61, 0x1e, 0x9f, 0xc3,
+    0x7d, 0xbb, 0x2c, 0x9b, 0xc1, 0xee, 0x98, 0x07,
+    0x02, 0x2c, 0x21, 0x9c, 0x23, 0x18, 0x3b, 0x08,
+    0x95, 0xca, 0x17, 0x40, 0x19, 0x60, 0x35, 0xa7,
+    0x73, 0x76, 0xd8, 0xa8, 0x55, 0x06, 0x63, 0x79,
+    0x7b, 0x51, 0xf5, 0xd8, 0x7d, 0xea, 0x64, 0x82,
+    0xe1, 0x12, 0x38, 0xbf, 0x29, 0x36, 0xdf, 0x5e,
+    0xc6, 0xc9, 0xbc, 0x36, 0xca, 0xe2, 0xb1, 0x92,
+    0x0b, 0x57, 0xf4, 0xbc, 0x15, 0x71, 0x64, 0x84,
+    0x8a, 0xec, 0xb8, 0x51, 0x0a, 0xfa, 0x40, 0x01,
+    0x8d, 0x9d, 0x50, 0xe5, 0x9f, 0xb3, 0xd5, 0x76,
+    0xdb, 0xde, 0xfb, 0xe1, 0x44, 0xff, 0xe2, 0x16,
+    0x34, 0x8a, 0x96, 0x4c, 0xeb, 0x5d, 0x77, 0x45,
+    0xb2, 0x11, 0x41, 0xea, 0xa2, 0xe8, 0xf4, 0x83,
+    0xf4, 0x3e, 0x43, 0x91, 0x7c, 0xcd, 0x84, 0xe7,
+    0x0d, 0x71, 0x5f, 0x26, 0xe4, 0x8e, 0xca, 0xff,
+    0xfc, 0x5c, 0xde, 0x01, 0xea, 0xfd, 0x72, 0xeb,
+    0xdb, 0xec, 0xc1, 0x7b, 0x09, 0x90, 0xe6, 0xa1,
+    0x58, 0x00, 0x6c, 0xee, 0x85, 0xf2, 0x2c, 0xfe,
+    0x28, 0x44, 0xb6, 0x45, 0xca, 0xc9, 0x17, 0xe2,
+    0x73, 0x1a, 0x34, 0x79, 0xa6, 0xd3, 0x96, 0x77,
+    0xa7, 0x84, 0x92, 0x76, 0x27, 0x36, 0xff, 0x83,
+    0x44, 0x31, 0x5f, 0xc5, 0x96, 0x43, 0x95, 0x91,
+    0xa3, 0xc6, 0xb9, 0x4a, 0x6c, 0xf2, 0x0f, 0xfb,
+    0x31, 0x37, 0x28, 0xbe, 0x67, 0x4f, 0x84, 0x74,
+    0x9b, 0x0b, 0x88, 0x16, 0x66, 0xb8, 0xba, 0xbd,
+    0x2d, 0x27, 0xec, 0xdf, 0x82, 0x4a, 0x92, 0x0c,
+    0x22, 0x84, 0x05, 0x9b, 0xf2, 0xba, 0xb8, 0x33,
+    0xc3, 0x57, 0xf5, 0xf4, 0x4e, 0x76, 0x9e, 0x76,
+    0x72, 0xc9, 0xdd, 0xad, 0x31, 0x85, 0x5f, 0x7d,
+    0xb8, 0xc7, 0xfe, 0xdb, 0x74, 0xe0, 0x2f, 0x08,
+    0x02, 0x03, 0xa5, 0x6b, 0x2d, 0xf4, 0x8c, 0x04,
+    0x67, 0x7c, 0x8a, 0x3e, 0x42, 0xb9, 0x90, 0x82,
+    0xde, 0x83, 0x06, 0x63, 0x1e, 0xc0, 0x05, 0x72,
+    0x06, 0x94, 0x72, 0x81, 0xfb, 0x9a, 0xe1, 0x6f,
+    0x3b, 0x91, 0x22, 0xa5, 0xa4, 0xc3, 0x61, 0x65,
+    0xb8, 0x24, 0xbb, 0xb0, 0x78, 0x87, 0x8e, 0xf6,
+    0x1c, 0x6c, 0xe0, 0x4d, 0x7f, 0xdc, 0x1c, 0xa0,
+    0x08, 0xa1, 0xc4, 0x78, 0xd1, 0xf8, 0x9e, 0x79,
+    0x9c, 0x0c, 0xe1, 0x31, 0x6e, 0xf9, 0x51, 0x50,
+    0xdd, 0xa8, 0x68, 0xb9, 0xb6, 0xcb, 0x3f, 0x5d,
+    0x7b, 0x72, 0xc3, 0x21, 0xde, 0x53, 0x14, 0x2c,
+    0x12, 0x30, 0x9d, 0xef, 0x6a, 0xce, 0x57, 0x0e,
+    0xbd, 0xe0, 0x8d, 0x4f, 0x9c, 0x62, 0xb9, 0x12,
+    0x1f, 0xe0, 0xd9, 0x76, 0x0c, 0x88, 0xbc, 0x4d,
+    0x71, 0x6b, 0x12, 0x87, 0x59, 0x5c, 0x52, 0x20,
+    0x81, 0x2f, 0xfc, 0xae, 0x5b, 0x82, 0xdd, 0x5b,
+    0xd5, 0x4f, 0xb4, 0x96, 0x7f, 0x99, 0x1e, 0xd2,
+    0xc3, 0x1a, 0x35, 0x73, 0xdd, 0x5d, 0xde, 0xa3,
+    0xf3, 0x90, 0x1d, 0xc6, 0x18, 0xd1, 0xb5, 0xb3,
+    0x9c, 0x04, 0xe6, 0xaa, 0x7c, 0x81, 0x81, 0xf4,
+    0xdf, 0x25, 0x64, 0xf3, 0x3a, 0x57, 0xbf, 0x63,
+    0x5f, 0x48, 0xac, 0xa8, 0x68, 0xf3, 0x44, 0xaf,
+    0x6b, 0x31, 0x74, 0x66, 0xef, 0xe0, 0xa4, 0x23,
+    0x08, 0x3e, 0x49, 0xf3, 0x43, 0xa0, 0xa2, 0x8c,
+    0x42, 0xba, 0x79, 0x2f, 0xe9, 0x6a, 0x79, 0xfb,
+    0x3e, 0x72, 0xad, 0x0c, 0x31, 0xb9, 0xc4, 0x05,
+    0xf8, 0x54, 0x0a, 0x20, 0x60, 0x4e, 0xd9, 0x3c,
+    0x24, 0xd6, 0x7f, 0xf3, 0x66, 0x8b, 0xfc, 0x22,
+    0x71, 0xf5, 0xc6, 0x26, 0xcd, 0xfe, 0x17, 0xdb,
+    0x3f, 0xb2, 0x4d, 0x4a, 0x40, 0x52, 0xbf, 0x4b,
+    0x6f, 0x46, 0x1d, 0xb9, 0x66, 0x3c, 0x62, 0xc3,
+    0xed, 0xba, 0xd7, 0xa0, 0x0d, 0x1a, 0x10, 0x14,
+    0x4e, 0xc3, 0x9c, 0x28, 0xd3, 0x6b, 0x47, 0x89,
+    0xa2, 0x58, 0x2e, 0x7f, 0xfe, 0xcf, 0x4d, 0x51,
+    0x90, 0xb0, 0xfc, 0x61, 0x86, 0x2b, 0xe6, 0xbd,
+    0x71, 0xd7, 0x0c, 0xc8, 0xe7, 0x24, 0xf3, 0x39,
+    0x99, 0xbf, 0xcc, 0x5b, 0x23, 0x5a, 0x27, 0xc3,
+    0x18, 0x8d, 0x25, 0xeb, 0x1e, 0xdd, 0xba, 0xe2,
+    0xc8, 0x02, 0xe4, 0x1a, 0x12, 0x32, 0x02, 0xa8,
+    0xf6, 0x2b, 0xff, 0x7a, 0xaf, 0xdf, 0x5c, 0xc0,
+    0x85, 0x26, 0xa7, 0xa4, 0x74, 0x34, 0x6c, 0x10,
+    0xa1, 0xd4, 0xcf, 0xac, 0x43, 0x10, 0x4d, 0x86,
+    0x56, 0x0e, 0xbc, 0xfc, 0x0c, 0x45, 0xf4, 0x52,
+    0x73, 0xdb, 0x33, 0xa0, 0x36, 0xe0, 0x6b, 0x7e,
+    0x4c, 0x70, 0x19, 0x17, 0x8f, 0xa0, 0xaf, 0x2d,
+    0xd6, 0x03, 0xf8, 0x44, 0xb4, 0x8e, 0x26, 0xb4,
+    0x84, 0xf7, 0xa2, 0x1c, 0x0a, 0x4a, 0x46, 0xfb,
+    0x6a, 0xaf, 0x36, 0x3a, 0x66, 0xb0, 0xde, 0x32,
+    0x25, 0xc4, 0x74, 0x4b, 0x96, 0x15, 0xb5, 0x11,
+    0x0d, 0x1d, 0x78, 0xe5, 0xfa, 0xc0, 0x15, 0x40,
+    0x4d, 0x4d, 0x3d, 0xab, 0x64, 0x13, 0x1b, 0xcd,
+    0xfe, 0xd6, 0xf6, 0x68, 0xc0, 0x04, 0xe4, 0x04,
+    0x8b, 0x7b, 0x0f, 0x98, 0x06, 0xeb, 0xb0, 0xf6,
+    0x21, 0xa0, 0x1b, 0x2d,
+};
+#elif MCUBOOT_EC256_FIXED_BASE_WIDTH == 5
+static const uint8_t ec256_g_table[] = {
+    0x05, 0x00, 0x00, 0x00, 0x6b, 0x17, 0xd1, 0xf2,
+    0xe1, 0x2c, 0x42, 0x47, 0xf8, 0xbc, 0xe6, 0xe5,
+    0x63, 0xa4, 0x40, 0xf2, 0x77, 0x03, 0x7d, 0x81,
+    0x2d, 0xeb, 0x33, 0xa0, 0xf4, 0xa1, 0x39, 0x45,
+    0xd8, 0x98, 0xc2, 0x96, 0x4f, 0xe3, 0x42, 0xe2,
+    0xfe, 0x1a, 0x7f, 0x9b, 0x8e, 0xe7, 0xeb, 0x4a,
+    0x7c, 0x0f, 0x9e, 0x16, 0x2b, 0xce, 0x33, 0x57,
+    0x6b, 0x31, 0x5e, 0xce, 0xcb, 0xb6, 0x40, 0x68,
+    0x37, 0xbf, 0x51, 0xf5, 0x54, 0xcc, 0xc9, 0x41,
+    0x50, 0x26, 0xd7, 0x3f, 0x20, 0xa8, 0x45, 0xb7,
+    0x2a, 0x58, 0xe5, 0xb1, 0x8b, 0xd2, 0x7f, 0x19,
+    0x85, 0x42, 0xa0, 0xbe, 0xee, 0xa6, 0xbc, 0x92,
+    0x07, 0x1e, 0x5c, 0x83, 0x1c, 0x43, 0x3f, 0x45,
+    0xb4, 0x51, 0x45, 0x32, 0x3a, 0x8f, 0x87, 0x15,
+    0xda, 0xd2, 0xbf, 0x22, 0x92, 0x9e, 0x0b, 0xcc,
+    0x5d, 0x8e, 0xe4, 0x96, 0xcf, 0xd0, 0x8e, 0xf7,
+    0x14, 0x09, 0x16, 0xa1, 0x3c, 0xfa, 0x0f, 0x87,
+    0x29, 0x7b, 0xed, 0x02, 0xdf, 0xcc, 0x23, 0x58,
+    0xf9, 0x4c, 0x9d, 0x1d, 0x59, 0x3a, 0x09, 0xa0,
+    0x3a, 0x23, 0xc6, 0xab, 0xf7, 0xd2, 0x4b, 0xb7,
+    0x04, 0xba, 0xc8, 0x70, 0xe4, 0xe3, 0x76, 0x94,
+    0x70, 0xbe, 0x12, 0xc6, 0xa7, 0x58, 0xaa, 0x80,
+    0x83, 0x09, 0xaf, 0x9b, 0x62, 0x12, 0x1c, 0x0d,
+    0x02, 0x48, 0xa8, 0xaf, 0xce, 0x98, 0xa3, 0x0b,
+    0x40, 0xf2, 0x69, 0x40, 0x7e, 0xf2, 0xee, 0x3c,
+    0x5c, 0x79, 0x2a, 0x0c, 0x0f, 0xef, 0x63, 0x35,
+    0x22, 0x4d, 0x94, 0x28, 0xa7, 0xd2, 0xc9, 0x8f,
+    0x67, 0x43, 0x33, 0x3e, 0xc7, 0x39, 0xa5, 0xea,
+    0x3e, 0xcc, 0xa7, 0xe0, 0xaf, 0xb6, 0x86, 0x27,
+    0x30, 0xac, 0xc0, 0x11, 0xa4, 0xf6, 0x7f, 0x51,
+    0xd5, 0xe6, 0x09, 0xdb, 0x81, 0xb2, 0x14, 0x50,
+    0xdf, 0xbd, 0x3d, 0x20, 0x30, 0x2b, 0x22, 0xdd,
+    0x55, 0x2a, 0xc0, 0x94, 0xd6, 0x69, 0x03, 0x37,
+    0x6d, 0xf0, 0xfd, 0x5e, 0x28, 0xfe, 0x9a, 0x4f,
+    0x25, 0x4c, 0x54, 0x91, 0xf6, 0xd7, 0x7c, 0x27,
+    0x08, 0x8b, 0x86, 0xdb, 0xdd, 0x37, 0xe3, 0xff,
+    0x86, 0xef, 0x7d, 0x7d, 0x20, 0xe2, 0xa5, 0x3c,
+    0xe6, 0xd1, 0x3d, 0x22, 0xa1, 0x3e, 0x95, 0x78,
+    0xdf, 0x07, 0x41, 0x67, 0xf3, 0xd1, 0xa7, 0xaf,
+    0x9e, 0x43, 0x73, 0xf9, 0x9f, 0xf0, 0x49, 0x92,
+    0xad, 0xda, 0xd5, 0x96, 0xb6, 0x66, 0xfa, 0xc5,
+    0xb7, 0x7e, 0x46, 0xe9, 0x27, 0x62, 0x03, 0xc2,
+    0x12, 0xf0, 0x1e, 0x9e, 0xa4, 0x24, 0xec, 0x2d,
+    0xbe, 0x3c, 0x72, 0x65, 0xd7, 0xb8, 0x6a, 0xee,
+    0xb0, 0x87, 0x96, 0x05, 0x38, 0xaa, 0xa3, 0x80,
+    0x90, 0x24, 0x69, 0x04, 0xeb, 0x5a, 0xbc, 0x19,
+    0xee, 0x3d, 0xe5, 0xa9, 0xef, 0x46, 0xa4, 0x4a,
+    0x72, 0x6c, 0xd8, 0xb6, 0xf4, 0x31, 0xbb, 0x1a,
+    0x3b, 0xf0, 0xc5, 0x2d, 0x62, 0x1c, 0x75, 0xd1,
+    0x02, 0xea, 0xdb, 0x2e, 0xdb, 0x82, 0xb3, 0xea,
+    0x54, 0x49, 0x20, 0xa4, 0xc3, 0x02, 0xf8, 0xf4,
+    0x96, 0xbe, 0xa2, 0x5a, 0xae, 0xbf, 0xd7, 0x35,
+    0x52, 0x5d, 0x6a, 0xbf, 0xd7, 0xc4, 0xa4, 0xfe,
+    0xb4, 0xfa, 0x64, 0x9d, 0x4f, 0xda, 0xc9, 0x6f,
+    0x52, 0x2d, 0x7f, 0x70, 0x22, 0x5d, 0x03, 0xd8,
+    0x57, 0xc4, 0x6d, 0x63, 0x89, 0x39, 0xdc, 0x4c,
+    0x9e, 0xf4, 0x85, 0xf0, 0x0d, 0x2b, 0xf2, 0x8b,
+    0xa7, 0xc2, 0xa5, 0x1a, 0x90, 0xf5, 0x73, 0xa8,
+    0x25, 0x89, 0xf1, 0x8e, 0x07, 0xe5, 0x0a, 0xb0,
+    0x17, 0x86, 0xdf, 0x70, 0x9c, 0x76, 0x2e, 0xf1,
+    0x94, 0x3e, 0x83, 0x2a, 0x0c, 0xac, 0x3f, 0x43,
+    0x13, 0xbd, 0x00, 0xac, 0x70, 0x87, 0xa1, 0x0a,
+    0x94, 0xb4, 0xe7, 0xed, 0x27, 0xec, 0x9d, 0xb9,
+    0x60, 0x55, 0x14, 0x46, 0x48, 0x26, 0x3a, 0xf1,
+    0x5b, 0x20, 0xd3, 0x7c, 0x00, 0xdc, 0x46, 0xe7,
+    0xc9, 0x9a, 0x73, 0x9d, 0x9f, 0x05, 0xf9, 0x4a,
+    0x8c, 0x26, 0x7d, 0x88, 0xf7, 0x65, 0x99, 0x58,
+    0xed, 0xd9, 0x58, 0x3f, 0x8b, 0xc6, 0x59, 0xaa,
+    0xc0, 0xb9, 0x37, 0x2a, 0x03, 0x12, 0xa5, 0x57,
+    0x45, 0x79, 0x34, 0x24, 0x40, 0xd1, 0xe3, 0xab,
+    0x52, 0x28, 0xc1, 0x11, 0xb5, 0xeb, 0x20, 0x2d,
+    0x81, 0x56, 0xbf, 0x6a, 0x4a, 0xf5, 0x0a, 0x00,
+    0xdf, 0x55, 0xd0, 0xf2, 0x3c, 0x51, 0x0c, 0xe2,
+    0x88, 0x2a, 0x78, 0x92, 0x86, 0x7c, 0x55, 0x80,
+    0x08, 0xdc, 0xd7, 0xab, 0xc8, 0xa8, 0x20, 0xbd,
+    0x1c, 0x75, 0x22, 0xc0, 0x9d, 0x90, 0xcd, 0xa8,
+    0x9e, 0x64, 0x86, 0xe0, 0xd3, 0x5e, 0x62, 0x0f,
+    0x5a, 0xcf, 0x05, 0x3f, 0xc3, 0xa7, 0xfc, 0x08,
+    0x5b, 0xa9, 0x97, 0xb0, 0x33, 0x39, 0x27, 0x76,
+    0xed, 0xa4, 0xe0, 0x46, 0x0e, 0x28, 0x33, 0x34,
+    0x64, 0x6d, 0x54, 0xc6, 0x3c, 0x53, 0xe2, 0x90,
+    0x15, 0xb0, 0xa1, 0xe5, 0x76, 0x34, 0x7a, 0x52,
+    0x84, 0xe3, 0x2e, 0x59, 0x05, 0xe3, 0xf2, 0x23,
+    0x0d, 0x8c, 0x01, 0x3d, 0x8d, 0x96, 0x92, 0xf7,
+    0x7e, 0xb8, 0xcf, 0xee, 0xd3, 0x0e, 0x7c, 0xda,
+    0x14, 0x0e, 0xfe, 0xb3, 0x11, 0xa9, 0xf0, 0x72,
+    0x9a, 0x08, 0x69, 0x3f, 0x1b, 0x9f, 0x1b, 0xd1,
+    0x00, 0xd2, 0x35, 0x91, 0x53, 0x8b, 0x7d, 0xa5,
+    0xfa, 0xe7, 0x98, 0xd4, 0x02, 0xfd, 0x7b, 0x73,
+    0x29, 0xc2, 0x02, 0x4d, 0x39, 0xf9, 0xff, 0x69,
+    0xb9, 0x6b, 0x99, 0x11, 0xbf, 0xed, 0x14, 0xfe,
+    0xda, 0xd2, 0x10, 0xd5, 0x81, 0xde, 0xc9, 0x26,
+    0x4d, 0xd6, 0xc0, 0x04, 0x42, 0xeb, 0xd3, 0xcb,
+    0x59, 0x92, 0x7d, 0xf3, 0x00, 0xf3, 0x4a, 0xdd,
+    0xc7, 0x79, 0x78, 0x31, 0xb6, 0x82, 0xb9, 0x99,
+    0x0c, 0x23, 0x63, 0x11, 0x50, 0xcf, 0xce, 0xb8,
+    0x71, 0x5d, 0x29, 0xfc, 0xed, 0x84, 0xbb, 0x42,
+    0x5f, 0xe3, 0x9a, 0xad, 0xfd, 0x42, 0x6d, 0x94,
+    0x2d, 0xf2, 0x32, 0xcf, 0x13, 0xd7, 0x2b, 0x7a,
+    0x3f, 0x7f, 0xbe, 0x90, 0x6d, 0xfc, 0xf7, 0x87,
+    0xf8, 0xe8, 0xf6, 0x83, 0xa3, 0x23, 0x34, 0x55,
+    0x58, 0x3c, 0x33, 0xf2, 0x0c, 0xf8, 0x3b, 0x61,
+    0x97, 0xa1, 0xd7, 0x03, 0x67, 0xdd, 0x0a, 0x8e,
+    0x35, 0x54, 0x30, 0xe3, 0x02, 0x3e, 0x67, 0xa1,
+    0x73, 0x29, 0x95, 0xfc, 0x9e, 0x98, 0x89, 0xbc,
+    0xd4, 0x49, 0x24, 0x2d, 0x67, 0x45, 0xff, 0x87,
+    0x70, 0x09, 0xb9, 0x58, 0xfb, 0x50, 0x08, 0x82,
+    0x00, 0xcf, 0xa6, 0x17, 0x27, 0x01, 0x4a, 0xb4,
+    0x68, 0x14, 0x29, 0x04, 0xd9, 0xba, 0x5b, 0x68,
+    0x7e, 0x79, 0xb3, 0xa2, 0x94, 0xc0, 0xd2, 0x4b,
+    0x29, 0x2e, 0x6a, 0xa0, 0x00, 0x85, 0x51, 0x56,
+    0x13, 0x8e, 0x99, 0xe2, 0x03, 0x5b, 0x61, 0x3b,
+    0x57, 0x56, 0x16, 0xc8, 0x95, 0xe1, 0x84, 0x52,
+    0x66, 0x38, 0x2a, 0xda, 0xb3, 0x1d, 0x23, 0x53,
+    0x1b, 0x4d, 0x0d, 0x1f, 0x50, 0xcc, 0x51, 0xc1,
+    0x8a, 0x4e, 0xee, 0x61, 0xce, 0xbb, 0xbc, 0x7b,
+    0x5f, 0x16, 0x5d, 0x99, 0x68, 0xd6, 0x8c, 0x8f,
+    0x6b, 0x0f, 0xb8, 0xf3, 0x3e, 0xaa, 0x82, 0x89,
+    0x1f, 0x4f, 0xa1, 0x2f, 0xa0, 0xa2, 0xa9, 0x6e,
+    0x41, 0x42, 0xff, 0x0f, 0xac, 0xad, 0x4f, 0x81,
+    0x0a, 0x83, 0x9b, 0x5b, 0x55, 0xd5, 0x39, 0x8d,
+    0x16, 0x66, 0x43, 0x2b, 0x55, 0x75, 0x82, 0xc9,
+    0x9a, 0xd5, 0x34, 0x58, 0x01, 0x01, 0xfb, 0x06,
+    0xa0, 0x50, 0xe6, 0x2c, 0x32, 0x0f, 0x09, 0xc3,
+    0x83, 0x9b, 0xb8, 0x5f, 0x57, 0x6e, 0x22, 0x90,
+    0x49, 0xff, 0x8e, 0x2d, 0x05, 0x9c, 0x6a, 0x9e,
+    0x8e, 0xba, 0xa7, 0x2a, 0xd9, 0x0d, 0x6a, 0x7f,
+    0x18, 0x33, 0xd9, 0xe1, 0xf7, 0xf6, 0x31, 0x18,
+    0x4f, 0xed, 0x93, 0x6f, 0x54, 0xe2, 0x44, 0xd5,
+    0x10, 0x1e, 0x5d, 0xe4, 0x9d, 0x3d, 0xc3, 0x34,
+    0x6b, 0xec, 0xcb, 0xb9, 0xe8, 0x0f, 0x26, 0xbd,
+    0x8d, 0x0f, 0x4f, 0x65, 0x93, 0x11, 0xa2, 0x69,
+    0x51, 0xbb, 0xb3, 0xf1, 0xd6, 0xbb, 0xec, 0x0e,
+    0xec, 0x10, 0x6e, 0xb6, 0x19, 0xbd, 0x41, 0x07,
+    0x35, 0xdf, 0x9c, 0x25, 0x43, 0x34, 0xfb, 0xc0,
+    0x58, 0xc2, 0xe3, 0xb7, 0xb3, 0xad, 0x4c, 0x6e,
+    0xf1, 0xb1, 0x9e, 0x28, 0x44, 0x37, 0x37, 0xcd,
+    0x3c, 0x00, 0x73, 0x6b, 0xf1, 0xc0, 0x5d, 0x98,
+    0x4a, 0x8c, 0xb4, 0x6e, 0x12, 0x83, 0x9b, 0x95,
+    0xf1, 0x79, 0x32, 0x7b, 0x78, 0x82, 0x51, 0xc7,
+    0xe5, 0x04, 0x6d, 0xc5, 0x83, 0x71, 0x9d, 0xd7,
+    0xe6, 0xfe, 0x7a, 0xf5, 0xc5, 0x6e, 0xb8, 0x0a,
+    0xf4, 0x2c, 0x23, 0xe8, 0x79, 0x74, 0x89, 0xde,
+    0x08, 0x17, 0xbd, 0xd9, 0xa7, 0x60, 0xa4, 0x56,
+    0x12, 0xcd, 0x8f, 0xe5, 0xee, 0x08, 0x16, 0xa3,
+    0xd4, 0xd0, 0x21, 0xb6, 0x10, 0xb3, 0x7e, 0xcd,
+    0x77, 0x1e, 0x46, 0x88, 0xae, 0xa3, 0xc9, 0xe0,
+    0xb9, 0xb5, 0x29, 0x0b, 0xe8, 0x88, 0x1a, 0x83,
+    0x3f, 0xef, 0xcf, 0xc8, 0xc4, 0xa4, 0x38, 0xe3,
+    0xad, 0x90, 0x06, 0xe1, 0x3a, 0x5f, 0xdf, 0x82,
+    0xdb, 0x49, 0x01, 0x9f, 0x48, 0x91, 0x5d, 0xcf,
+    0xc1, 0x05, 0xf2, 0xd1, 0x8e, 0x99, 0x29, 0xbf,
+    0xb3, 0xa8, 0xca, 0xa1, 0xdb, 0x96, 0xbb, 0x0c,
+    0x78, 0x53, 0xa9, 0x37, 0x30, 0x1b, 0xa1, 0xb2,
+    0x32, 0xac, 0xf1, 0x05, 0xd7, 0x42, 0x0c, 0x18,
+    0xd9, 0x1e, 0xcb, 0x2e, 0x5d, 0xb9, 0x62, 0x0f,
+    0x87, 0xde, 0x4b, 0x29, 0xb3, 0x25, 0x07, 0x4e,
+    0x7a, 0x13, 0x22, 0x2c, 0x3f, 0xbe, 0xe4, 0xd3,
+    0xb9, 0xda, 0x17, 0x17, 0xab, 0x80, 0xce, 0xf0,
+    0x64, 0x85, 0x2a, 0x1d, 0xd8, 0x4b, 0xfe, 0xf6,
+    0xc3, 0x59, 0xac, 0x34, 0x86, 0x99, 0xdd, 0x31,
+    0xe0, 0x9c, 0xb9, 0xf0, 0x55, 0x27, 0x88, 0xac,
+    0xcb, 0xd2, 0x1e, 0x33, 0xca, 0x9f, 0x7a, 0x1d,
+    0xae, 0xd0, 0x35, 0xbe, 0x5d, 0x6d, 0xc5, 0x03,
+    0xe8, 0x3a, 0xd2, 0xc9, 0x16, 0xe6, 0x54, 0x84,
+    0xe9, 0x28, 0x59, 0xb7, 0x24, 0x19, 0x99, 0x08,
+    0xc7, 0x2c, 0x78, 0xc1, 0x4c, 0xb2, 0x0e, 0x96,
+    0xb8, 0x2a, 0x5a, 0xf9, 0x38, 0x58, 0x41, 0x96,
+    0x32, 0x9b, 0xf9, 0x61, 0xee, 0xc0, 0xb9, 0x75,
+    0x2c, 0xc6, 0x72, 0x14, 0x4a, 0x75, 0x99, 0x82,
+    0x16, 0xc1, 0xda, 0x96, 0x6c, 0x89, 0x71, 0x23,
+    0x00, 0x31, 0xdb, 0xb4, 0x6a, 0x20, 0x1c, 0x4b,
+    0x05, 0x2f, 0xde, 0x29, 0xe0, 0x2a, 0xf7, 0x70,
+    0xf7, 0xf1, 0xd2, 0x83, 0x78, 0x9d, 0x66, 0x4b,
+    0xf9, 0x66, 0xf3, 0x29, 0x36, 0x7f, 0xb6, 0x6a,
+    0x84, 0x39, 0xf6, 0xba, 0xb9, 0x08, 0xb9, 0xf1,
+    0x81, 0x2c, 0x86, 0x4e, 0x18, 0x6c, 0x7f, 0x79,
+    0x3d, 0xf3, 0x24, 0x5e, 0xc9, 0xb9, 0x7d, 0x37,
+    0x4b, 0x60, 0x0b, 0x83, 0x5f, 0x0b, 0x46, 0xd5,
+    0xe9, 0x9d, 0x5c, 0x7c, 0xa2, 0x0a, 0x2c, 0x70,
+    0xdb, 0x30, 0x38, 0xdd, 0x9c, 0x42, 0x8d, 0xb8,
+    0x9a, 0xb5, 0x89, 0x13, 0x81, 0x39, 0xb3, 0x6a,
+    0x8d, 0x2e, 0xa7, 0x97, 0x92, 0x49, 0x89, 0x7f,
+    0x91, 0xe2, 0xd8, 0xed, 0x2a, 0xf7, 0x24, 0x60,
+    0x4f, 0x1c, 0xe5, 0x7f, 0xee, 0x22, 0x80, 0xf4,
+    0x4e, 0x33, 0xa6, 0x5d, 0x7a, 0xfc, 0xcc, 0x8a,
+    0x29, 0x5b, 0x57, 0xd2, 0xdc, 0xba, 0xb6, 0x50,
+    0x1b, 0x6b, 0x97, 0x30, 0xb4, 0xa1, 0x96, 0xfb,
+    0x64, 0x71, 0xaa, 0xa0, 0xce, 0x46, 0xec, 0x91,
+    0xa6, 0xa1, 0xeb, 0x84, 0x0d, 0x59, 0x8f, 0x06,
+    0xed, 0x5f, 0xbb, 0xd2, 0x4e, 0x98, 0xa9, 0x8d,
+    0x82, 0x60, 0x4f, 0x6b, 0xc4, 0x7a, 0x08, 0x03,
+    0x89, 0x0f, 0xcd, 0x12, 0xc6, 0x2e, 0x15, 0x5c,
+    0x58, 0xa5, 0xf2, 0x63, 0x5b, 0xc5, 0x34, 0x1e,
+    0x27, 0x1a, 0x93, 0xf1, 0x5f, 0x72, 0xcc, 0x22,
+    0x59, 0x5e, 0x65, 0x47, 0x1f, 0x1e, 0x4f, 0x3f,
+    0x4b, 0xe6, 0x45, 0x8d, 0xff, 0x9f, 0x23, 0x22,
+    0x18, 0x26, 0x7e, 0x4e, 0xd3, 0x3a, 0x76, 0x57,
+    0xee, 0xaa, 0x4d, 0x04, 0x67, 0xe1, 0xf7, 0xdc,
+    0x7e, 0x36, 0xa6, 0xad, 0x5f, 0x6f, 0x84, 0x5a,
+    0x58, 0xba, 0x7f, 0xf4, 0xa0, 0x31, 0x8a, 0x5f,
+    0x32, 0xf6, 0xe5, 0x14, 0xa0, 0xe8, 0xf0, 0xa7,
+    0x0b, 0xab, 0xa2, 0x9a, 0xc7, 0x87, 0x6f, 0xb6,
+    0x36, 0x96, 0xb4, 0x37, 0xd3, 0x69, 0xf1, 0x1f,
+    0x4a, 0x53, 0x78, 0x9f, 0xf3, 0x20, 0xb8, 0xfc,
+    0xf0, 0xee, 0xbb, 0x3a, 0xfd, 0x08, 0x90, 0x3f,
+    0x09, 0xa3, 0x25, 0xaa, 0x41, 0x8c, 0x50, 0x7c,
+    0x36, 0x2e, 0xeb, 0xb1, 0x5c, 0x4a, 0x43, 0xd1,
+    0x11, 0x77, 0x5a, 0x08, 0x5e, 0x67, 0x7d, 0x0c,
+    0x95, 0x9c, 0x44, 0xfa, 0xa4, 0x48, 0x69, 0x16,
+    0xf4, 0x64, 0x6f, 0x9f, 0x40, 0x30, 0xec, 0xc3,
+    0xbb, 0x90, 0x02, 0xd8, 0xe3, 0x3f, 0x02, 0x55,
+    0xc7, 0x64, 0x4c, 0x1d, 0x44, 0x9f, 0x0c, 0xe6,
+    0x31, 0x00, 0xd3, 0x1e, 0xe3, 0x3d, 0x0b, 0xd5,
+    0x02, 0x99, 0x3a, 0xea, 0x5d, 0x93, 0xa8, 0x6f,
+    0x62, 0x48, 0xf9, 0x1f, 0xe2, 0xe7, 0xd7, 0xd0,
+    0xd8, 0x8b, 0x91, 0x44, 0x8c, 0x56, 0x88, 0x74,
+    0x5a, 0x79, 0x41, 0xe4, 0x90, 0x11, 0x09, 0x1d,
+    0x30, 0x67, 0x79, 0x1f, 0x34, 0xca, 0x92, 0x3b,
+    0xa6, 0xd0, 0xaf, 0xc7, 0x3f, 0xcd, 0x92, 0x5a,
+    0x73, 0xcf, 0x26, 0x78, 0xfb, 0x3a, 0x48, 0xb1,
+    0x5b, 0xad, 0x14, 0xd2, 0xf2, 0xdd, 0xb6, 0x93,
+    0xe8, 0x8c, 0x64, 0x20, 0x77, 0x44, 0x31, 0x6b,
+    0x59, 0x5c, 0x51, 0xf4, 0x34, 0xd3, 0x71, 0x80,
+    0xfc, 0x33, 0x98, 0x00, 0xe4, 0xda, 0x88, 0xe9,
+    0x93, 0xd0, 0xcb, 0x92, 0x2a, 0x84, 0x94, 0x71,
+    0xa5, 0x91, 0xf8, 0x53, 0x68, 0xc0, 0xcd, 0x44,
+    0x31, 0x27, 0x35, 0x4c, 0x52, 0xdf, 0x15, 0x88,
+    0xfd, 0xaa, 0xb2, 0x56, 0xf7, 0xfa, 0x4d, 0x15,
+    0x10, 0x06, 0x2e, 0x80, 0x97, 0xfc, 0x50, 0xde,
+    0xd0, 0xf3, 0xbc, 0x51, 0x60, 0xfe, 0x2a, 0x36,
+    0x26, 0x37, 0x07, 0xba, 0x6d, 0x1e, 0xa3, 0x5d,
+    0x16, 0x39, 0xc6, 0x24, 0x4b, 0x59, 0x25, 0x3a,
+    0xf9, 0xc1, 0x3d, 0xe7, 0xb5, 0x8a, 0x60, 0x71,
+    0xe6, 0x39, 0xec, 0x09, 0xb6, 0xc9, 0x35, 0xfb,
+    0x3f, 0xea, 0xa2, 0x72, 0xc4, 0x29, 0xa1, 0x13,
+    0x02, 0x4c, 0x16, 0x8d, 0xaa, 0x03, 0x07, 0xbf,
+    0x7f, 0xa7, 0x9c, 0x93, 0xe8, 0x5d, 0x78, 0x20,
+    0x01, 0xf1, 0x85, 0xf5, 0xf0, 0x06, 0x4c, 0x12,
+    0x50, 0x72, 0x3f, 0xe2, 0x6d, 0x2d, 0x68, 0xf2,
+    0xfb, 0xfb, 0x89, 0x55, 0x82, 0x5f, 0x01, 0x94,
+    0x8e, 0x83, 0x1d, 0x5b, 0x76, 0xc4, 0xc1, 0x80,
+    0x42, 0x86, 0xfb, 0x42, 0x1a, 0x25, 0x30, 0xb0,
+    0x5a, 0x00, 0x16, 0x9c, 0x2e, 0x75, 0xa2, 0x66,
+    0x5b, 0x69, 0x65, 0x27, 0x43, 0x58, 0x72, 0xfe,
+    0xbc, 0x72, 0x3a, 0x17, 0x61, 0x79, 0x4c, 0x4f,
+    0x24, 0x11, 0x11, 0x50, 0x10, 0x6f, 0x9b, 0xc4,
+    0xce, 0x5b, 0x10, 0x6a, 0xdb, 0xf0, 0xa1, 0x1f,
+    0xef, 0x70, 0x37, 0x39,
+};
+#elif MCUBOOT_EC256_FIXED_BASE_WIDTH == 6
+static const uint8_t ec256_g_table[] = {
+    0x06, 0x00, 0x00, 0x00, 0x6b, 0x17, 0xd1, 0xf2,
+    0xe1, 0x2c, 0x42, 0x47, 0xf8, 0xbc, 0xe6, 0xe5,
+    0x63, 0xa4, 0x40, 0xf2, 0x77, 0x03, 0x7d, 0x81,
+    0x2d, 0xeb, 0x33, 0xa0, 0xf4, 0xa1, 0x39, 0x45,
+    0xd8, 0x98, 0xc2, 0x96, 0x4f, 0xe3, 0x42, 0xe2,
+    0xfe, 0x1a, 0x7f, 0x9b, 0x8e, 0xe7, 0xeb, 0x4a,
+    0x7c, 0x0f, 0x9e, 0x16, 0x2b, 0xce, 0x33, 0x57,
+    0x6b, 0x31, 0x5e, 0xce, 0xcb, 0xb6, 0x40, 0x68,
+    0x37, 0xbf, 0x51, 0xf5, 0x98, 0x7f, 0x25, 0x6d,
+    0x58, 0xcf, 0xf9, 0x37, 0x3b, 0xe7, 0x19, 0x69,
+    0xfc, 0x3a, 0x93, 0x01, 0xe8, 0xf9, 0x25, 0x7a,
+    0xe5, 0x7f, 0xdc, 0x00, 0xcd, 0x01, 0x3f, 0x88,
+    0xb0, 0x49, 0xe7, 0xcd, 0x8e, 0x92, 0x69, 0x56,
+    0x94, 0xec, 0x50, 0x5c, 0xe8, 0x60, 0xeb, 0xd6,
+    0x00, 0x07, 0xe3, 0x9e, 0x47, 0xb4, 0x60, 0x52,
+    0x07, 0xaa, 0xff, 0xdb, 0xb7, 0x25, 0x4b, 0xbc,
+    0x6e, 0xfa, 0x35, 0xd6, 0xef, 0xcc, 0x2c, 0x43,
+    0x6e, 0xd1, 0xb2, 0xaf, 0x2d, 0xf1, 0xc4, 0x1e,
+    0xd2, 0xbc, 0x2f, 0xa6, 0x98, 0xb3, 0xce, 0x2a,
+    0xbf, 0x31, 0x8e, 0xb2, 0x59, 0xdb, 0x16, 0x7c,
+    0x5a, 0x1c, 0x3f, 0xb1, 0xf3, 0x68, 0x4f, 0x9c,
+    0x8d, 0x9f, 0x38, 0x63, 0xa5, 0x38, 0x4a, 0x77,
+    0xed, 0x34, 0xf5, 0x43, 0x46, 0x82, 0x45, 0x33,
+    0x37, 0x34, 0xa5, 0x89, 0x17, 0xfe, 0x07, 0xf1,
+    0x97, 0xb2, 0x55, 0x13, 0x6e, 0xec, 0x95, 0x67,
+    0x0d, 0x54, 0x65, 0x0c, 0xc1, 0x4b, 0x66, 0xdd,
+    0x02, 0x43, 0x68, 0x93, 0xff, 0xdc, 0x67, 0x94,
+    0x2d, 0x66, 0x68, 0x17, 0xfd, 0xc7, 0x3e, 0x83,
+    0xbf, 0x78, 0x0c, 0x2c, 0x14, 0xbb, 0x53, 0x50,
+    0x99, 0x77, 0x32, 0xc2, 0xfc, 0x28, 0x1d, 0xe0,
+    0x65, 0xea, 0x01, 0x05, 0x79, 0xab, 0x66, 0x15,
+    0x3a, 0x07, 0xff, 0x89, 0x08, 0x9e, 0xc1, 0xa1,
+    0xed, 0xbf, 0xcd, 0x32, 0x13, 0xcc, 0xca, 0x34,
+    0x55, 0xfa, 0x62, 0x5c, 0xbf, 0x66, 0x4d, 0x2f,
+    0x09, 0x9c, 0x20, 0x2b, 0x41, 0x0b, 0xec, 0x28,
+    0xca, 0x16, 0x70, 0x99, 0xae, 0xc9, 0x02, 0x64,
+    0x73, 0x18, 0x18, 0x8e, 0x4b, 0x5b, 0xa5, 0xa5,
+    0xaf, 0x46, 0x89, 0x3d, 0xe9, 0x04, 0x46, 0xb1,
+    0xfb, 0x21, 0x6a, 0x5e, 0x6b, 0x64, 0x75, 0x21,
+    0x6c, 0xdb, 0x0d, 0x71, 0xaa, 0x84, 0xc2, 0x31,
+    0x05, 0x42, 0x1c, 0x0c, 0xf8, 0x6a, 0x90, 0x78,
+    0x98, 0x03, 0x30, 0xf5, 0xab, 0x83, 0x9a, 0x14,
+    0xe4, 0xe0, 0x9f, 0xd2, 0xdd, 0xff, 0xc2, 0x22,
+    0xa1, 0x71, 0x7f, 0x8a, 0xac, 0xa2, 0xfa, 0x08,
+    0x48, 0x62, 0xc5, 0xdb, 0x20, 0x34, 0x7d, 0x0c,
+    0x25, 0x68, 0x65, 0x3c, 0xba, 0x26, 0x12, 0xb8,
+    0xff, 0x9a, 0x09, 0x3b, 0xf7, 0x5d, 0xcc, 0xfa,
+    0xea, 0x6e, 0xfd, 0x98, 0x68, 0x90, 0xf2, 0x4c,
+    0xc1, 0xdd, 0x7d, 0xcc, 0x0f, 0x74, 0x34, 0x2a,
+    0x40, 0xe7, 0xe7, 0xe7, 0xb6, 0xe2, 0x87, 0x40,
+    0xbf, 0xe8, 0x0f, 0x8b, 0x55, 0x91, 0xc8, 0xeb,
+    0x30, 0xf6, 0xcd, 0xa4, 0xd3, 0xb2, 0x28, 0x09,
+    0xcb, 0xdb, 0x1c, 0x78, 0x53, 0x1c, 0x0b, 0x00,
+    0xf5, 0xc1, 0xec, 0x07, 0x6f, 0x58, 0xf0, 0x2a,
+    0x9d, 0x99, 0x4e, 0x2e, 0x65, 0xc5, 0xc5, 0x81,
+    0xf5, 0xe1, 0x7b, 0x5e, 0xd2, 0x96, 0x8e, 0x87,
+    0x35, 0x1c, 0x51, 0xf2, 0xa2, 0x63, 0x91, 0x9b,
+    0x49, 0x45, 0xa1, 0xd4, 0x47, 0x50, 0x1f, 0x2a,
+    0x3c, 0x08, 0x04, 0xc3, 0x80, 0x2f, 0x77, 0x9e,
+    0xa7, 0xf6, 0x80, 0x3a, 0xeb, 0x04, 0x21, 0x21,
+    0x1a, 0x6b, 0x66, 0x5e, 0x87, 0x32, 0x00, 0xbd,
+    0x2a, 0xed, 0x20, 0xfc, 0x2e, 0x9d, 0x3c, 0x9d,
+    0xe6, 0x0d, 0x60, 0xc5, 0xac, 0x3f, 0x83, 0xdf,
+    0x4c, 0x00, 0xef, 0xe2, 0x9e, 0xe4, 0x04, 0x00,
+    0x30, 0xbc, 0xdc, 0xfb, 0x27, 0xd6, 0x45, 0x1e,
+    0xc4, 0x02, 0xe0, 0x50, 0xba, 0xa9, 0x28, 0x14,
+    0x88, 0xb4, 0x51, 0x27, 0x0f, 0x50, 0x36, 0x29,
+    0x5a, 0x7e, 0x87, 0x0d, 0x2b, 0x52, 0xc4, 0x7d,
+    0x8b, 0x21, 0xaa, 0x51, 0x2a, 0x58, 0xfa, 0x5e,
+    0x1b, 0xe9, 0xe5, 0x83, 0x5d, 0x91, 0x74, 0x0c,
+    0xcd, 0xee, 0xf5, 0x66, 0xcd, 0xeb, 0x98, 0x29,
+    0x0f, 0x41, 0x50, 0xc7, 0x5c, 0x96, 0xec, 0x14,
+    0x55, 0x67, 0x43, 0x2d, 0x78, 0x5b, 0x7e, 0x91,
+    0x09, 0x90, 0x4e, 0x3f, 0x5c, 0x97, 0x1d, 0xdb,
+    0x14, 0xe2, 0x28, 0x0f, 0x89, 0xbf, 0x52, 0x29,
+    0x24, 0x7f, 0xde, 0x25, 0xd8, 0x14, 0x2d, 0xff,
+    0x57, 0x88, 0xc0, 0xf6, 0x6b, 0x44, 0x05, 0x9d,
+    0xfa, 0x3e, 0xa3, 0x2d, 0x96, 0xb8, 0x4f, 0x57,
+    0xc7, 0x97, 0xbe, 0x30, 0x87, 0x89, 0x44, 0x0e,
+    0x4c, 0xe2, 0x93, 0xdd, 0x44, 0x5e, 0x45, 0x19,
+    0x2e, 0x7e, 0x6f, 0x0b, 0xdc, 0x90, 0xd9, 0x75,
+    0xa2, 0xbd, 0x0e, 0xd8, 0xc0, 0xb9, 0xec, 0xd2,
+    0xe1, 0x04, 0xe9, 0xac, 0x2d, 0x7e, 0xd4, 0x74,
+    0xb8, 0xdd, 0x58, 0x13, 0x73, 0xb7, 0xc5, 0x50,
+    0x21, 0x95, 0xa9, 0x79, 0xc8, 0x7c, 0xe2, 0x32,
+    0x81, 0x53, 0x74, 0xc4, 0x4c, 0xfd, 0x32, 0x77,
+    0xf0, 0x97, 0x7a, 0x30, 0x50, 0xd5, 0x54, 0xbb,
+    0xc0, 0x1d, 0xfd, 0xe8, 0x9f, 0xb5, 0x52, 0x03,
+    0x4d, 0xd6, 0xeb, 0x2e, 0xbd, 0xdc, 0x23, 0xac,
+    0x5c, 0x30, 0x12, 0x77, 0xb9, 0x5f, 0x91, 0xb3,
+    0xf5, 0x52, 0x64, 0x1e, 0x1c, 0x65, 0x05, 0x87,
+    0x08, 0xb4, 0x9b, 0x2f, 0xe4, 0xb5, 0x41, 0xb6,
+    0xcf, 0x9a, 0x3c, 0xa9, 0x7d, 0x0c, 0xa9, 0x42,
+    0x5b, 0x04, 0xf7, 0x61, 0x73, 0xa1, 0xc8, 0xf5,
+    0x4e, 0x48, 0xef, 0xde, 0xc0, 0x03, 0xdc, 0xc3,
+    0x84, 0x50, 0xcf, 0xa2, 0x51, 0x9d, 0x07, 0x00,
+    0x04, 0xda, 0xba, 0x43, 0xaf, 0xb1, 0x8d, 0x2f,
+    0xad, 0x6b, 0x22, 0x5f, 0x11, 0x23, 0x21, 0xeb,
+    0x29, 0xf0, 0x28, 0x78, 0x4f, 0xd3, 0xaf, 0xc9,
+    0x75, 0xda, 0xc5, 0x4c, 0xcb, 0x4d, 0xc3, 0x5b,
+    0x17, 0x03, 0x40, 0x6d, 0x5e, 0xd8, 0x1c, 0x10,
+    0xfc, 0xca, 0x48, 0x77, 0x31, 0xa8, 0xd6, 0x63,
+    0x22, 0x20, 0x8f, 0xfb, 0x96, 0x88, 0x97, 0x55,
+    0xf6, 0xb9, 0x6c, 0x2f, 0xdd, 0xf5, 0x82, 0x73,
+    0xf1, 0x77, 0x6a, 0x67, 0xed, 0x6e, 0x13, 0xe0,
+    0x38, 0x92, 0xdd, 0xc5, 0x10, 0xeb, 0x19, 0x4a,
+    0x01, 0x5a, 0x21, 0x1b, 0x0d, 0x59, 0xb6, 0xae,
+    0x1c, 0x4a, 0xb2, 0x36, 0xff, 0x0e, 0x1f, 0x34,
+    0xe8, 0x34, 0xa3, 0xc4, 0x02, 0xf3, 0x22, 0xe5,
+    0x80, 0xd9, 0xa8, 0xcc, 0xcd, 0xe8, 0xcd, 0x7a,
+    0x61, 0x9c, 0xec, 0xba, 0x6f, 0x0f, 0xbf, 0x44,
+    0x54, 0x40, 0x26, 0xa9, 0xac, 0x88, 0xdf, 0x04,
+    0xfb, 0x3f, 0x67, 0x8d, 0x46, 0x0f, 0xa9, 0xcf,
+    0x23, 0x41, 0xf4, 0x99, 0x2f, 0xb3, 0x20, 0x23,
+    0x65, 0x11, 0xb3, 0x70, 0x89, 0x7e, 0x87, 0xbd,
+    0x42, 0x51, 0xf5, 0xb7, 0x2d, 0xc6, 0x1e, 0x1b,
+    0x33, 0x6a, 0xaf, 0x40, 0x18, 0xd6, 0xf6, 0x3a,
+    0x41, 0x77, 0x5e, 0x62, 0x9d, 0x59, 0x22, 0x6e,
+    0x80, 0x9e, 0x4a, 0x1a, 0x93, 0x7e, 0x12, 0x3f,
+    0x44, 0x15, 0x74, 0x34, 0x03, 0xe6, 0x3b, 0x79,
+    0xcb, 0xaf, 0x01, 0xa7, 0x45, 0xa5, 0x11, 0xc9,
+    0x7f, 0x60, 0x8b, 0xf7, 0x6d, 0xbc, 0x41, 0x89,
+    0xd9, 0x91, 0xec, 0xe6, 0x18, 0xc4, 0x52, 0xb1,
+    0xb4, 0x2a, 0x62, 0x7f, 0x3c, 0xd5, 0xf4, 0xe4,
+    0xa9, 0xaa, 0x52, 0xdf, 0x73, 0xbe, 0x0e, 0xc7,
+    0x73, 0xea, 0x9b, 0x6d, 0x3f, 0xe3, 0x33, 0x7f,
+    0xcb, 0x62, 0x5a, 0xd2, 0x5a, 0x91, 0x9b, 0x27,
+    0xd2, 0x29, 0x55, 0xce, 0x7b, 0x52, 0xbd, 0x12,
+    0x12, 0x5e, 0xc1, 0x6c, 0xdf, 0x6b, 0x47, 0x2f,
+    0xb5, 0x2a, 0xcd, 0x25, 0x19, 0x75, 0xb7, 0x1e,
+    0xcb, 0xe4, 0x90, 0xd2, 0x71, 0xb9, 0xa7, 0xe5,
+    0xd4, 0xec, 0x25, 0x10, 0xc6, 0xe4, 0xb6, 0xd0,
+    0x01, 0x64, 0x76, 0xea, 0xb4, 0x26, 0x39, 0xe1,
+    0xa8, 0x8f, 0xd5, 0x93, 0x3c, 0x9a, 0x13, 0x37,
+    0x1b, 0xb5, 0x11, 0x19, 0xcc, 0xc7, 0xb0, 0xb3,
+    0xb8, 0x7d, 0x39, 0x9e, 0xf1, 0x73, 0x87, 0x16,
+    0x78, 0x40, 0x55, 0xeb, 0xd9, 0x49, 0xca, 0xa2,
+    0x24, 0xce, 0x0e, 0x94, 0xf4, 0xcf, 0x87, 0x97,
+    0x72, 0x09, 0x66, 0x38, 0xaf, 0xcd, 0xd2, 0xca,
+    0xb5, 0x0a, 0x47, 0x33, 0x86, 0xa3, 0x8d, 0x54,
+    0xc2, 0x19, 0xc2, 0x0b, 0x67, 0x3e, 0xd5, 0x00,
+    0x57, 0xdb, 0x92, 0x4d, 0x62, 0x2a, 0xbc, 0x7f,
+    0x8d, 0x54, 0x95, 0x67, 0x00, 0xef, 0x5b, 0xa9,
+    0xc9, 0x84, 0xde, 0x46, 0x67, 0x86, 0x64, 0xae,
+    0x96, 0xf9, 0xae, 0x13, 0xff, 0xcb, 0x7d, 0xdc,
+    0xa5, 0x62, 0x1c, 0x63, 0xf1, 0x1e, 0xb0, 0xa7,
+    0x76, 0x02, 0x2c, 0x38, 0xa1, 0x0f, 0xd0, 0xd9,
+    0x29, 0xfa, 0x0d, 0xf9, 0x41, 0xe9, 0x42, 0x06,
+    0x20, 0xb4, 0xd6, 0x97, 0xd3, 0x98, 0x51, 0x29,
+    0x5a, 0x9c, 0x77, 0x8e, 0x86, 0x2d, 0xe7, 0x5e,
+    0x90, 0x7f, 0x3f, 0x85, 0x8d, 0x9f, 0xc1, 0x02,
+    0xbd, 0x2c, 0x19, 0x9e, 0x24, 0xe3, 0x7b, 0x1b,
+    0x09, 0x27, 0x96, 0x5a, 0x4f, 0xb6, 0xe5, 0x62,
+    0x41, 0xf4, 0x2b, 0xf6, 0xda, 0x24, 0xeb, 0x0b,
+    0x66, 0x4e, 0xc1, 0x9c, 0x05, 0x44, 0xde, 0x81,
+    0xa9, 0x39, 0x44, 0x0a, 0x48, 0xd6, 0x37, 0x48,
+    0xb5, 0x6b, 0xc4, 0x51, 0xa9, 0x23, 0x27, 0x76,
+    0x4d, 0x6d, 0x91, 0xd8, 0x6f, 0x95, 0xf5, 0xf2,
+    0xbc, 0xe2, 0xd4, 0x18, 0xa4, 0x12, 0x39, 0x24,
+    0xd2, 0x5b, 0xd4, 0x1b, 0x21, 0xb2, 0xc8, 0x0e,
+    0x66, 0xbb, 0x5d, 0x6b, 0x57, 0xa4, 0x62, 0x57,
+    0xa8, 0x6a, 0x91, 0x16, 0x0a, 0x89, 0x61, 0x32,
+    0x45, 0x9f, 0x70, 0xb4, 0x03, 0xb7, 0xd5, 0x23,
+    0x8a, 0xfc, 0x69, 0x6a, 0x54, 0x6a, 0x08, 0xe7,
+    0xf1, 0x19, 0xb8, 0xcc, 0x7c, 0x4b, 0x12, 0x7d,
+    0x66, 0x21, 0xec, 0x11, 0x1a, 0x3c, 0x56, 0x52,
+    0x43, 0x78, 0x50, 0xd6, 0xf4, 0xe6, 0x1f, 0x40,
+    0x74, 0x79, 0x5c, 0x6d, 0xfa, 0xa5, 0x6f, 0xef,
+    0xbb, 0x31, 0x4c, 0x65, 0x7c, 0x48, 0xf6, 0x0d,
+    0xfc, 0xd7, 0x98, 0xca, 0xb7, 0xb6, 0x7b, 0x02,
+    0x12, 0x17, 0x33, 0xfa, 0x61, 0xe4, 0x4d, 0xa0,
+    0x1f, 0xf3, 0xbd, 0xdc, 0x6d, 0xd2, 0x5e, 0x26,
+    0xe8, 0x3c, 0xfa, 0x35, 0xa8, 0xa9, 0x47, 0xa8,
+    0xa8, 0x01, 0xe8, 0x6e, 0x15, 0x8b, 0xf2, 0xf6,
+    0x42, 0x6d, 0x15, 0x16, 0x93, 0xb7, 0xf2, 0xfb,
+    0x8c, 0xae, 0x33, 0xbb, 0x24, 0x4d, 0x23, 0x4a,
+    0x09, 0x0f, 0x51, 0x54, 0x15, 0x82, 0x62, 0xfb,
+    0x35, 0xb7, 0xf6, 0x06, 0x77, 0x91, 0xeb, 0x36,
+    0xfe, 0xfa, 0xfb, 0xf5, 0xba, 0xf6, 0x47, 0xe3,
+    0x7d, 0x37, 0xa2, 0xf1, 0xf4, 0x1e, 0x03, 0x07,
+    0x56, 0xc8, 0x81, 0x5e, 0x4c, 0x28, 0x1a, 0xa3,
+    0xc9, 0x8e, 0x62, 0x4a, 0xe5, 0xbe, 0x5e, 0x70,
+    0x3f, 0x85, 0x28, 0x8f, 0x6c, 0x7c, 0xd4, 0xce,
+    0x36, 0x1b, 0x47, 0x80, 0xf6, 0xc3, 0x22, 0x55,
+    0x32, 0xdc, 0xe9, 0xe5, 0x6f, 0xd3, 0xf5, 0x4d,
+    0x5f, 0x2d, 0x64, 0x3b, 0xb5, 0xc0, 0x51, 0x27,
+    0x4f, 0x5a, 0xb5, 0xb7, 0xc7, 0x8b, 0xa2, 0x63,
+    0x37, 0xea, 0x57, 0xa2, 0x9d, 0x7f, 0x74, 0x9e,
+    0x7f, 0xd5, 0x8a, 0xe5, 0x0a, 0x5f, 0xd0, 0x98,
+    0x64, 0xf4, 0x97, 0x98, 0x87, 0xf7, 0x0b, 0xe9,
+    0x82, 0x99, 0x42, 0x1f, 0xc5, 0x2d, 0x1d, 0x24,
+    0x71, 0xb2, 0x89, 0x87, 0x34, 0x28, 0xe3, 0x11,
+    0x21, 0x16, 0xb8, 0xce, 0xbf, 0xc4, 0x99, 0x34,
+    0x4b, 0xbf, 0x5c, 0xf4, 0xee, 0x74, 0x8a, 0x6f,
+    0xe3, 0x6e, 0x7d, 0x64, 0x4b, 0xed, 0xd0, 0x7c,
+    0xb9, 0x60, 0x08, 0xf1, 0x5b, 0x29, 0x11, 0xdd,
+    0x4d, 0x6a, 0x3d, 0xef, 0x27, 0x43, 0xae, 0x8a,
+    0xed, 0x51, 0xaa, 0x40, 0xfa, 0x01, 0xaa, 0x94,
+    0x95, 0x8a, 0x24, 0x8f, 0x22, 0x63, 0x9f, 0x87,
+    0x48, 0x91, 0x99, 0x02, 0x55, 0xc6, 0xf6, 0x2d,
+    0x8e, 0x74, 0x75, 0x0f, 0x8e, 0x4c, 0x7b, 0x10,
+    0xbe, 0x6d, 0x6d, 0xba, 0xa7, 0x20, 0xd4, 0xc6,
+    0xaf, 0x2b, 0xff, 0x4c, 0xc9, 0x73, 0x60, 0x51,
+    0xa7, 0x62, 0xde, 0xb7, 0x75, 0xea, 0x69, 0xcb,
+    0xe7, 0x6c, 0xcb, 0xc0, 0xb5, 0xb0, 0x9c, 0xf6,
+    0x71, 0x7a, 0x53, 0x40, 0xd3, 0x21, 0xc5, 0xa6,
+    0x26, 0x85, 0xf0, 0x18, 0x83, 0x4c, 0xbf, 0x1f,
+    0xa1, 0xfe, 0x85, 0xec, 0xaf, 0x5c, 0x0e, 0xfe,
+    0x2f, 0x12, 0x84, 0x33, 0x0f, 0x3f, 0x29, 0xff,
+    0x48, 0x8f, 0x73, 0x0c, 0x8b, 0xce, 0x1f, 0xab,
+    0x91, 0xb5, 0x77, 0xf5, 0x8c, 0x00, 0x36, 0x12,
+    0xce, 0x41, 0x32, 0x65, 0x9c, 0xdd, 0xa8, 0x21,
+    0x86, 0xeb, 0x78, 0x15, 0x08, 0xf0, 0x0e, 0xa5,
+    0x81, 0x38, 0x29, 0x96, 0x6b, 0x15, 0x64, 0xa4,
+    0x4c, 0xe5, 0x76, 0x1b, 0x1a, 0x96, 0x99, 0xe2,
+    0xae, 0xcb, 0xf4, 0x67, 0xeb, 0xb0, 0x80, 0x63,
+    0xe6, 0x96, 0x0d, 0x55, 0x91, 0x25, 0xca, 0xed,
+    0xfa, 0x1f, 0x86, 0x4b, 0xba, 0x92, 0x26, 0xc3,
+    0x46, 0x44, 0x2d, 0x00, 0xe2, 0x8c, 0x48, 0x8a,
+    0xe8, 0xcd, 0x86, 0x8f, 0x6c, 0x10, 0xcd, 0xd2,
+    0x96, 0xbf, 0x8e, 0xa5, 0xf4, 0x92, 0x5b, 0xde,
+    0x07, 0xbc, 0x6b, 0x60, 0xd9, 0xb8, 0x51, 0x23,
+    0xe5, 0x35, 0x30, 0x44, 0x12, 0xdc, 0x55, 0x37,
+    0x68, 0xdb, 0xe5, 0x8c, 0xf3, 0x3b, 0xd6, 0x6e,
+    0x2e, 0x21, 0xb4, 0xaf, 0xb9, 0xe1, 0x56, 0xd0,
+    0x1d, 0x57, 0xc1, 0xde, 0x94, 0x1e, 0x33, 0xc3,
+    0x81, 0x26, 0xc8, 0xc4, 0xd2, 0xa7, 0xb5, 0xba,
+    0xda, 0xdd, 0x80, 0xee, 0x0d, 0x17, 0xff, 0x39,
+    0x70, 0x51, 0x4a, 0x21, 0x50, 0x6a, 0xb6, 0xaa,
+    0x45, 0x21, 0x42, 0xc3, 0x45, 0x00, 0x56, 0xab,
+    0x3d, 0xc9, 0x63, 0x56, 0x6a, 0x2a, 0xa4, 0x62,
+    0x02, 0x02, 0xf3, 0xae, 0x22, 0x0d, 0x50, 0x0d,
+    0xea, 0x81, 0x05, 0xad, 0x93, 0xba, 0xb5, 0x90,
+    0x79, 0xc8, 0x26, 0x39, 0x7d, 0x5f, 0xb3, 0x2b,
+    0x04, 0x00, 0x77, 0x13, 0x7b, 0x1e, 0xd8, 0x3d,
+    0x10, 0xa5, 0xfb, 0xa0, 0xe0, 0xcb, 0x10, 0x29,
+    0x1b, 0x20, 0xd5, 0x99, 0x36, 0xab, 0xa9, 0x35,
+    0xe3, 0x02, 0x6e, 0x2c, 0x8f, 0x27, 0x73, 0x88,
+    0xa9, 0xf7, 0xa3, 0xeb, 0xa3, 0x59, 0x23, 0x33,
+    0x35, 0x51, 0x25, 0x4a, 0x97, 0x7f, 0xa5, 0xa6,
+    0x49, 0xb9, 0x7d, 0x9d, 0xaa, 0x14, 0x4c, 0x82,
+    0x13, 0x2c, 0x26, 0x14, 0xdb, 0xf2, 0xb1, 0x89,
+    0xf7, 0xf5, 0x5b, 0x1f, 0x05, 0x65, 0x07, 0x68,
+    0x22, 0xbe, 0xb5, 0x67, 0xf1, 0x97, 0x73, 0x5b,
+    0xc0, 0x51, 0x31, 0xcd, 0xc1, 0xd8, 0x9f, 0xe3,
+    0x92, 0x37, 0x39, 0xb8, 0x01, 0xa1, 0x4d, 0x18,
+    0x84, 0x47, 0x43, 0xfa, 0xb1, 0xce, 0x72, 0xb2,
+    0xff, 0xd0, 0xaf, 0xbe, 0xf4, 0x1c, 0xbe, 0x14,
+    0xb3, 0x82, 0x22, 0x51, 0x28, 0x00, 0x04, 0x3a,
+    0xda, 0x09, 0x82, 0xe2, 0x2d, 0xdb, 0x6c, 0x3d,
+    0xdc, 0x7f, 0x43, 0xd5, 0x37, 0x19, 0xa8, 0xb6,
+    0x6b, 0xb1, 0x9b, 0xe6, 0xf0, 0xf6, 0x79, 0xf1,
+    0x0b, 0x79, 0x84, 0x7d, 0x0f, 0x99, 0x17, 0x46,
+    0x67, 0xe8, 0x29, 0x09, 0xb6, 0xc0, 0x79, 0x65,
+    0x84, 0xa4, 0xdc, 0x3b, 0xa8, 0x70, 0x58, 0xdb,
+    0xb8, 0x51, 0x3a, 0xe9, 0xfe, 0x5b, 0x00, 0x83,
+    0x90, 0x8d, 0x9e, 0xda, 0xb2, 0x03, 0x5c, 0xf8,
+    0x7a, 0x15, 0x2c, 0x2b, 0x18, 0xcc, 0x80, 0xf1,
+    0x42, 0x91, 0x86, 0x7e, 0x58, 0xe9, 0x03, 0xdb,
+    0xda, 0x52, 0x24, 0x22, 0x12, 0x41, 0x6a, 0x5c,
+    0x5f, 0x3f, 0x5b, 0x80, 0xf1, 0x2f, 0x35, 0x9c,
+    0x74, 0x96, 0x80, 0xde, 0x60, 0x3e, 0x1d, 0xc5,
+    0x8a, 0x14, 0xe4, 0x93, 0xbf, 0xe0, 0x25, 0x68,
+    0xaf, 0x97, 0xc5, 0xb0, 0x71, 0x12, 0x56, 0x91,
+    0x95, 0xc8, 0x0e, 0xde, 0x99, 0x8c, 0xd5, 0xf9,
+    0xdb, 0x6b, 0xdf, 0x96, 0x6a, 0x5e, 0xa5, 0xa8,
+    0x57, 0xea, 0x12, 0x0f, 0x6a, 0x75, 0xa7, 0x68,
+    0x6f, 0x7f, 0xc5, 0x02, 0x1c, 0xaa, 0xb0, 0xba,
+    0x6a, 0xa2, 0xb4, 0x9d, 0x32, 0x56, 0xa8, 0xa0,
+    0x7b, 0x7d, 0x9f, 0xb3, 0x6b, 0xfc, 0x17, 0x07,
+    0xbc, 0x38, 0x9e, 0xf3, 0xbe, 0x17, 0x8e, 0x54,
+    0x25, 0xc0, 0x37, 0x23, 0xd2, 0xd7, 0xba, 0x4c,
+    0x46, 0x71, 0x84, 0xa9, 0x90, 0xea, 0x77, 0x67,
+    0x84, 0xbf, 0x61, 0x2d, 0x89, 0x00, 0xaa, 0xb1,
+    0xe7, 0x12, 0x69, 0x3a, 0x46, 0x51, 0xa4, 0xdc,
+    0x59, 0x5e, 0x9a, 0x31, 0x40, 0x42, 0x9d, 0x1b,
+    0xfe, 0xa7, 0x7b, 0x0c, 0xd1, 0xa3, 0x21, 0xd3,
+    0x10, 0x1e, 0x86, 0xf4, 0x75, 0x75, 0x44, 0x62,
+    0x5b, 0xa7, 0xb6, 0xa1, 0xf5, 0x58, 0x3b, 0xcc,
+    0xfb, 0x4d, 0x59, 0x4f, 0xbd, 0xd1, 0x04, 0x25,
+    0x0d, 0x02, 0xf2, 0xb6, 0xa0, 0x3e, 0x1d, 0x52,
+    0x0a, 0x3f, 0x2c, 0xa8, 0xb4, 0xb2, 0x93, 0x9b,
+    0xe6, 0xb0, 0xb0, 0x1a, 0xe6, 0xde, 0xff, 0xa0,
+    0xf0, 0xb9, 0x89, 0x28, 0x7a, 0x2f, 0x10, 0xb2,
+    0x5a, 0xc0, 0xb3, 0xdb, 0xea, 0x1a, 0xd2, 0x2f,
+    0xeb, 0xb8, 0x2e, 0x0a, 0x6f, 0x29, 0xd6, 0xf4,
+    0xf2, 0x3b, 0x00, 0xbb, 0xe8, 0x36, 0x29, 0x08,
+    0xd3, 0x0f, 0xa3, 0xf9, 0xfc, 0x77, 0x95, 0x31,
+    0x2c, 0xbe, 0xad, 0x24, 0xa6, 0x65, 0x03, 0xf5,
+    0xa0, 0x7d, 0x98, 0x93, 0xe6, 0x4e, 0x19, 0xbf,
+    0x86, 0x56, 0x72, 0xab, 0xa5, 0x70, 0x23, 0x19,
+    0x7c, 0x58, 0x62, 0x65, 0x68, 0x90, 0xb2, 0x6c,
+    0xe6, 0x2d, 0xa0, 0x69, 0xad, 0xba, 0x60, 0xec,
+    0x32, 0x0a, 0xfc, 0x60, 0x17, 0x69, 0xfc, 0xa7,
+    0xe1, 0x7b, 0x1d, 0x29, 0x3b, 0xae, 0x84, 0x7d,
+    0x7d, 0x71, 0x00, 0xbe, 0xe4, 0xde, 0xb7, 0xc0,
+    0x21, 0xfe, 0x47, 0x43, 0x94, 0x3d, 0xe3, 0xb7,
+    0x67, 0x40, 0xa2, 0x84, 0x0e, 0xe6, 0x60, 0xa6,
+    0x09, 0xaf, 0xd2, 0x5b, 0x91, 0x35, 0xfc, 0x8d,
+    0xf9, 0xec, 0x85, 0xde, 0x74, 0x81, 0x4e, 0x1c,
+    0x89, 0x80, 0x6e, 0x19, 0xaf, 0xa3, 0xb6, 0x5f,
+    0xe4, 0x25, 0x4a, 0x7e, 0x21, 0x7f, 0xb7, 0x79,
+    0x71, 0x34, 0x58, 0x1a, 0xa5, 0x24, 0xc6, 0xd6,
+    0xd4, 0xc4, 0x86, 0xe8, 0xdb, 0xa0, 0x32, 0x7f,
+    0x62, 0x22, 0x27, 0xd9, 0xbe, 0x9c, 0xf5, 0x96,
+    0xdb, 0x27, 0x1f, 0xcd, 0x44, 0xef, 0x8b, 0xe0,
+    0x38, 0xb6, 0x8e, 0x18, 0xb2, 0x6b, 0x4a, 0x98,
+    0xae, 0x8f, 0xc5, 0x08, 0xa3, 0xc9, 0xd6, 0x14,
+    0xc4, 0xe4, 0x81, 0x58, 0xa1, 0xf3, 0x35, 0xe5,
+    0x66, 0xc6, 0x7e, 0x8a, 0x4b, 0x77, 0x2a, 0x8c,
+    0xa4, 0x13, 0x9f, 0x59, 0x73, 0xdb, 0xe6, 0xff,
+    0x9b, 0x9e, 0x4d, 0x0a, 0x73, 0x7b, 0x65, 0x3e,
+    0x8e, 0x6f, 0x95, 0xad, 0x75, 0x88, 0xdf, 0x7f,
+    0x23, 0xc0, 0x95, 0x67, 0x41, 0x99, 0xb6, 0x59,
+    0x00, 0x66, 0x9e, 0x85, 0xf3, 0xf6, 0x5d, 0xc1,
+    0xc8, 0x29, 0x7b, 0x47, 0x0a, 0xbf, 0xa3, 0xee,
+    0x2d, 0x00, 0x71, 0x5b, 0xbb, 0x03, 0x57, 0xa4,
+    0x6d, 0x5b, 0xf0, 0x3b, 0x33, 0x61, 0xb9, 0xc0,
+    0x3b, 0xab, 0xbc, 0x72, 0xa0, 0x84, 0x4d, 0x34,
+    0x80, 0x99, 0xa8, 0xfc, 0xab, 0xdf, 0x62, 0xfa,
+    0x86, 0x8d, 0x32, 0x27, 0x5a, 0x61, 0xa2, 0x86,
+    0xc3, 0x49, 0x99, 0xae, 0xb1, 0xb4, 0xa2, 0xd0,
+    0x05, 0x0e, 0x20, 0xdf, 0x24, 0x3c, 0x4f, 0xed,
+    0x8c, 0xe3, 0x00, 0x43, 0xc0, 0xb1, 0x61, 0xfb,
+    0xf7, 0x7c, 0xf1, 0x52, 0xe8, 0xcf, 0xaa, 0xad,
+    0xa1, 0x38, 0x0d, 0x38, 0x03, 0xc6, 0xdf, 0x31,
+    0x1e, 0xd9, 0x1a, 0xe8, 0x97, 0x5b, 0xca, 0x7d,
+    0xf2, 0xc2, 0x61, 0xfe, 0x8c, 0x7b, 0xaf, 0x68,
+    0x70, 0x21, 0x4e, 0xb7, 0x00, 0x45, 0x6c, 0x5c,
+    0x84, 0x64, 0x2d, 0xd4, 0xad, 0x80, 0xf0, 0x35,
+    0xf8, 0xbe, 0x76, 0xb4, 0xae, 0x5c, 0xe0, 0x38,
+    0xc2, 0xec, 0x4e, 0x56, 0xa6, 0xbc, 0xc8, 0x4d,
+    0x01, 0x6f, 0x61, 0x3c, 0xfd, 0x39, 0xb0, 0xf2,
+    0x91, 0xd6, 0x5c, 0x88, 0xa8, 0x5c, 0x96, 0xb8,
+    0x56, 0xc6, 0x84, 0xe3, 0x7b, 0xf0, 0xb3, 0xab,
+    0x68, 0xd0, 0xa1, 0x70, 0x0e, 0xf7, 0x07, 0x9f,
+    0xde, 0x36, 0x48, 0xc8, 0x2d, 0x2b, 0x42, 0x73,
+    0xe0, 0x84, 0x7f, 0x7d, 0xaf, 0x1f, 0x9c, 0x6d,
+    0x4a, 0xcf, 0x8d, 0x42, 0x67, 0xba, 0x86, 0x86,
+    0x89, 0xf8, 0xa2, 0xc1, 0xc7, 0x9e, 0x31, 0x78,
+    0x96, 0x6d, 0x28, 0xdd, 0x37, 0xea, 0xeb, 0x10,
+    0x1e, 0xe4, 0xea, 0x49, 0x73, 0x43, 0x8a, 0x26,
+    0x44, 0xcc, 0x71, 0xae, 0x95, 0xcb, 0x10, 0xfd,
+    0x93, 0x83, 0xe7, 0xb5, 0x1d, 0x9e, 0x1a, 0x90,
+    0x69, 0x13, 0x0c, 0xec, 0xf1, 0x1a, 0x11, 0x3e,
+    0xd8, 0xa1, 0xb5, 0xf8, 0x3c, 0xf6, 0xa1, 0xcd,
+    0x48, 0xa3, 0x5e, 0x9b, 0xf1, 0x23, 0x5f, 0x08,
+    0x5a, 0xe6, 0x59, 0x8e, 0x2a, 0x67, 0x5b, 0x54,
+    0x62, 0x0c, 0x76, 0x7b, 0x64, 0xa1, 0xa6, 0x6d,
+    0x1f, 0x12, 0xfb, 0xb6, 0x3c, 0x73, 0x07, 0xa0,
+    0x82, 0x73, 0x60, 0x67, 0x3f, 0x83, 0xbd, 0x07,
+    0xb6, 0xa7, 0x3d, 0x9b, 0xa4, 0x01, 0x98, 0x5d,
+    0x17, 0x42, 0xa8, 0x87, 0x17, 0xbe, 0x9c, 0x2d,
+    0xe4, 0x0f, 0xaf, 0x48, 0x85, 0x2b, 0xe4, 0x20,
+    0x2c, 0xe3, 0x1e, 0x9a, 0x56, 0xd6, 0x6d, 0xb4,
+    0xc7, 0xb1, 0xea, 0x1a, 0x1c, 0x12, 0xb5, 0xcb,
+    0xd8, 0x4a, 0x37, 0xde, 0x69, 0x14, 0xbf, 0x94,
+    0x3f, 0xdb, 0xe6, 0x97, 0xd8, 0xcc, 0x6e, 0x86,
+    0xe7, 0x5b, 0x81, 0xc0, 0x1f, 0x8d, 0x9d, 0x80,
+    0x34, 0xb1, 0x09, 0x3e, 0x73, 0x5b, 0x3c, 0xcb,
+    0x38, 0xcc, 0x87, 0x97, 0x82, 0x66, 0xe2, 0xfe,
+    0xd5, 0xba, 0xb1, 0x33, 0xca, 0x4a, 0xb7, 0x50,
+    0x8e, 0x0a, 0x6a, 0x28, 0x7f, 0x5f, 0x96, 0x10,
+    0x8d, 0xab, 0x39, 0x36, 0x42, 0x26, 0x18, 0xc9,
+    0x0c, 0xcf, 0x39, 0x81, 0x08, 0x9c, 0xfd, 0x68,
+    0x28, 0x71, 0x78, 0xce, 0x0a, 0x5b, 0x19, 0x4b,
+    0x67, 0xfb, 0x46, 0x2d, 0xa9, 0x1e, 0xda, 0xeb,
+    0x5d, 0x99, 0x4d, 0x86, 0xfa, 0xa7, 0x54, 0x5b,
+    0xab, 0x55, 0x00, 0xf6, 0xae, 0xf8, 0x41, 0x69,
+    0x7f, 0x71, 0x0d, 0xe4, 0x25, 0x6f, 0xe1, 0xeb,
+    0xd0, 0x49, 0x4f, 0x94, 0x59, 0x98, 0x8e, 0xf3,
+    0x00, 0x2d, 0x57, 0x07, 0x54, 0xb4, 0x4d, 0x33,
+    0x00, 0xb1, 0x6f, 0x35, 0x75, 0xb8, 0xb0, 0xfa,
+    0x16, 0x0e, 0x8f, 0xff, 0x15, 0x51, 0x36, 0x5e,
+    0x64, 0x2c, 0xf6, 0xdd, 0xae, 0xc9, 0xda, 0xae,
+    0xbf, 0xa0, 0xb1, 0x5c, 0xca, 0x38, 0xfb, 0x1f,
+    0x8b, 0xd4, 0x96, 0x04, 0x7d, 0xe7, 0x45, 0x4a,
+    0x1c, 0xc4, 0x7d, 0xab, 0x8d, 0x71, 0xea, 0xba,
+    0x78, 0x6a, 0xac, 0xeb, 0xea, 0x17, 0xf5, 0x80,
+    0x31, 0x7c, 0x61, 0xf1, 0xb2, 0x46, 0x60, 0x27,
+    0x01, 0xfe, 0xea, 0x35, 0x22, 0x34, 0x0f, 0xec,
+    0xe8, 0xc8, 0x5f, 0x85, 0x9a, 0x57, 0xe4, 0x3f,
+    0x42, 0xb2, 0xd4, 0x41, 0xe2, 0x2c, 0xc5, 0x9b,
+    0xb9, 0xab, 0x07, 0x9c, 0x10, 0xb6, 0x9d, 0x62,
+    0xff, 0x1b, 0x12, 0x66, 0x58, 0x93, 0xf6, 0xf9,
+    0x3f, 0x98, 0xa5, 0x08, 0x93, 0x43, 0x62, 0x36,
+    0xe4, 0xd6, 0x5a, 0x03, 0x1d, 0xf8, 0x7b, 0xa3,
+    0xe6, 0x9d, 0x45, 0xee, 0x60, 0x33, 0xd1, 0x13,
+    0xed, 0xab, 0x9c, 0xb9, 0x26, 0xe4, 0x71, 0xbc,
+    0xd4, 0xe9, 0x38, 0x4d, 0xe8, 0x30, 0x11, 0x18,
+    0x20, 0x0c, 0x4f, 0xb8, 0x32, 0x77, 0xff, 0x0d,
+    0x6b, 0xc7, 0x36, 0x5e, 0xb3, 0x83, 0x2e, 0x15,
+    0xaa, 0xd5, 0x4f, 0xab, 0xee, 0x74, 0x00, 0xba,
+    0xe7, 0x87, 0x3a, 0x25, 0x77, 0xb4, 0x0a, 0xbd,
+    0x51, 0xab, 0xb7, 0x43, 0xfa, 0x49, 0x43, 0x34,
+    0xf3, 0x56, 0x69, 0xca, 0x1c, 0x1d, 0xd9, 0x1a,
+    0x68, 0xc2, 0x8f, 0x39, 0x19, 0x6c, 0x1b, 0xa4,
+    0xca, 0xe9, 0xed, 0x81, 0x7e, 0x4f, 0xb9, 0x6c,
+    0x1b, 0xe8, 0xb6, 0x7d, 0x8a, 0x90, 0xd1, 0x3f,
+    0x3d, 0xa8, 0x78, 0x5a, 0xf1, 0x5d, 0x9b, 0xf5,
+    0xed, 0x23, 0x09, 0xd9, 0x43, 0xe3, 0x39, 0x27,
+    0xc6, 0xe9, 0xe6, 0x3f, 0x04, 0x16, 0x67, 0x98,
+    0xf3, 0x6e, 0x0d, 0x92, 0x66, 0x95, 0x82, 0x43,
+    0xf5, 0xa3, 0x4b, 0x64, 0x32, 0x76, 0xc5, 0xa4,
+    0xc5, 0x24, 0x27, 0xd8, 0xe2, 0x10, 0xda, 0xa4,
+    0x28, 0x41, 0x30, 0x43, 0x80, 0x5e, 0xa2, 0x1e,
+    0x59, 0x51, 0xe1, 0x3b, 0x43, 0xb8, 0x9c, 0xde,
+    0x0a, 0xf5, 0x0d, 0xd8, 0x89, 0x9a, 0xed, 0x76,
+    0xf0, 0xca, 0x8d, 0x2b, 0x5e, 0xa5, 0x9a, 0x09,
+    0x31, 0x88, 0xba, 0x78, 0xc9, 0x5f, 0xe2, 0x3d,
+    0x54, 0xc5, 0xf9, 0x25, 0x5e, 0xbc, 0xe1, 0xff,
+    0x4d, 0xfa, 0x28, 0x5e, 0xe1, 0x7f, 0x62, 0x7b,
+    0x98, 0xa1, 0x74, 0xfc, 0xb9, 0x94, 0xca, 0x42,
+    0xd1, 0x42, 0x93, 0x1d, 0xc5, 0x1b, 0x56, 0x92,
+    0x4f, 0xc4, 0x77, 0x62, 0x37, 0xbe, 0x4a, 0x1e,
+    0x5d, 0xb0, 0x3d, 0x95, 0x66, 0x15, 0xbb, 0x54,
+    0x2d, 0x2d, 0x81, 0x63, 0x1c, 0xba, 0x62, 0x57,
+    0xf0, 0xf1, 0x6e, 0xd0, 0xbf, 0x01, 0xfb, 0x38,
+    0x68, 0x69, 0x34, 0xc9, 0xb3, 0x3d, 0xf1, 0xad,
+    0xe0, 0x70, 0xa0, 0xc9, 0xce, 0x46, 0xa1, 0x65,
+    0x07, 0x58, 0x03, 0x5b, 0x4a, 0xde, 0x1f, 0x8e,
+    0x89, 0x1d, 0x76, 0x58, 0x14, 0x88, 0x77, 0x0d,
+    0xa5, 0xc2, 0x15, 0xb1, 0xd8, 0x24, 0x29, 0xa1,
+    0x4a, 0x6b, 0x38, 0xda, 0xe5, 0x38, 0xa9, 0xb6,
+    0xee, 0x93, 0x40, 0x9c, 0xfe, 0x1a, 0x63, 0x75,
+    0xbc, 0xed, 0x72, 0x6e, 0x0a, 0xa4, 0xc4, 0xc3,
+    0xfa, 0x1c, 0x97, 0xa1, 0xb1, 0x4f, 0x4a, 0x60,
+    0x7b, 0xe4, 0x33, 0xed, 0xbf, 0x93, 0xcd, 0xa8,
+    0x51, 0xa0, 0x31, 0x05, 0xe6, 0xb2, 0xe8, 0x72,
+    0x3f, 0xb7, 0xcc, 0x37, 0x67, 0x70, 0x03, 0xec,
+    0xf6, 0xab, 0xdf, 0xf4, 0x08, 0xfb, 0x96, 0x22,
+    0xeb, 0xf3, 0x7a, 0xf4, 0x4d, 0xb6, 0x82, 0x87,
+    0x04, 0x09, 0xc3, 0x04, 0xa7, 0xbb, 0x42, 0xf5,
+    0x85, 0x5b, 0xb2, 0x09, 0x0d, 0x33, 0xcb, 0x80,
+    0xa3, 0x62, 0xb9, 0xce, 0x5d, 0xf1, 0x1a, 0x33,
+    0xa1, 0x05, 0x67, 0x3a, 0xfe, 0x70, 0x2b, 0x4b,
+    0x27, 0xad, 0xe6, 0x3f, 0x2c, 0xaa, 0x2d, 0xae,
+    0x89, 0xf7, 0xa2, 0xab, 0xa3, 0x32, 0x3f, 0xf5,
+    0xbb, 0x6a, 0x5b, 0x28, 0xff, 0x0e, 0x08, 0xd7,
+    0x23, 0x51, 0xde, 0xc6, 0xfd, 0xcc, 0x60, 0x96,
+    0xc9, 0x5f, 0xe5, 0x75, 0x18, 0x78, 0x18, 0xec,
+    0x31, 0x21, 0xdb, 0xd5, 0xfb, 0xcd, 0x5a, 0x09,
+    0xd8, 0x3f, 0x2c, 0xc2, 0x45, 0x3c, 0x33, 0x3e,
+    0xdb, 0x97, 0x3d, 0xdc, 0x25, 0x25, 0x66, 0xb6,
+    0x51, 0xff, 0x89, 0xbb, 0xee, 0x05, 0x65, 0x0d,
+    0x0a, 0xe0, 0xc8, 0xd7, 0xd5, 0x9a, 0xb0, 0x0b,
+    0xb0, 0x99, 0x91, 0xfa, 0x42, 0x31, 0x46, 0x23,
+    0x55, 0xf7, 0x53, 0xe0, 0xae, 0xa1, 0xb4, 0x5f,
+    0x3b, 0x46, 0xb9, 0x49, 0xe6, 0xdb, 0x6c, 0xca,
+    0xde, 0x0c, 0x90, 0xf6, 0xc3, 0x34, 0x9c, 0x3d,
+    0xaf, 0x24, 0xf7, 0x6c, 0x6e, 0x04, 0x76, 0x8e,
+    0xfb, 0x77, 0x5e, 0x41, 0x20, 0x96, 0xd6, 0x76,
+    0x2d, 0xa7, 0xeb, 0x49, 0xeb, 0x90, 0xfe, 0x3c,
+    0x65, 0x4b, 0xf7, 0x35, 0x37, 0x68, 0x0f, 0x04,
+    0x02, 0x10, 0x34, 0xb2, 0x84, 0xc3, 0x27, 0x0b,
+    0x78, 0x1e, 0xc4, 0x27, 0x98, 0xaa, 0x01, 0xf5,
+    0xa4, 0x16, 0xfd, 0x87, 0x32, 0x65, 0xea, 0xd8,
+    0xb1, 0x13, 0x25, 0xe9, 0x78, 0x15, 0x8e, 0xcd,
+    0x64, 0x5c, 0xec, 0x2a, 0x92, 0x52, 0x8b, 0x1a,
+    0xe2, 0x9b, 0xd0, 0xb4, 0xea, 0xf7, 0x62, 0x3c,
+    0xe4, 0x97, 0x6d, 0xd8, 0x7c, 0x4d, 0x96, 0xbc,
+    0x5d, 0x87, 0x30, 0xe9, 0xb4, 0x5c, 0x18, 0x87,
+    0x2f, 0xee, 0xfe, 0x38, 0x14, 0xef, 0x08, 0x45,
+    0x24, 0x65, 0x86, 0x7d, 0x1c, 0xa2, 0x7a, 0xf8,
+    0xc0, 0x47, 0x80, 0xb7, 0x31, 0x57, 0xcf, 0x6f,
+    0x70, 0xb3, 0x5a, 0x98, 0x2b, 0x7b, 0x57, 0xe0,
+    0x7e, 0x9b, 0x6c, 0x7f, 0xe2, 0xeb, 0x0c, 0x63,
+    0x34, 0x68, 0x64, 0xe7, 0x8e, 0x35, 0xbf, 0x16,
+    0xb3, 0x57, 0x19, 0x76, 0xb4, 0xc9, 0x65, 0x5d,
+    0x40, 0x77, 0x47, 0x5f, 0xea, 0xef, 0x7b, 0x4e,
+    0x34, 0x5f, 0xa3, 0x35, 0xc2, 0x0c, 0x56, 0x90,
+    0x6b, 0x1a, 0x32, 0xae, 0xfe, 0xc2, 0x4c, 0x14,
+    0x5a, 0xc4, 0x9e, 0xa5, 0x81, 0xa2, 0x5a, 0x61,
+    0xd1, 0x2c, 0xbb, 0x2c, 0xfe, 0x68, 0xab, 0x07,
+    0xe2, 0x9e, 0x54, 0x2a, 0x80, 0x81, 0x83, 0x02,
+    0x75, 0x44, 0x33, 0xe3, 0x3c, 0x3d, 0x8c, 0x9b,
+    0x6c, 0x38, 0xb3, 0xda, 0xf4, 0x9d, 0x83, 0x8f,
+    0x08, 0x92, 0xce, 0x93, 0x1a, 0x60, 0x66, 0x32,
+    0x7a, 0x77, 0xdb, 0x0f, 0xe1, 0x4e, 0xbc, 0xf6,
+    0x83, 0xa5, 0x65, 0x74, 0x55, 0x99, 0x48, 0xa7,
+    0x8f, 0x68, 0x56, 0x47, 0x41, 0xd7, 0xe9, 0x2b,
+    0xda, 0xdd, 0x00, 0x6f, 0x2e, 0xc4, 0xc7, 0x06,
+    0x1b, 0x9b, 0x2e, 0x7b, 0x15, 0x2a, 0x08, 0x07,
+    0xe1, 0x8b, 0x0a, 0xd5, 0xf3, 0xf4, 0xe3, 0xfe,
+    0xfc, 0xf8, 0x66, 0xb9, 0x4c, 0xe6, 0xbb, 0x77,
+    0xc1, 0xbc, 0x85, 0xf4, 0x17, 0x26, 0xd7, 0x04,
+    0x35, 0x7a, 0x06, 0x81, 0x02, 0x34, 0x4d, 0xff,
+    0xb2, 0xaa, 0x2f, 0x47, 0xff, 0x0a, 0x8a, 0x79,
+    0x1d, 0x4b, 0x6e, 0xf7, 0xc3, 0xff, 0x8d, 0x75,
+    0x10, 0xac, 0x6e, 0xdf, 0x5f, 0x2b, 0x68, 0xe6,
+    0x16, 0x84, 0xfc, 0xb0, 0xba, 0x4d, 0x2d, 0xa9,
+    0x00, 0x1e, 0x90, 0x8d, 0x65, 0x1e, 0xbb, 0x86,
+    0x89, 0x16, 0xa0, 0x0d, 0x2a, 0xcc, 0xb4, 0xf4,
+    0x9d, 0x10, 0xf7, 0x61, 0xbe, 0xa7, 0xce, 0x04,
+    0xc9, 0x5c, 0x2d, 0xb2, 0x8f, 0x4f, 0xf3, 0x72,
+    0xb1, 0xa4, 0xdc, 0x68, 0x69, 0x97, 0xe3, 0xea,
+    0xf5, 0xc4, 0x9a, 0x61, 0x25, 0x18, 0x37, 0x34,
+    0x33, 0xc7, 0x54, 0x6d, 0xe6, 0xc0, 0xe1, 0x2d,
+    0xbb, 0x58, 0x0c, 0x9a, 0x4f, 0x1f, 0xb2, 0xd6,
+    0x3a, 0xda, 0x2b, 0x53, 0xb9, 0xe4, 0x37, 0xf4,
+    0xaf, 0xcc, 0x2b, 0xef, 0x53, 0x1f, 0x30, 0x7f,
+    0xb4, 0x8f, 0x21, 0xf2, 0x2a, 0x0c, 0x7a, 0x7e,
+    0x9c, 0xe6, 0xf4, 0x9f, 0x2c, 0xb9, 0xb9, 0xb3,
+    0xa1, 0x85, 0xae, 0x46, 0xab, 0x12, 0xd9, 0x0f,
+    0xbf, 0xd9, 0x2f, 0xb9,
+};
+#else
+#error "MCUBOOT_EC256_FIXED_BASE_WIDTH must be 4, 5 or 6"
+#endif
+
+/* A point in Jacobian coordinates. */
+struct ec256_point {
+    uECC_word_t x[NUM_ECC_WORDS];
+    uECC_word_t y[NUM_ECC_WORDS];
+    uECC_word_t z[NUM_ECC_WORDS];
+    int inf;
+};
+
+/*
+ * Adds the affine point at pt, in the big-endian table format, to r.
+ */
+static void
+ec256_add_affine(struct ec256_point *r, const uint8_t *pt, uECC_Curve curve)
+{
+    uECC_word_t x2[NUM_ECC_WORDS];
+    uECC_word_t y2[NUM_ECC_WORDS];
+    uECC_word_t h[NUM_ECC_WORDS];
+    uECC_word_t s[NUM_ECC_WORDS];
+    uECC_word_t t1[NUM_ECC_WORDS];
+    uECC_word_t t2[NUM_ECC_WORDS];
+
+    uECC_vli_bytesToNative(x2, pt, NUM_ECC_BYTES);
+    uECC_vli_bytesToNative(y2, pt + NUM_ECC_BYTES, NUM_ECC_BYTES);
+
+    if (r->inf) {
+        uECC_vli_set(r->x, x2, NUM_ECC_WORDS);
+        uECC_vli_set(r->y, y2, NUM_ECC_WORDS);
+        uECC_vli_clear(r->z, NUM_ECC_WORDS);
+        r->z[0] = 1;
+        r->inf = 0;
+        return;
+    }
+
+    uECC_vli_modMult_fast(t1, r->z, r->z, curve);           /* Z1^2 */
+    uECC_vli_modMult_fast(h, x2, t1, curve);
+    uECC_vli_modSub(h, h, r->x, curve->p, NUM_ECC_WORDS);   /* H = U2 - X1 */
+    uECC_vli_modMult_fast(t1, t1, r->z, curve);             /* Z1^3 */
+    uECC_vli_modMult_fast(s, y2, t1, curve);
+    uECC_vli_modSub(s, s, r->y, curve->p, NUM_ECC_WORDS);   /* R = S2 - Y1 */
+
+    if (uECC_vli_isZero(h, NUM_ECC_WORDS)) {
+        if (uECC_vli_isZero(s, NUM_ECC_WORDS)) {
+            curve->double_jacobian(r->x, r->y, r->z, curve);
+        } else {
+            r->inf = 1;
+        }
+        return;
+    }
+
+    uECC_vli_modMult_fast(r->z, r->z, h, curve);            /* Z3 = Z1 * H */
+    uECC_vli_modMult_fast(t1, h, h, curve);                 /* H^2 */
+    uECC_vli_modMult_fast(t2, t1, h, curve);                /* H^3 */
+    uECC_vli_modMult_fast(t1, t1, r->x, curve);             /* V = X1 * H^2 */
+    uECC_vli_modMult_fast(r->x, s, s, curve);
+    uECC_vli_modSub(r->x, r->x, t2, curve->p, NUM_ECC_WORDS);
+    uECC_vli_modSub(r->x, r->x, t1, curve->p, NUM_ECC_WORDS);
+    uECC_vli_modSub(r->x, r->x, t1, curve->p, NUM_ECC_WORDS); /* X3 */
+    uECC_vli_modSub(t1, t1, r->x, curve->p, NUM_ECC_WORDS);
+    uECC_vli_modMult_fast(t1, t1, s, curve);
+    uECC_vli_modMult_fast(t2, t2, r->y, curve);
+    uECC_vli_modSub(r->y, t1, t2, curve->p, NUM_ECC_WORDS); /* Y3 */
+}
+
+/*
+ * Returns the table index made of the bits of column col of the rows of k.
+ */
+static unsigned int
+ec256_comb_index(const uECC_word_t *k, int col)
+{
+    unsigned int idx = 0;
+    int bit;
+    int j;
+
+    for (j = 0; j < MCUBOOT_EC256_FIXED_BASE_WIDTH; j++) {
+        bit = j * EC256_COMB_COLS + col;
+        if (bit < 256 && uECC_vli_testBit(k, bit)) {
+            idx |= 1u << j;
+        }
+    }
+
+    return idx;
+}
+
+bool
+bootutil_ec256_table_usable(const uint8_t *pubkey, const uint8_t *table)
+{
+    return table != NULL &&
+           table[0] == MCUBOOT_EC256_FIXED_BASE_WIDTH &&
+           memcmp(table + EC256_TABLE_HDR_SZ, pubkey, EC256_POINT_SZ) == 0;
+}
+
+/*
+ * Same as uECC_verify() for P-256 and a 32-byte hash, with the table of the
+ * public key.  Returns 1 if the signature is valid, 0 otherwise.
+ */
+int
+bootutil_ec256_verify_fixed(const uint8_t *table, const uint8_t *hash,
+                            const uint8_t *signature)
+{
+    uECC_Curve curve = uECC_secp256r1();
+    struct ec256_point sum;
+    uECC_word_t r[NUM_ECC_WORDS];
+    uECC_word_t s[NUM_ECC_WORDS];
+    uECC_word_t u1[NUM_ECC_WORDS];
+    uECC_word_t u2[NUM_ECC_WORDS];
+    uECC_word_t z[NUM_ECC_WORDS];
+    unsigned int idx;
+    int col;
+
+    uECC_vli_bytesToNative(r, signature, NUM_ECC_BYTES);
+    uECC_vli_bytesToNative(s, signature + NUM_ECC_BYTES, NUM_ECC_BYTES);
+
+    /* r, s must be in [1, n - 1]. */
+    if (uECC_vli_isZero(r, NUM_ECC_WORDS) ||
+        uECC_vli_isZero(s, NUM_ECC_WORDS) ||
+        uECC_vli_cmp_unsafe(curve->n, r, NUM_ECC_WORDS) != 1 ||
+        uECC_vli_cmp_unsafe(curve->n, s, NUM_ECC_WORDS) != 1) {
+        return 0;
+    }
+
+    /* u1 = e / s, u2 = r / s */
+    uECC_vli_modInv(z, s, curve->n, NUM_ECC_WORDS);
+    uECC_vli_bytesToNative(u1, hash, NUM_ECC_BYTES);
+    uECC_vli_modMult(u1, u1, z, curve->n, NUM_ECC_WORDS);
+    uECC_vli_modMult(u2, r, z, curve->n, NUM_ECC_WORDS);
+
+    sum.inf = 1;
+    for (col = EC256_COMB_COLS - 1; col >= 0; col--) {
+        if (!sum.inf) {
+            curve->double_jacobian(sum.x, sum.y, sum.z, curve);
+        }
+
+        idx = ec256_comb_index(u1, col);
+        if (idx != 0) {
+            ec256_add_affine(&sum, ec256_g_table + EC256_TABLE_HDR_SZ +
+                                   (idx - 1) * EC256_POINT_SZ, curve);
+        }
+
+        idx = ec256_comb_index(u2, col);
+        if (idx != 0) {
+            ec256_add_affine(&sum, table + EC256_TABLE_HDR_SZ +
+                                   (idx - 1) * EC256_POINT_SZ, curve);
+        }
+    }
+
+    if (sum.inf) {
+        return 0;
+    }
+
+    /* x = X / Z^2 (mod n) */
+    uECC_vli_modInv(z, sum.z, curve->p, NUM_ECC_WORDS);
+    uECC_vli_modMult_fast(z, z, z, curve);
+    uECC_vli_modMult_fast(sum.x, sum.x, z, curve);
+    if (uECC_vli_cmp_unsafe(curve->n, sum.x, NUM_ECC_WORDS) != 1) {
+        uECC_vli_sub(sum.x, sum.x, curve->n, NUM_ECC_WORDS);
+    }
+
+    return uECC_vli_equal(sum.x, r, NUM_ECC_WORDS) == 0;
+}
+
+#endif /* MCUBOOT_SIGN_EC256 && MCUBOOT_EC256_FIXED_BASE */
@@ -45,6 +45,10 @@
 #include "mbedtls/asn1.h"
 #endif
 
+#if MCUBOOT_SWAP_SEAL_ENCKEY
+#include "bootutil/sha256.h"
+#endif
+
 #include "bootutil/image.h"
 #include "bootutil/enc_key.h"
 #include "bootutil/sign_key.h"
@@ -126,6 +130,186 @@ key_unwrap(const uint8_t *wrapped, uint8_t *enckey)
 #endif /* MCUBOOT_USE_MBED_TLS */
 #endif /* MCUBOOT_ENCRYPT_KW */
 
+#if MCUBOOT_SWAP_SEAL_ENCKEY
+#define SEAL_BLOCKS ((BOOT_ENC_SEALED_SIZE / 8) - 1)
+
+/*
+ * Implements AES key wrapping and unwrapping following RFC-3394 sections
+ * 2.2.1 and 2.2.2, of the key and TLV digest, under the platform's sealing
+ * key.
+ */
+static int
+seal_wrap(const uint8_t *kek, const uint8_t *in, uint8_t *out)
+{
+#if defined(MCUBOOT_USE_MBED_TLS)
+    mbedtls_aes_context aes;
+#else
+    struct tc_aes_key_sched_struct aes;
+#endif
+    uint8_t B[16];
+    uint8_t *R;
+    int i, j;
+    int rc;
+
+#if defined(MCUBOOT_USE_MBED_TLS)
+    mbedtls_aes_init(&aes);
+    rc = mbedtls_aes_setkey_enc(&aes, kek, BOOT_ENC_KEY_SIZE_BITS);
+#else
+    rc = (tc_aes128_set_encrypt_key(&aes, kek) == 0) ? -1 : 0;
+#endif
+    if (rc != 0) {
+        goto done;
+    }
+
+    memset(B, 0xa6, 8);
+    memcpy(&out[8], in, SEAL_BLOCKS * 8);
+
+    for (j = 0; j < 6; j++) {
+        for (i = 1; i <= SEAL_BLOCKS; i++) {
+            R = &out[i * 8];
+            memcpy(&B[8], R, 8);
+#if defined(MCUBOOT_USE_MBED_TLS)
+            rc = mbedtls_aes_crypt_ecb(&aes, MBEDTLS_AES_ENCRYPT, B, B);
+#else
+            rc = (tc_aes_encrypt(B, B, &aes) == 0) ? -1 : 0;
+#endif
+            if (rc != 0) {
+                goto done;
+            }
+            B[7] ^= SEAL_BLOCKS * j + i;
+            memcpy(R, &B[8], 8);
+        }
+    }
+    memcpy(out, B, 8);
+
+done:
+#if defined(MCUBOOT_USE_MBED_TLS)
+    mbedtls_aes_free(&aes);
+#endif
+    memset(B, 0, sizeof B);
+    return rc;
+}
+
+static int
+seal_unwrap(const uint8_t *kek, const uint8_t *in, uint8_t *out)
+{
+#if defined(MCUBOOT_USE_MBED_TLS)
+    mbedtls_aes_context aes;
+#else
+    struct tc_aes_key_sched_struct aes;
+#endif
+    uint8_t B[16];
+    uint8_t *R;
+    int i, j, k;
+    int rc;
+
+#if defined(MCUBOOT_USE_MBED_TLS)
+    mbedtls_aes_init(&aes);
+    rc = mbedtls_aes_setkey_dec(&aes, kek, BOOT_ENC_KEY_SIZE_BITS);
+#else
+    rc = (tc_aes128_set_decrypt_key(&aes, kek) == 0) ? -1 : 0;
+#endif
+    if (rc != 0) {
+        goto done;
+    }
+
+    memcpy(B, in, 8);
+    memcpy(out, &in[8], SEAL_BLOCKS * 8);
+
+    for (j = 5; j >= 0; j--) {
+        for (i = SEAL_BLOCKS; i > 0; i--) {
+            R = &out[(i - 1) * 8];
+            B[7] ^= SEAL_BLOCKS * j + i;
+            memcpy(&B[8], R, 8);
+#if defined(MCUBOOT_USE_MBED_TLS)
+            rc = mbedtls_aes_crypt_ecb(&aes, MBEDTLS_AES_DECRYPT, B, B);
+#else
+            rc = (tc_aes_decrypt(B, B, &aes) == 0) ? -1 : 0;
+#endif
+            if (rc != 0) {
+                goto done;
+            }
+            memcpy(R, &B[8], 8);
+        }
+    }
+
+    for (i = 0, k = 0; i < 8; i++) {
+        k |= B[i] ^ 0xa6;
+    }
+    if (k) {
+        rc = -1;
+    }
+
+done:
+#if defined(MCUBOOT_USE_MBED_TLS)
+    mbedtls_aes_free(&aes);
+#endif
+    memset(B, 0, sizeof B);
+    return rc;
+}
+
+/*
+ * Seal an image key, bound to the digest of its key TLV, for saving in the
+ * swap status.
+ */
+int
+boot_enc_seal(const uint8_t *enckey, const uint8_t *digest, uint8_t *sealed)
+{
+    uint8_t kek[BOOT_ENC_KEY_SIZE];
+    uint8_t buf[BOOT_ENC_KEY_SIZE + BOOT_ENC_SEAL_DIGEST_SIZE];
+    int rc;
+
+    rc = boot_enc_get_seal_key(kek);
+    if (rc == 0) {
+        memcpy(buf, enckey, BOOT_ENC_KEY_SIZE);
+        memcpy(&buf[BOOT_ENC_KEY_SIZE], digest, BOOT_ENC_SEAL_DIGEST_SIZE);
+        rc = seal_wrap(kek, buf, sealed);
+    }
+
+    memset(kek, 0, sizeof kek);
+    memset(buf, 0, sizeof buf);
+    return rc;
+}
+
+/*
+ * Unseal a key saved in the swap status.  Fails unless it was sealed on
+ * this device.
+ */
+int
+boot_enc_unseal(const uint8_t *sealed, uint8_t *enckey, uint8_t *digest)
+{
+    uint8_t kek[BOOT_ENC_KEY_SIZE];
+    uint8_t buf[BOOT_ENC_KEY_SIZE + BOOT_ENC_SEAL_DIGEST_SIZE];
+    int rc;
+
+    rc = boot_enc_get_seal_key(kek);
+    if (rc == 0) {
+        rc = seal_unwrap(kek, sealed, buf);
+    }
+    if (rc == 0) {
+        memcpy(enckey, buf, BOOT_ENC_KEY_SIZE);
+        memcpy(digest, &buf[BOOT_ENC_KEY_SIZE], BOOT_ENC_SEAL_DIGEST_SIZE);
+    }
+
+    memset(kek, 0, sizeof kek);
+    memset(buf, 0, sizeof buf);
+    return rc;
+}
+
+static void
+boot_enc_tlv_digest(const uint8_t *buf, uint8_t *digest)
+{
+    bootutil_sha256_context sha256_ctx;
+    uint8_t hash[32];
+
+    bootutil_sha256_init(&sha256_ctx);
+    bootutil_sha256_update(&sha256_ctx, buf, BOOT_ENC_TLV_SIZE);
+    bootutil_sha256_finish(&sha256_ctx, hash);
+
+    memcpy(digest, hash, BOOT_ENC_SEAL_DIGEST_SIZE);
+}
+#endif /* MCUBOOT_SWAP_SEAL_ENCKEY */
+
 #if defined(MCUBOOT_ENCRYPT_RSA)
 static int
 parse_rsa_enckey(mbedtls_rsa_context *ctx, uint8_t **p, uint8_t *end)
@@ -681,6 +865,9 @@ boot_enc_load(struct enc_key_data *enc_state, int image_index,
     uint8_t *buf;
 #else
     uint8_t buf[EXPECTED_ENC_LEN];
+#endif
+#if MCUBOOT_SWAP_SEAL_ENCKEY
+    uint8_t digest[BOOT_ENC_SEAL_DIGEST_SIZE];
 #endif
     uint8_t slot;
     int rc;
@@ -720,7 +907,28 @@ boot_enc_load(struct enc_key_data *enc_state, int image_index,
         return -1;
     }
 
+#if MCUBOOT_SWAP_SEAL_ENCKEY
+    /*
+     * A swap status left by a swap involving this image, e.g. the one being
+     * reverted, may already hold its key sealed; unsealing it is much
+     * cheaper than decrypting the TLV.
+     */
+    boot_enc_tlv_digest(buf, digest);
+    memset(bs->enckey_sealed[slot], 0xff, BOOT_ENC_SEALED_ALIGN_SIZE);
+    rc = boot_find_enc_key(image_index, digest, bs->enckey[slot],
+                           bs->enckey_sealed[slot]);
+    if (rc == 0) {
+        return 0;
+    }
+
+    rc = boot_enc_decrypt(buf, bs->enckey[slot]);
+    if (rc == 0) {
+        rc = boot_enc_seal(bs->enckey[slot], digest, bs->enckey_sealed[slot]);
+    }
+    return rc;
+#else
     return boot_enc_decrypt(buf, bs->enckey[slot]);
+#endif
 }
 
 bool
@@ -739,16 +947,69 @@ boot_enc_valid(struct enc_key_data *enc_state, int image_index,
     return enc_state[rc].valid;
 }
 
+#ifndef MCUBOOT_ENC_HW_KEYSTREAM
+/*
+ * Software keystream: encrypts the counter blocks one after the other.
+ */
+static void
+boot_enc_keystream(struct enc_key_data *enc, uint8_t *nonce, uint8_t *ks,
+        uint32_t nblk)
+{
+    uint32_t j;
+
+    while (nblk-- > 0) {
+#if defined(MCUBOOT_USE_MBED_TLS)
+        mbedtls_aes_crypt_ecb(&enc->aes, MBEDTLS_AES_ENCRYPT, nonce, ks);
+#else
+        tc_aes_encrypt(ks, nonce, &enc->aes);
+#endif
+        ks += BOOT_ENC_BLOCK_SIZE;
+
+        for (j = BOOT_ENC_BLOCK_SIZE; j > 0; --j) {
+            if (++nonce[j - 1] != 0) {
+                break;
+            }
+        }
+    }
+}
+#else
+#define boot_enc_keystream boot_enc_hw_keystream
+#endif
+
+/*
+ * buf ^= ks, a word at a time.  Neither needs to be aligned.
+ */
+static void
+boot_enc_xor(uint8_t *buf, const uint8_t *ks, uint32_t len)
+{
+    uint32_t w;
+    uint32_t k;
+
+    while (len >= sizeof(w)) {
+        memcpy(&w, buf, sizeof(w));
+        memcpy(&k, ks, sizeof(k));
+        w ^= k;
+        memcpy(buf, &w, sizeof(w));
+        buf += sizeof(w);
+        ks += sizeof(k);
+        len -= sizeof(w);
+    }
+
+    while (len-- > 0) {
+        *buf++ ^= *ks++;
+    }
+}
+
 void
 boot_encrypt(struct enc_key_data *enc_state, int image_index,
         const struct flash_area *fap, uint32_t off, uint32_t sz,
         uint32_t blk_off, uint8_t *buf)
 {
     struct enc_key_data *enc;
-    uint32_t i, j;
-    uint8_t u8;
-    uint8_t nonce[16];
-    uint8_t blk[16];
+    uint8_t nonce[BOOT_ENC_BLOCK_SIZE];
+    uint8_t ks[BOOT_ENC_KS_BLOCKS * BOOT_ENC_BLOCK_SIZE];
+    uint32_t nblk;
+    uint32_t len;
     int rc;
 
     memset(nonce, 0, 12);
@@ -766,24 +1027,27 @@ boot_encrypt(struct enc_key_data *enc_state, int image_index,
 
     enc = &enc_state[rc];
     assert(enc->valid == 1);
-    for (i = 0; i < sz; i++) {
-        if (i == 0 || blk_off == 0) {
-#if defined(MCUBOOT_USE_MBED_TLS)
-            mbedtls_aes_crypt_ecb(&enc->aes, MBEDTLS_AES_ENCRYPT, nonce, blk);
-#else
-            tc_aes_encrypt(blk, nonce, &enc->aes);
-#endif
 
-            for (j = 16; j > 0; --j) {
-                if (++nonce[j - 1] != 0) {
-                    break;
-                }
-            }
+    /*
+     * The keystream is made BOOT_ENC_KS_BLOCKS counter blocks at a time; the
+     * first one starts blk_off bytes into its block.
+     */
+    while (sz > 0) {
+        nblk = (blk_off + sz + BOOT_ENC_BLOCK_SIZE - 1) / BOOT_ENC_BLOCK_SIZE;
+        if (nblk > BOOT_ENC_KS_BLOCKS) {
+            nblk = BOOT_ENC_KS_BLOCKS;
+        }
+        boot_enc_keystream(enc, nonce, ks, nblk);
+
+        len = nblk * BOOT_ENC_BLOCK_SIZE - blk_off;
+        if (len > sz) {
+            len = sz;
         }
+        boot_enc_xor(buf, &ks[blk_off], len);
 
-        u8 = *buf;
-        *buf++ = u8 ^ blk[blk_off];
-        blk_off = (blk_off + 1) & 0x0f;
+        buf += len;
+        sz -= len;
+        blk_off = 0;
     }
 }
 
@@ -153,8 +153,8 @@ bootutil_decode_sig(uint8_t signature[NUM_ECC_BYTES * 2], uint8_t *cp, uint8_t *
 
 #ifdef MCUBOOT_USE_TINYCRYPT
 int
-bootutil_verify_sig(uint8_t *hash, uint32_t hlen, uint8_t *sig, size_t slen,
-  uint8_t key_id)
+bootutil_verify_sig(uint8_t *hash, uint32_t hlen, const uint8_t *sig,
+  size_t slen, uint8_t key_id)
 {
     int rc;
     uint8_t *pubkey;
@@ -170,7 +170,8 @@ bootutil_verify_sig(uint8_t *hash, uint32_t hlen, uint8_t *sig, size_t slen,
         return -1;
     }
 
-    rc = bootutil_decode_sig(signature, sig, sig + slen);
+    /* The ASN.1 parser only reads the signature. */
+    rc = bootutil_decode_sig(signature, (uint8_t *)sig, (uint8_t *)sig + slen);
     if (rc) {
         return -1;
     }
@@ -182,6 +183,12 @@ bootutil_verify_sig(uint8_t *hash, uint32_t hlen, uint8_t *sig, size_t slen,
         return -1;
     }
 
+#ifdef MCUBOOT_EC256_FIXED_BASE
+    if (bootutil_ec256_table_usable(pubkey, bootutil_keys[key_id].table)) {
+        rc = bootutil_ec256_verify_fixed(bootutil_keys[key_id].table, hash,
+                                         signature);
+    } else
+#endif
     rc = uECC_verify(pubkey, hash, NUM_ECC_BYTES, signature, uECC_secp256r1());
     if (rc == 1) {
         return 0;
@@ -194,7 +201,7 @@ bootutil_verify_sig(uint8_t *hash, uint32_t hlen, uint8_t *sig, size_t slen,
 int
 bootutil_verify_sig(uint8_t *hash,
                     uint32_t hlen,
-                    uint8_t *sig,
+                    const uint8_t *sig,
                     size_t slen,
                     uint8_t key_id)
 {
@@ -212,7 +219,8 @@ bootutil_verify_sig(uint8_t *hash,
     }
 
     /* Decode signature */
-    rc = bootutil_decode_sig(signature, sig, sig + slen);
+    /* The ASN.1 parser only reads the signature. */
+    rc = bootutil_decode_sig(signature, (uint8_t *)sig, (uint8_t *)sig + slen);
     if (rc) {
         return -1;
     }
@@ -22,6 +22,12 @@ static const uint8_t ed25519_pubkey_oid[] = MBEDTLS_OID_ISO_IDENTIFIED_ORG "\x65
 extern int ED25519_verify(const uint8_t *message, size_t message_len,
                           const uint8_t signature[64],
                           const uint8_t public_key[32]);
+#ifdef MCUBOOT_ED25519_FIXED_BASE
+extern int ED25519_verify_with_table(const uint8_t *message, size_t message_len,
+                                     const uint8_t signature[64],
+                                     const uint8_t public_key[32],
+                                     const uint8_t *table);
+#endif
 
 /*
  * Parse the public key used for signing.
@@ -63,12 +69,15 @@ bootutil_import_key(uint8_t **cp, uint8_t *end)
 }
 
 int
-bootutil_verify_sig(uint8_t *hash, uint32_t hlen, uint8_t *sig, size_t slen,
-  uint8_t key_id)
+bootutil_verify_sig(uint8_t *hash, uint32_t hlen, const uint8_t *sig,
+  size_t slen, uint8_t key_id)
 {
     int rc;
     uint8_t *pubkey;
     uint8_t *end;
+#ifdef MCUBOOT_ED25519_FIXED_BASE
+    const uint8_t *table;
+#endif
 
     if (hlen != 32 || slen != 64) {
         return -1;
@@ -82,6 +91,14 @@ bootutil_verify_sig(uint8_t *hash, uint32_t hlen, uint8_t *sig, size_t slen,
         return -1;
     }
 
+#ifdef MCUBOOT_ED25519_FIXED_BASE
+    /* The table starts with the key it was computed from. */
+    table = bootutil_keys[key_id].table;
+    if (table != NULL && memcmp(table, pubkey, NUM_ED25519_BYTES) == 0) {
+        rc = ED25519_verify_with_table(hash, 32, sig, pubkey,
+                                       table + NUM_ED25519_BYTES);
+    } else
+#endif
     rc = ED25519_verify(hash, 32, sig, pubkey);
     if (rc == 0) {
         return -2;
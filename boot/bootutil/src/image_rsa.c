@@ -115,6 +115,64 @@ bootutil_parse_rsakey(mbedtls_rsa_context *ctx, uint8_t **p, uint8_t *end)
     return 0;
 }
 
+#ifdef MCUBOOT_RSA_PRECOMP
+/*
+ * Set up the public key from its precomputed table, which holds the
+ * modulus N followed by RR = 2^(2 * MCUBOOT_SIGN_RSA_LEN) mod N, both
+ * big-endian on PSS_EMLEN bytes.  Reading N from exactly PSS_EMLEN bytes
+ * makes R = 2^MCUBOOT_SIGN_RSA_LEN the Montgomery radix of mbedtls for any
+ * limb size, so mbedtls_rsa_public() uses RR from ctx->RN instead of
+ * computing it.  The key was checked when the table was generated, so only
+ * the exponent is read from it.
+ *
+ * Returns 1 if the table is not the one of the key.
+ */
+static int
+bootutil_load_rsakey_precomp(mbedtls_rsa_context *ctx, const uint8_t *table,
+                             uint8_t **p, uint8_t *end)
+{
+    int rc;
+    size_t len;
+
+    if ((rc = mbedtls_asn1_get_tag(p, end, &len,
+          MBEDTLS_ASN1_CONSTRUCTED | MBEDTLS_ASN1_SEQUENCE)) != 0) {
+        return -1;
+    }
+
+    if (*p + len != end) {
+        return -2;
+    }
+
+    if ((rc = mbedtls_asn1_get_tag(p, end, &len, MBEDTLS_ASN1_INTEGER)) != 0) {
+        return -3;
+    }
+
+    /* The modulus is positive, so it has a leading zero in DER. */
+    if (len != PSS_EMLEN + 1 || (*p)[0] != 0 ||
+        memcmp(*p + 1, table, PSS_EMLEN) != 0) {
+        return 1;
+    }
+    *p += len;
+
+    if ((rc = mbedtls_asn1_get_mpi(p, end, &ctx->E)) != 0) {
+        return -3;
+    }
+
+    if (*p != end) {
+        return -4;
+    }
+
+    if (mbedtls_mpi_read_binary(&ctx->N, table, PSS_EMLEN) != 0 ||
+        mbedtls_mpi_read_binary(&ctx->RN, table + PSS_EMLEN, PSS_EMLEN) != 0) {
+        return -5;
+    }
+
+    ctx->len = PSS_EMLEN;
+
+    return 0;
+}
+#endif /* MCUBOOT_RSA_PRECOMP */
+
 /*
  * Compute the RSA-PSS mask-generation function, MGF1.  Assumptions
  * are that the mask length will be less than 256 * PSS_HLEN, and
@@ -157,7 +215,7 @@ pss_mgf1(uint8_t *mask, const uint8_t *hash)
  */
 static int
 bootutil_cmp_rsasig(mbedtls_rsa_context *ctx, uint8_t *hash, uint32_t hlen,
-  uint8_t *sig)
+  const uint8_t *sig)
 {
     bootutil_sha256_context shactx;
     uint8_t em[MBEDTLS_MPI_MAX_SIZE];
@@ -271,8 +329,8 @@ bootutil_cmp_rsasig(mbedtls_rsa_context *ctx, uint8_t *hash, uint32_t hlen,
 }
 
 int
-bootutil_verify_sig(uint8_t *hash, uint32_t hlen, uint8_t *sig, size_t slen,
-  uint8_t key_id)
+bootutil_verify_sig(uint8_t *hash, uint32_t hlen, const uint8_t *sig,
+  size_t slen, uint8_t key_id)
 {
     mbedtls_rsa_context ctx;
     int rc;
@@ -284,7 +342,20 @@ bootutil_verify_sig(uint8_t *hash, uint32_t hlen, uint8_t *sig, size_t slen,
     cp = (uint8_t *)bootutil_keys[key_id].key;
     end = cp + *bootutil_keys[key_id].len;
 
+#ifdef MCUBOOT_RSA_PRECOMP
+    rc = 1;
+    if (bootutil_keys[key_id].table != NULL) {
+        rc = bootutil_load_rsakey_precomp(&ctx, bootutil_keys[key_id].table,
+                                          &cp, end);
+    }
+    if (rc == 1) {
+        /* No table for this key, parse it in full. */
+        cp = (uint8_t *)bootutil_keys[key_id].key;
+        rc = bootutil_parse_rsakey(&ctx, &cp, end);
+    }
+#else
     rc = bootutil_parse_rsakey(&ctx, &cp, end);
+#endif
     if (rc || slen != ctx.len) {
         mbedtls_rsa_free(&ctx);
         return rc;
@@ -55,7 +55,7 @@
 /*
  * Compute SHA256 over the image.
  */
-static int
+int
 bootutil_img_hash(struct enc_key_data *enc_state, int image_index,
                   struct image_header *hdr, const struct flash_area *fap,
                   uint8_t *tmp_buf, uint32_t tmp_buf_sz, uint8_t *hash_result,
@@ -69,6 +69,9 @@ bootutil_img_hash(struct enc_key_data *enc_state, int image_index,
     int rc;
     uint32_t blk_off;
     uint32_t tlv_off;
+#ifdef MCUBOOT_FLASH_AREA_GET_PTR
+    const void *img;
+#endif
 
 #if (BOOT_IMAGE_NUMBER == 1) || !defined(MCUBOOT_ENC_IMAGES)
     (void)enc_state;
@@ -102,6 +105,22 @@ bootutil_img_hash(struct enc_key_data *enc_state, int image_index,
     /* If protected TLVs are present they are also hashed. */
     size += hdr->ih_protect_tlv_size;
 
+#ifdef MCUBOOT_FLASH_AREA_GET_PTR
+    /* A memory-mapped image is hashed in place, in a single pass. */
+    rc = flash_area_get_ptr(fap, 0, size, &img);
+#ifdef MCUBOOT_ENC_IMAGES
+    if (MUST_DECRYPT(fap, image_index, hdr)) {
+        /* The payload has to be decrypted in tmp_buf first. */
+        rc = -1;
+    }
+#endif
+    if (rc == 0) {
+        bootutil_sha256_update(&sha256_ctx, img, size);
+        bootutil_sha256_finish(&sha256_ctx, hash_result);
+        return 0;
+    }
+#endif
+
     for (off = 0; off < size; off += blk_sz) {
         blk_sz = size - off;
         if (blk_sz > tmp_buf_sz) {
@@ -183,11 +202,12 @@ bootutil_img_hash(struct enc_key_data *enc_state, int image_index,
 #ifdef EXPECTED_SIG_TLV
 #if !defined(MCUBOOT_HW_KEY)
 static int
-bootutil_find_key(uint8_t *keyhash, uint8_t keyhash_len)
+bootutil_find_key(const uint8_t *keyhash, uint8_t keyhash_len)
 {
     bootutil_sha256_context sha256_ctx;
     int i;
     const struct bootutil_key *key;
+    const uint8_t *key_hash;
     uint8_t hash[32];
 
     if (keyhash_len > 32) {
@@ -196,10 +216,15 @@ bootutil_find_key(uint8_t *keyhash, uint8_t keyhash_len)
 
     for (i = 0; i < bootutil_key_cnt; i++) {
         key = &bootutil_keys[i];
-        bootutil_sha256_init(&sha256_ctx);
-        bootutil_sha256_update(&sha256_ctx, key->key, *key->len);
-        bootutil_sha256_finish(&sha256_ctx, hash);
-        if (!memcmp(hash, keyhash, keyhash_len)) {
+        key_hash = key->hash;
+        if (key_hash == NULL) {
+            /* The key table was not generated with the hashes. */
+            bootutil_sha256_init(&sha256_ctx);
+            bootutil_sha256_update(&sha256_ctx, key->key, *key->len);
+            bootutil_sha256_finish(&sha256_ctx, hash);
+            key_hash = hash;
+        }
+        if (!bootutil_constant_time_compare(key_hash, keyhash, keyhash_len)) {
             return i;
         }
     }
@@ -225,7 +250,8 @@ bootutil_find_key(uint8_t image_index, uint8_t *key, uint16_t key_len)
         return rc;
     }
 
-    if (!memcmp(hash, key_hash, key_hash_size)) {
+    if (key_hash_size <= sizeof(key_hash) &&
+        !bootutil_constant_time_compare(hash, key_hash, key_hash_size)) {
         bootutil_keys[0].key = key;
         pub_key_len = key_len;
         return 0;
@@ -288,7 +314,7 @@ bootutil_get_img_security_cnt(struct image_header *hdr,
         return BOOT_EBADIMAGE;
     }
 
-    rc = flash_area_read(fap, off, img_security_cnt, len);
+    rc = bootutil_flash_read(fap, off, img_security_cnt, len);
     if (rc != 0) {
         return BOOT_EFLASH;
     }
@@ -297,15 +323,136 @@ bootutil_get_img_security_cnt(struct image_header *hdr,
 }
 #endif /* MCUBOOT_HW_ROLLBACK_PROT */
 
+#ifdef MCUBOOT_IMAGE_MANIFEST
 /*
- * Verify the integrity of the image.
+ * Hashes of the images listed by the manifest image of each slot.  A slot is
+ * only filled in by the boot loader, once the manifest image in it has been
+ * validated, or, for the primary slot, as the installed manifest image is
+ * trusted.
+ */
+static struct {
+    uint8_t listed[BOOT_IMAGE_NUMBER];
+    uint8_t hash[BOOT_IMAGE_NUMBER][32];
+} bootutil_manifest[BOOT_NUM_SLOTS];
+
+void
+bootutil_manifest_clear(int slot)
+{
+    memset(&bootutil_manifest[slot], 0, sizeof(bootutil_manifest[slot]));
+}
+
+/*
+ * Record the image hashes listed in the protected TLVs of a manifest image,
+ * which must already have been validated.
+ * Return non-zero if the list is malformed, leaving the slot empty.
+ */
+int
+bootutil_manifest_load(int slot, struct image_header *hdr,
+                       const struct flash_area *fap)
+{
+    struct image_manifest_entry entry;
+    struct image_tlv_iter it;
+    uint32_t off;
+    uint16_t len;
+    int rc;
+
+    bootutil_manifest_clear(slot);
+
+    rc = bootutil_tlv_iter_begin(&it, hdr, fap, IMAGE_TLV_MANIFEST, true);
+    if (rc) {
+        return rc;
+    }
+
+    while (true) {
+        rc = bootutil_tlv_iter_next(&it, &off, &len, NULL);
+        if (rc < 0) {
+            break;
+        } else if (rc > 0) {
+            return 0;
+        }
+
+        if (len != sizeof(entry)) {
+            rc = -1;
+            break;
+        }
+
+        rc = bootutil_flash_read(fap, off, &entry, len);
+        if (rc) {
+            break;
+        }
+
+        if (entry.image_id >= BOOT_IMAGE_NUMBER ||
+            entry.image_id == BOOT_MANIFEST_IMAGE ||
+            bootutil_manifest[slot].listed[entry.image_id]) {
+            rc = -1;
+            break;
+        }
+
+        memcpy(bootutil_manifest[slot].hash[entry.image_id],
+               entry.image_hash, sizeof(entry.image_hash));
+        bootutil_manifest[slot].listed[entry.image_id] = 1;
+    }
+
+    bootutil_manifest_clear(slot);
+    return -1;
+}
+
+/*
+ * Return the hash the manifest image of a slot lists for an image, or NULL
+ * if it does not list it.
+ */
+const uint8_t *
+bootutil_manifest_hash(int slot, int image_index)
+{
+    if (slot < 0 || slot >= BOOT_NUM_SLOTS ||
+        image_index < 0 || image_index >= BOOT_IMAGE_NUMBER ||
+        !bootutil_manifest[slot].listed[image_index]) {
+        return NULL;
+    }
+
+    return bootutil_manifest[slot].hash[image_index];
+}
+
+/*
+ * Check the hash of an image against the manifests that may list it: the one
+ * of its own slot and, for an image in the secondary slot, the one installed
+ * in the primary slot.  The upgrade of a set may have been interrupted once
+ * the manifest image was installed, leaving the other images of the set
+ * pending in the secondary slot while the secondary slot of the manifest
+ * image no longer lists them.
+ * Return 1 if a manifest lists the image with this hash, 0 if none lists the
+ * image, or -1 if those listing it list another hash.
+ */
+static int
+bootutil_manifest_check(int slot, int image_index, const uint8_t *hash)
+{
+    const uint8_t *manifest_hash;
+    int rc;
+
+    rc = 0;
+    while (slot >= BOOT_PRIMARY_SLOT) {
+        manifest_hash = bootutil_manifest_hash(slot, image_index);
+        if (manifest_hash != NULL) {
+            if (memcmp(hash, manifest_hash, 32) == 0) {
+                return 1;
+            }
+            rc = -1;
+        }
+
+        slot = (slot == BOOT_SECONDARY_SLOT) ? BOOT_PRIMARY_SLOT : -1;
+    }
+
+    return rc;
+}
+#endif /* MCUBOOT_IMAGE_MANIFEST */
+
+/*
+ * Verify the TLVs of an image against an already computed image hash.
  * Return non-zero if image could not be validated/does not validate.
  */
 int
-bootutil_img_validate(struct enc_key_data *enc_state, int image_index,
-                      struct image_header *hdr, const struct flash_area *fap,
-                      uint8_t *tmp_buf, uint32_t tmp_buf_sz, uint8_t *seed,
-                      int seed_len, uint8_t *out_hash)
+bootutil_img_validate_hash(int image_index, struct image_header *hdr,
+                           const struct flash_area *fap, uint8_t *hash)
 {
     uint32_t off;
     uint16_t len;
@@ -321,7 +468,7 @@ bootutil_img_validate(struct enc_key_data *enc_state, int image_index,
 #endif /* EXPECTED_SIG_TLV */
     struct image_tlv_iter it;
     uint8_t buf[SIG_BUF_SIZE];
-    uint8_t hash[32];
+    const void *tlv;
     int rc;
 #ifdef MCUBOOT_HW_ROLLBACK_PROT
     uint32_t security_cnt = UINT32_MAX;
@@ -329,16 +476,6 @@ bootutil_img_validate(struct enc_key_data *enc_state, int image_index,
     int32_t security_counter_valid = 0;
 #endif
 
-    rc = bootutil_img_hash(enc_state, image_index, hdr, fap, tmp_buf,
-            tmp_buf_sz, hash, seed, seed_len);
-    if (rc) {
-        return rc;
-    }
-
-    if (out_hash) {
-        memcpy(out_hash, hash, 32);
-    }
-
     rc = bootutil_tlv_iter_begin(&it, hdr, fap, IMAGE_TLV_ANY, false);
     if (rc) {
         return rc;
@@ -361,14 +498,14 @@ bootutil_img_validate(struct enc_key_data *enc_state, int image_index,
              * Verify the SHA256 image hash.  This must always be
              * present.
              */
-            if (len != sizeof(hash)) {
+            if (len != 32) {
                 return -1;
             }
-            rc = flash_area_read(fap, off, buf, sizeof hash);
+            rc = bootutil_flash_ptr(fap, off, buf, 32, &tlv);
             if (rc) {
                 return rc;
             }
-            if (memcmp(hash, buf, sizeof(hash))) {
+            if (memcmp(hash, tlv, 32)) {
                 return -1;
             }
 
@@ -382,11 +519,11 @@ bootutil_img_validate(struct enc_key_data *enc_state, int image_index,
             if (len > 32) {
                 return -1;
             }
-            rc = flash_area_read(fap, off, buf, len);
+            rc = bootutil_flash_ptr(fap, off, buf, len, &tlv);
             if (rc) {
                 return rc;
             }
-            key_id = bootutil_find_key(buf, len);
+            key_id = bootutil_find_key(tlv, len);
             /*
              * The key may not be found, which is acceptable.  There
              * can be multiple signatures, each preceded by a key.
@@ -399,7 +536,7 @@ bootutil_img_validate(struct enc_key_data *enc_state, int image_index,
             if (len > sizeof(key_buf)) {
                 return -1;
             }
-            rc = flash_area_read(fap, off, key_buf, len);
+            rc = bootutil_flash_read(fap, off, key_buf, len);
             if (rc) {
                 return rc;
             }
@@ -418,11 +555,11 @@ bootutil_img_validate(struct enc_key_data *enc_state, int image_index,
             if (!EXPECTED_SIG_LEN(len) || len > sizeof(buf)) {
                 return -1;
             }
-            rc = flash_area_read(fap, off, buf, len);
+            rc = bootutil_flash_ptr(fap, off, buf, len, &tlv);
             if (rc) {
                 return -1;
             }
-            rc = bootutil_verify_sig(hash, sizeof(hash), buf, len, key_id);
+            rc = bootutil_verify_sig(hash, 32, tlv, len, key_id);
             if (rc == 0) {
                 valid_signature = 1;
             }
@@ -439,7 +576,7 @@ bootutil_img_validate(struct enc_key_data *enc_state, int image_index,
                 return -1;
             }
 
-            rc = flash_area_read(fap, off, &img_security_cnt, len);
+            rc = bootutil_flash_read(fap, off, &img_security_cnt, len);
             if (rc) {
                 return rc;
             }
@@ -463,6 +600,23 @@ bootutil_img_validate(struct enc_key_data *enc_state, int image_index,
         }
     }
 
+#ifdef MCUBOOT_IMAGE_MANIFEST
+    /* An image listed by a manifest must be the one listed, and needs no
+     * signature of its own.
+     */
+    rc = bootutil_manifest_check(
+            flash_area_id_to_multi_image_slot(image_index, fap->fa_id),
+            image_index, hash);
+    if (rc < 0) {
+        return -1;
+    }
+#ifdef EXPECTED_SIG_TLV
+    if (rc > 0) {
+        valid_signature = 1;
+    }
+#endif
+#endif
+
     if (!sha256_valid) {
         return -1;
 #ifdef EXPECTED_SIG_TLV
@@ -477,3 +631,164 @@ bootutil_img_validate(struct enc_key_data *enc_state, int image_index,
 
     return 0;
 }
+
+/*
+ * Verify the integrity of the image.
+ * Return non-zero if image could not be validated/does not validate.
+ */
+int
+bootutil_img_validate(struct enc_key_data *enc_state, int image_index,
+                      struct image_header *hdr, const struct flash_area *fap,
+                      uint8_t *tmp_buf, uint32_t tmp_buf_sz, uint8_t *seed,
+                      int seed_len, uint8_t *out_hash)
+{
+    uint8_t hash[32];
+    int rc;
+
+    rc = bootutil_img_hash(enc_state, image_index, hdr, fap, tmp_buf,
+            tmp_buf_sz, hash, seed, seed_len);
+    if (rc) {
+        return rc;
+    }
+
+    if (out_hash) {
+        memcpy(out_hash, hash, 32);
+    }
+
+    return bootutil_img_validate_hash(image_index, hdr, fap, hash);
+}
+
+#ifdef MCUBOOT_ENC_DECRYPT_ONCE
+/*
+ * Verify the TLVs of an image against the hash recorded in its SHA256 TLV,
+ * without hashing the image.  The caller must check that the image matches
+ * that hash before relying on it.
+ * Return non-zero if image could not be validated/does not validate.
+ */
+int
+bootutil_img_validate_tlv_hash(int image_index, struct image_header *hdr,
+                               const struct flash_area *fap)
+{
+    struct image_tlv_iter it;
+    uint8_t hash[32];
+    uint32_t off;
+    uint16_t len;
+    int rc;
+
+    rc = bootutil_tlv_iter_begin(&it, hdr, fap, IMAGE_TLV_SHA256, false);
+    if (rc) {
+        return rc;
+    }
+
+    rc = bootutil_tlv_iter_next(&it, &off, &len, NULL);
+    if (rc != 0 || len != sizeof(hash)) {
+        return -1;
+    }
+
+    rc = bootutil_flash_read(fap, off, hash, sizeof(hash));
+    if (rc) {
+        return rc;
+    }
+
+    return bootutil_img_validate_hash(image_index, hdr, fap, hash);
+}
+#endif /* MCUBOOT_ENC_DECRYPT_ONCE */
+
+#ifdef MCUBOOT_VALIDATED_MARKER
+/*
+ * Compute the value recorded in the validated marker of an image: a SHA256
+ * over the image header, the image hash from its SHA256 TLV and the hash of
+ * the key that signs it.  Only the header and TLVs are read, so this is cheap
+ * compared to hashing the image; it is not a substitute for validating it.
+ * Return non-zero if the image does not carry the TLVs needed.
+ */
+int
+bootutil_img_validated_binding(int image_index, struct image_header *hdr,
+                               const struct flash_area *fap, uint8_t *binding)
+{
+    bootutil_sha256_context sha256_ctx;
+    struct image_tlv_iter it;
+    uint32_t off;
+    uint16_t len;
+    uint16_t type;
+    uint8_t hash[32];
+    int sha256_valid = 0;
+#ifdef EXPECTED_SIG_TLV
+    int key_id = -1;
+#ifdef MCUBOOT_HW_KEY
+    uint8_t key_buf[SIG_BUF_SIZE + 24];
+#else
+    uint8_t key_hash[32];
+#endif
+#endif
+    int rc;
+
+    (void)image_index;
+
+    rc = bootutil_tlv_iter_begin(&it, hdr, fap, IMAGE_TLV_ANY, false);
+    if (rc) {
+        return rc;
+    }
+
+    while (true) {
+        rc = bootutil_tlv_iter_next(&it, &off, &len, &type);
+        if (rc < 0) {
+            return -1;
+        } else if (rc > 0) {
+            break;
+        }
+
+        if (type == IMAGE_TLV_SHA256 && !sha256_valid) {
+            if (len != sizeof(hash)) {
+                return -1;
+            }
+            rc = bootutil_flash_read(fap, off, hash, sizeof(hash));
+            if (rc) {
+                return rc;
+            }
+            sha256_valid = 1;
+#ifdef EXPECTED_SIG_TLV
+#ifndef MCUBOOT_HW_KEY
+        } else if (type == IMAGE_TLV_KEYHASH && key_id < 0) {
+            if (len > sizeof(key_hash)) {
+                return -1;
+            }
+            rc = bootutil_flash_read(fap, off, key_hash, len);
+            if (rc) {
+                return rc;
+            }
+            key_id = bootutil_find_key(key_hash, len);
+#else
+        } else if (type == IMAGE_TLV_PUBKEY && key_id < 0) {
+            if (len > sizeof(key_buf)) {
+                return -1;
+            }
+            rc = bootutil_flash_read(fap, off, key_buf, len);
+            if (rc) {
+                return rc;
+            }
+            key_id = bootutil_find_key(image_index, key_buf, len);
+#endif /* !MCUBOOT_HW_KEY */
+#endif /* EXPECTED_SIG_TLV */
+        }
+    }
+
+    if (!sha256_valid) {
+        return -1;
+    }
+
+    bootutil_sha256_init(&sha256_ctx);
+    bootutil_sha256_update(&sha256_ctx, hdr, sizeof(*hdr));
+    bootutil_sha256_update(&sha256_ctx, hash, sizeof(hash));
+#ifdef EXPECTED_SIG_TLV
+    if (key_id < 0 || key_id >= bootutil_key_cnt) {
+        return -1;
+    }
+    bootutil_sha256_update(&sha256_ctx, bootutil_keys[key_id].key,
+                           *bootutil_keys[key_id].len);
+#endif
+    bootutil_sha256_finish(&sha256_ctx, binding);
+
+    return 0;
+}
+#endif /* MCUBOOT_VALIDATED_MARKER */
@@ -78,7 +78,8 @@ static struct boot_loader_state boot_data;
  * Compute the total size of the given image.  Includes the size of
  * the TLVs.
  */
-#if !defined(MCUBOOT_OVERWRITE_ONLY) || defined(MCUBOOT_OVERWRITE_ONLY_FAST)
+#if (!defined(MCUBOOT_OVERWRITE_ONLY) && !defined(MCUBOOT_DIRECT_XIP)) || \
+    defined(MCUBOOT_OVERWRITE_ONLY_FAST) || defined(MCUBOOT_VALIDATED_MARKER)
 static int
 boot_read_image_size(struct boot_loader_state *state, int slot, uint32_t *size)
 {
@@ -295,12 +296,21 @@ boot_status_reset(struct boot_status *bs)
     memset(&bs->enckey, 0xff, BOOT_NUM_SLOTS * BOOT_ENC_KEY_SIZE);
 #if MCUBOOT_SWAP_SAVE_ENCTLV
     memset(&bs->enctlv, 0xff, BOOT_NUM_SLOTS * BOOT_ENC_TLV_ALIGN_SIZE);
+#elif MCUBOOT_SWAP_SEAL_ENCKEY
+    memset(&bs->enckey_sealed, 0xff,
+           BOOT_NUM_SLOTS * BOOT_ENC_SEALED_ALIGN_SIZE);
 #endif
 #endif /* MCUBOOT_ENC_IMAGES */
 
     bs->use_scratch = 0;
     bs->swap_size = 0;
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+    bs->scratch_off = 0;
+#endif
     bs->source = 0;
+#ifdef MCUBOOT_SWAP_SKIP_IDENTICAL
+    bs->skipped = 0;
+#endif
 
     bs->op = BOOT_STATUS_OP_MOVE;
     bs->idx = BOOT_STATUS_IDX_0;
@@ -365,6 +375,11 @@ boot_write_status(const struct boot_loader_state *state, struct boot_status *bs)
     erased_val = flash_area_erased_val(fap);
     memset(buf, erased_val, BOOT_MAX_ALIGN);
     buf[0] = bs->state;
+#ifdef MCUBOOT_SWAP_SKIP_IDENTICAL
+    if (bs->skipped) {
+        buf[0] |= BOOT_STATUS_SKIPPED;
+    }
+#endif
 
     rc = flash_area_write(fap, off, buf, align);
     if (rc != 0) {
@@ -379,6 +394,204 @@ done:
     return rc;
 }
 
+#ifdef MCUBOOT_VALIDATED_MARKER
+/**
+ * Checks whether the image in the primary slot can be booted without hashing
+ * it, because it still matches the marker written when it was last fully
+ * validated.  With MCUBOOT_VALIDATED_MARKER_MAX_BOOTS set, every boot accepted
+ * this way is recorded in the trailer; once that many have been recorded the
+ * marker is no longer trusted and the image has to be validated again.
+ *
+ * @return                      0 if the marker is valid for this boot;
+ *                              nonzero if the image must be validated.
+ */
+static int
+boot_check_validated_marker(struct boot_loader_state *state,
+                            struct image_header *hdr,
+                            const struct flash_area *fap)
+{
+    uint8_t binding[BOOT_VALIDATED_SZ];
+    uint8_t marker[BOOT_VALIDATED_SZ];
+    uint32_t boots;
+    int rc;
+
+    rc = boot_read_validated(fap, marker, &boots);
+    if (rc != 0) {
+        return -1;
+    }
+#if MCUBOOT_VALIDATED_MARKER_MAX_BOOTS > 0
+    if (boots >= MCUBOOT_VALIDATED_MARKER_MAX_BOOTS) {
+        return -1;
+    }
+#endif
+
+    rc = bootutil_img_validated_binding(BOOT_CURR_IMG(state), hdr, fap,
+                                        binding);
+    if (rc != 0 || memcmp(binding, marker, BOOT_VALIDATED_SZ) != 0) {
+        return -1;
+    }
+
+#if MCUBOOT_VALIDATED_MARKER_MAX_BOOTS > 0
+    /* Record the boot before trusting the marker, so that a failure to do
+     * so cannot extend the number of boots it is used for.
+     */
+    rc = boot_write_validated_boot(fap, boots);
+    if (rc != 0) {
+        return -1;
+    }
+#endif
+
+    return 0;
+}
+
+/**
+ * Erases the trailer of the primary slot so a new validated marker can be
+ * written, keeping the flags that are still meaningful.  This is only done
+ * when it cannot lose any state: the image is not pending a revert, and the
+ * trailer sectors hold no part of the image.
+ *
+ * @return                      0 on success; nonzero if the trailer was left
+ *                                  untouched.
+ */
+static int
+boot_reset_validated_marker(struct boot_loader_state *state,
+                            const struct flash_area *fap, uint32_t img_sz)
+{
+    struct boot_swap_state swap_state;
+    uint32_t trailer_sz;
+    uint32_t total_sz;
+    size_t first_sector;
+    int rc;
+
+    rc = boot_read_swap_state(fap, &swap_state);
+    if (rc != 0) {
+        return rc;
+    }
+
+#ifndef MCUBOOT_OVERWRITE_ONLY
+    if (swap_state.magic == BOOT_MAGIC_GOOD &&
+            swap_state.image_ok != BOOT_FLAG_SET) {
+        /* The image is still being tested. */
+        return -1;
+    }
+#endif
+
+    trailer_sz = boot_trailer_sz(BOOT_WRITE_SZ(state));
+    first_sector = boot_img_num_sectors(state, BOOT_PRIMARY_SLOT);
+    total_sz = 0;
+    while (total_sz < trailer_sz && first_sector > 0) {
+        first_sector--;
+        total_sz += boot_img_sector_size(state, BOOT_PRIMARY_SLOT,
+                                         first_sector);
+    }
+
+    if (boot_img_sector_off(state, BOOT_PRIMARY_SLOT, first_sector) < img_sz) {
+        return -1;
+    }
+
+    BOOT_LOG_DBG("erasing primary trailer to renew the validated marker");
+    rc = boot_erase_region(fap,
+            boot_img_sector_off(state, BOOT_PRIMARY_SLOT, first_sector),
+            total_sz);
+    if (rc != 0) {
+        return rc;
+    }
+
+    /* The magic is written last, as an interrupted rewrite must not leave a
+     * trailer that looks like a pending swap.
+     */
+    if (swap_state.image_ok == BOOT_FLAG_SET) {
+        rc = boot_write_image_ok(fap);
+        if (rc != 0) {
+            return rc;
+        }
+    }
+    if (swap_state.copy_done == BOOT_FLAG_SET) {
+        rc = boot_write_copy_done(fap);
+        if (rc != 0) {
+            return rc;
+        }
+    }
+    if (swap_state.magic == BOOT_MAGIC_GOOD) {
+        rc = boot_write_magic(fap);
+    }
+
+    return rc;
+}
+
+/**
+ * Writes the validated marker of the image in the primary slot after it has
+ * been fully validated, renewing a marker that is stale or used up.
+ */
+static void
+boot_update_validated_marker(struct boot_loader_state *state,
+                             struct image_header *hdr,
+                             const struct flash_area *fap)
+{
+    uint8_t binding[BOOT_VALIDATED_SZ];
+    uint8_t marker[BOOT_VALIDATED_SZ];
+    uint32_t img_sz;
+    uint32_t boots;
+    int rc;
+
+    rc = boot_read_image_size(state, BOOT_PRIMARY_SLOT, &img_sz);
+    if (rc != 0 || img_sz > boot_validated_boots_off(fap)) {
+        /* No room for the marker next to this image. */
+        return;
+    }
+
+    rc = bootutil_img_validated_binding(BOOT_CURR_IMG(state), hdr, fap,
+                                        binding);
+    if (rc != 0) {
+        return;
+    }
+
+    rc = boot_read_validated(fap, marker, &boots);
+    if (rc < 0) {
+        return;
+    }
+
+    if (rc == 0) {
+#if MCUBOOT_VALIDATED_MARKER_MAX_BOOTS > 0
+        if (memcmp(binding, marker, BOOT_VALIDATED_SZ) == 0 &&
+                boots < MCUBOOT_VALIDATED_MARKER_MAX_BOOTS) {
+            return;
+        }
+#else
+        if (memcmp(binding, marker, BOOT_VALIDATED_SZ) == 0) {
+            return;
+        }
+#endif
+
+        rc = boot_reset_validated_marker(state, fap, img_sz);
+        if (rc != 0) {
+            return;
+        }
+    }
+
+    rc = boot_write_validated(fap, binding);
+    if (rc != 0) {
+        BOOT_LOG_WRN("Failed to write the validated marker; Image=%u",
+                     BOOT_CURR_IMG(state));
+    }
+}
+#endif /* MCUBOOT_VALIDATED_MARKER */
+
+#ifdef MCUBOOT_ENC_DECRYPT_ONCE
+/*
+ * Encrypted images are only decrypted once, as they are installed: before
+ * the upgrade, the signature of the hash found in the TLVs is checked, and
+ * the image is matched to that hash as it is written to the primary slot,
+ * see boot_check_installed_image().  Compressed images are still hashed
+ * first, as the hash of what is installed is checked while decompressing.
+ */
+static bool
+boot_is_decrypted_once(const struct image_header *hdr)
+{
+    return IS_ENCRYPTED(hdr) && !(hdr->ih_flags & IMAGE_F_COMPRESSED);
+}
+#endif
+
 /*
  * Validate image hash/signature and optionally the security counter in a slot.
  */
@@ -411,11 +624,44 @@ boot_image_check(struct boot_loader_state *state, struct image_header *hdr,
     }
 #endif
 
-    if (bootutil_img_validate(BOOT_CURR_ENC(state), image_index, hdr, fap, tmpbuf,
-                              BOOT_TMPBUF_SZ, NULL, 0, NULL)) {
+#ifdef MCUBOOT_ENC_DECRYPT_ONCE
+    if (MUST_DECRYPT(fap, image_index, hdr) && boot_is_decrypted_once(hdr)) {
+        rc = bootutil_img_validate_tlv_hash(image_index, hdr, fap);
+        return (rc != 0) ? BOOT_EBADIMAGE : 0;
+    }
+#endif
+
+#ifdef MCUBOOT_VALIDATED_MARKER
+    if (fap->fa_id == FLASH_AREA_IMAGE_PRIMARY(image_index) &&
+            boot_check_validated_marker(state, hdr, fap) == 0) {
+        return 0;
+    }
+#endif
+
+#ifdef MCUBOOT_HASH_ON_COPY
+    if (fap->fa_id == FLASH_AREA_IMAGE_PRIMARY(image_index) &&
+            BOOT_CURR_COPY_HASH(state).state == BOOT_COPY_HASH_DONE) {
+        /* The image was hashed while being copied to the primary slot, so
+         * only its TLVs have to be read back.
+         */
+        rc = bootutil_img_validate_hash(image_index, hdr, fap,
+                                        BOOT_CURR_COPY_HASH(state).hash);
+    } else
+#endif
+    {
+        rc = bootutil_img_validate(BOOT_CURR_ENC(state), image_index, hdr,
+                                   fap, tmpbuf, BOOT_TMPBUF_SZ, NULL, 0, NULL);
+    }
+    if (rc != 0) {
         return BOOT_EBADIMAGE;
     }
 
+#ifdef MCUBOOT_VALIDATED_MARKER
+    if (fap->fa_id == FLASH_AREA_IMAGE_PRIMARY(image_index)) {
+        boot_update_validated_marker(state, hdr, fap);
+    }
+#endif
+
     return 0;
 }
 
@@ -474,6 +720,185 @@ boot_is_header_valid(const struct image_header *hdr, const struct flash_area *fa
     return true;
 }
 
+#ifdef MCUBOOT_COMPRESSED_IMAGES
+static struct boot_decomp boot_decomp_ctx;
+
+/*
+ * Reads the size and the hash of the decompressed image from the protected
+ * TLVs of a compressed image.
+ */
+static int
+boot_read_decomp_info(const struct image_header *hdr,
+                      const struct flash_area *fap, uint32_t *size,
+                      uint8_t *hash)
+{
+    struct image_tlv_iter it;
+    uint32_t off;
+    uint16_t len;
+    int rc;
+
+    rc = bootutil_tlv_iter_begin(&it, hdr, fap, IMAGE_TLV_DECOMP_SIZE, true);
+    if (rc) {
+        return BOOT_EBADIMAGE;
+    }
+
+    rc = bootutil_tlv_iter_next(&it, &off, &len, NULL);
+    if (rc != 0 || len != sizeof(*size)) {
+        return BOOT_EBADIMAGE;
+    }
+
+    if (flash_area_read(fap, off, size, len) != 0) {
+        return BOOT_EFLASH;
+    }
+
+    rc = bootutil_tlv_iter_begin(&it, hdr, fap, IMAGE_TLV_DECOMP_SHA256, true);
+    if (rc) {
+        return BOOT_EBADIMAGE;
+    }
+
+    rc = bootutil_tlv_iter_next(&it, &off, &len, NULL);
+    if (rc != 0 || len != 32) {
+        return BOOT_EBADIMAGE;
+    }
+
+    if (flash_area_read(fap, off, hash, len) != 0) {
+        return BOOT_EFLASH;
+    }
+
+    return 0;
+}
+
+/*
+ * Checks what can be of a compressed image without decompressing it: its
+ * protected TLVs, that the decompressed image fits in the primary slot, and
+ * that the payload starts with literals, as an LZ4 block must.  The payload
+ * is covered by the signature, so the rest is only checked while it is
+ * decompressed to the primary slot.
+ */
+static int
+boot_check_compressed(struct boot_loader_state *state,
+                      const struct image_header *hdr)
+{
+    const struct flash_area *fap;
+    uint8_t hash[32];
+    uint32_t size;
+    uint8_t token;
+    int rc;
+
+    fap = BOOT_IMG_AREA(state, BOOT_SECONDARY_SLOT);
+    rc = boot_read_decomp_info(hdr, fap, &size, hash);
+    if (rc != 0) {
+        return rc;
+    }
+
+    if (size < IMAGE_HEADER_SIZE ||
+        size > BOOT_IMG_AREA(state, BOOT_PRIMARY_SLOT)->fa_size ||
+        hdr->ih_img_size == 0) {
+        return BOOT_EBADIMAGE;
+    }
+
+    if (flash_area_read(fap, hdr->ih_hdr_size, &token, sizeof(token)) != 0) {
+        return BOOT_EFLASH;
+    }
+    if ((token >> 4) == 0) {
+        return BOOT_EBADIMAGE;
+    }
+
+    return 0;
+}
+
+/**
+ * Decompresses the image in the secondary slot to the primary slot, and
+ * checks the result against the size and hash given in its protected TLVs.
+ * The primary slot is left without a valid image if this fails.
+ *
+ * @param fap_dst               The area to write the image to.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+static int
+boot_decompress_image(struct boot_loader_state *state,
+                      const struct flash_area *fap_dst)
+{
+    const struct flash_area *fap_src;
+    struct image_header *hdr;
+    uint8_t expected[32];
+    uint8_t hash[32];
+    uint32_t size;
+    int rc;
+
+    fap_src = BOOT_IMG_AREA(state, BOOT_SECONDARY_SLOT);
+    hdr = boot_img_hdr(state, BOOT_SECONDARY_SLOT);
+
+    rc = boot_read_decomp_info(hdr, fap_src, &size, expected);
+    if (rc != 0) {
+        return rc;
+    }
+
+    boot_decomp_init(&boot_decomp_ctx, fap_dst, 0, size);
+    /* boot_copy_region() feeds the payload to the decompressor, and stops at
+     * the first error.
+     */
+    rc = boot_copy_region(state, fap_src, fap_dst, hdr->ih_hdr_size, 0,
+                          hdr->ih_img_size);
+    if (rc == 0) {
+        rc = boot_decomp_finish(&boot_decomp_ctx, hash);
+    }
+    boot_trailer_cache_invalidate(fap_dst, 0, size);
+
+    if (rc != 0 || boot_decomp_ctx.out_sz != size ||
+        memcmp(hash, expected, sizeof(hash)) != 0) {
+        return BOOT_EBADIMAGE;
+    }
+
+    return 0;
+}
+#endif /* MCUBOOT_COMPRESSED_IMAGES */
+
+/*
+ * Check that the image in a slot is not compressed, or that it is a
+ * compressed image which can be installed to the primary slot.
+ */
+static bool
+boot_is_compressed_usable(struct boot_loader_state *state, int slot,
+                          const struct image_header *hdr)
+{
+    if (!(hdr->ih_flags & IMAGE_F_COMPRESSED)) {
+        return true;
+    }
+
+#ifdef MCUBOOT_COMPRESSED_IMAGES
+    return slot != BOOT_PRIMARY_SLOT && !IS_ENCRYPTED(hdr) &&
+           !(hdr->ih_flags & IMAGE_F_DELTA) &&
+           boot_check_compressed(state, hdr) == 0;
+#else
+    (void)state;
+    (void)slot;
+    return false;
+#endif
+}
+
+/*
+ * Check that the image in a slot is not a patch, or that it is a patch which
+ * can be applied to the image in the primary slot.
+ */
+static bool
+boot_is_delta_usable(struct boot_loader_state *state, int slot,
+                     const struct image_header *hdr)
+{
+    if (!(hdr->ih_flags & IMAGE_F_DELTA)) {
+        return true;
+    }
+
+#ifdef MCUBOOT_DELTA_UPGRADE
+    return slot != BOOT_PRIMARY_SLOT && swap_delta_check(state) == 0;
+#else
+    (void)state;
+    (void)slot;
+    return false;
+#endif
+}
+
 /*
  * Check that a memory area consists of a given value.
  */
@@ -516,42 +941,98 @@ boot_check_header_erased(struct boot_loader_state *state, int slot)
     return 0;
 }
 
-#if (BOOT_IMAGE_NUMBER > 1) || \
+#if (BOOT_IMAGE_NUMBER > 1) || defined(MCUBOOT_DIRECT_XIP) || \
     (defined(MCUBOOT_OVERWRITE_ONLY) && defined(MCUBOOT_DOWNGRADE_PREVENTION))
 /**
- * Check if the version of the image is not older than required.
+ * Compares two image versions.
  *
- * @param req         Required minimal image version.
- * @param ver         Version of the image to be checked.
+ * @param ver1        First version.
+ * @param ver2        Second version.
+ * @param build_num   Whether the build numbers are compared, when the rest of
+ *                        the versions are equal.
  *
- * @return            0 if the version is sufficient, nonzero otherwise.
+ * @return            Positive if ver1 is newer than ver2, negative if it is
+ *                        older, 0 if they are equal.
  */
 static int
-boot_is_version_sufficient(struct image_version *req,
-                           struct image_version *ver)
+boot_version_cmp(const struct image_version *ver1,
+                 const struct image_version *ver2, bool build_num)
 {
-    if (ver->iv_major > req->iv_major) {
-        return 0;
+    if (ver1->iv_major != ver2->iv_major) {
+        return (ver1->iv_major > ver2->iv_major) ? 1 : -1;
     }
-    if (ver->iv_major < req->iv_major) {
-        return BOOT_EBADVERSION;
+    if (ver1->iv_minor != ver2->iv_minor) {
+        return (ver1->iv_minor > ver2->iv_minor) ? 1 : -1;
     }
-    /* The major version numbers are equal. */
-    if (ver->iv_minor > req->iv_minor) {
-        return 0;
-    }
-    if (ver->iv_minor < req->iv_minor) {
-        return BOOT_EBADVERSION;
+    if (ver1->iv_revision != ver2->iv_revision) {
+        return (ver1->iv_revision > ver2->iv_revision) ? 1 : -1;
     }
-    /* The minor version numbers are equal. */
-    if (ver->iv_revision < req->iv_revision) {
-        return BOOT_EBADVERSION;
+    if (build_num && ver1->iv_build_num != ver2->iv_build_num) {
+        return (ver1->iv_build_num > ver2->iv_build_num) ? 1 : -1;
     }
 
     return 0;
 }
 #endif
 
+/*
+ * Check that the image in a slot is not the manifest image, or that it is and
+ * the image hashes it lists can be recorded, for the other images of the slot
+ * to be checked against them.
+ */
+static bool
+boot_is_manifest_usable(struct boot_loader_state *state, int slot,
+                        struct image_header *hdr, const struct flash_area *fap)
+{
+#ifdef MCUBOOT_IMAGE_MANIFEST
+    if (BOOT_CURR_IMG(state) != BOOT_MANIFEST_IMAGE) {
+        return true;
+    }
+
+    if (bootutil_manifest_load(slot, hdr, fap) != 0) {
+        BOOT_LOG_ERR("Invalid manifest in the %s slot",
+                     (slot == BOOT_PRIMARY_SLOT) ? "primary" : "secondary");
+        return false;
+    }
+#else
+    (void)state;
+    (void)slot;
+    (void)hdr;
+    (void)fap;
+#endif
+
+    return true;
+}
+
+#ifdef MCUBOOT_IMAGE_MANIFEST
+/*
+ * Record the image hashes listed by the manifest image installed in the
+ * primary slot, which is trusted as installed.  Once a reset interrupted the
+ * upgrade of a set after its manifest image was installed, the other images
+ * still pending in the secondary slot are only listed there.
+ */
+static void
+boot_load_installed_manifest(struct boot_loader_state *state)
+{
+    struct image_header *hdr;
+    const struct flash_area *fap;
+
+    if (BOOT_CURR_IMG(state) != BOOT_MANIFEST_IMAGE) {
+        return;
+    }
+
+    hdr = boot_img_hdr(state, BOOT_PRIMARY_SLOT);
+    fap = BOOT_IMG_AREA(state, BOOT_PRIMARY_SLOT);
+    if (boot_check_header_erased(state, BOOT_PRIMARY_SLOT) == 0 ||
+        !boot_is_header_valid(hdr, fap)) {
+        bootutil_manifest_clear(BOOT_PRIMARY_SLOT);
+        return;
+    }
+
+    (void)bootutil_manifest_load(BOOT_PRIMARY_SLOT, hdr, fap);
+}
+#endif
+
 /*
  * Check that there is a valid image in a slot
  *
@@ -575,6 +1056,12 @@ boot_validate_slot(struct boot_loader_state *state, int slot,
         return -1;
     }
 
+#ifdef MCUBOOT_IMAGE_MANIFEST
+    if (BOOT_CURR_IMG(state) == BOOT_MANIFEST_IMAGE) {
+        bootutil_manifest_clear(slot);
+    }
+#endif
+
     hdr = boot_img_hdr(state, slot);
     if (boot_check_header_erased(state, slot) == 0 ||
         (hdr->ih_flags & IMAGE_F_NON_BOOTABLE)) {
@@ -586,11 +1073,12 @@ boot_validate_slot(struct boot_loader_state *state, int slot,
 #if defined(MCUBOOT_OVERWRITE_ONLY) && defined(MCUBOOT_DOWNGRADE_PREVENTION)
     if (slot != BOOT_PRIMARY_SLOT) {
         /* Check if version of secondary slot is sufficient */
-        rc = boot_is_version_sufficient(
-                &boot_img_hdr(state, BOOT_PRIMARY_SLOT)->ih_ver,
-                &boot_img_hdr(state, BOOT_SECONDARY_SLOT)->ih_ver);
-        if (rc != 0 && boot_check_header_erased(state, BOOT_PRIMARY_SLOT)) {
+        if (boot_version_cmp(
+                &boot_img_hdr(state, BOOT_SECONDARY_SLOT)->ih_ver,
+                &boot_img_hdr(state, BOOT_PRIMARY_SLOT)->ih_ver, false) < 0 &&
+            boot_check_header_erased(state, BOOT_PRIMARY_SLOT)) {
             BOOT_LOG_ERR("insufficient version in secondary slot");
+            boot_trailer_cache_invalidate(fap, 0, fap->fa_size);
             flash_area_erase(fap, 0, fap->fa_size);
             /* Image in the secondary slot does not satisfy version requirement.
              * Erase the image and continue booting from the primary slot.
@@ -601,8 +1089,13 @@ boot_validate_slot(struct boot_loader_state *state, int slot,
     }
 #endif
 
-    if (!boot_is_header_valid(hdr, fap) || boot_image_check(state, hdr, fap, bs)) {
+    if (!boot_is_header_valid(hdr, fap) ||
+        !boot_is_delta_usable(state, slot, hdr) ||
+        boot_image_check(state, hdr, fap, bs) ||
+        !boot_is_compressed_usable(state, slot, hdr) ||
+        !boot_is_manifest_usable(state, slot, hdr, fap)) {
         if (slot != BOOT_PRIMARY_SLOT) {
+            boot_trailer_cache_invalidate(fap, 0, fap->fa_size);
             flash_area_erase(fap, 0, fap->fa_size);
             /* Image in the secondary slot is invalid. Erase the image and
              * continue booting from the primary slot.
@@ -624,6 +1117,7 @@ out:
     return rc;
 }
 
+#ifndef MCUBOOT_DIRECT_XIP
 /**
  * Determines which swap operation to perform, if any.  If it is determined
  * that a swap operation is required, the image in the secondary slot is checked
@@ -640,6 +1134,14 @@ boot_validated_swap_type(struct boot_loader_state *state,
     int rc;
 
     swap_type = boot_swap_type_multi(BOOT_CURR_IMG(state));
+#ifdef MCUBOOT_SWAP_USING_RAM
+    if (swap_type == BOOT_SWAP_TYPE_TEST) {
+        /* The image swapped out cannot be relied upon to revert to. */
+        BOOT_LOG_ERR("Image %d: test upgrades are not supported",
+                     BOOT_CURR_IMG(state));
+        swap_type = BOOT_SWAP_TYPE_NONE;
+    }
+#endif
     if (BOOT_IS_UPGRADE(swap_type)) {
         /* Boot loader wants to switch to the secondary slot.
          * Ensure image is valid.
@@ -654,6 +1156,7 @@ boot_validated_swap_type(struct boot_loader_state *state,
 
     return swap_type;
 }
+#endif /* !MCUBOOT_DIRECT_XIP */
 
 #ifdef MCUBOOT_HW_ROLLBACK_PROT
 /**
@@ -701,7 +1204,11 @@ done:
 #endif /* MCUBOOT_HW_ROLLBACK_PROT */
 
 /**
- * Erases a region of flash.
+ * Erases a region of flash, which may span many sectors.  Callers should erase
+ * contiguous sectors with a single call, so that the flash driver can use its
+ * larger erase commands.  With MCUBOOT_FLASH_BLOCK_ERASE, the region is split
+ * so that its middle part starts and ends on the erase blocks reported by
+ * flash_area_erase_block_size().
  *
  * @param flash_area           The flash_area containing the region to erase.
  * @param off                   The offset within the flash area to start the
@@ -713,13 +1220,255 @@ done:
 int
 boot_erase_region(const struct flash_area *fap, uint32_t off, uint32_t sz)
 {
+#ifdef MCUBOOT_FLASH_BLOCK_ERASE
+    uint32_t blk_sz;
+    uint32_t head;
+    uint32_t body;
+    int rc;
+#endif
+
+    boot_trailer_cache_invalidate(fap, off, sz);
+
+#ifdef MCUBOOT_FLASH_BLOCK_ERASE
+    blk_sz = flash_area_erase_block_size(fap);
+    if (blk_sz != 0) {
+        /* Blocks are aligned on the device, not on the flash area. */
+        head = (blk_sz - (fap->fa_off + off) % blk_sz) % blk_sz;
+        if (head < sz && sz - head >= blk_sz) {
+            body = (sz - head) / blk_sz * blk_sz;
+            if (head > 0) {
+                rc = flash_area_erase(fap, off, head);
+                if (rc != 0) {
+                    return rc;
+                }
+            }
+            rc = flash_area_erase(fap, off + head, body);
+            if (rc != 0 || head + body == sz) {
+                return rc;
+            }
+            MCUBOOT_WATCHDOG_FEED();
+            return flash_area_erase(fap, off + head + body, sz - head - body);
+        }
+    }
+#endif
+
     return flash_area_erase(fap, off, sz);
 }
 
+#ifdef MCUBOOT_FLASH_ASYNC
+/**
+ * Waits for the write or erase started on a flash area, if any, polling it
+ * and feeding the watchdog while it runs.
+ *
+ * @param fap                   The flash_area.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+static int
+boot_flash_wait(const struct flash_area *fap)
+{
+    while (flash_area_poll(fap)) {
+        MCUBOOT_WATCHDOG_FEED();
+    }
+
+    return flash_area_wait(fap);
+}
+#endif
+
+/**
+ * Erases a region of flash that boot_copy_region() then programs.  With
+ * MCUBOOT_FLASH_ASYNC, the erase is only started: boot_copy_region() waits
+ * for it before its first write, having read the first chunk meanwhile.
+ *
+ * @param flash_area           The flash_area containing the region to erase.
+ * @param off                   The offset within the flash area to start the
+ *                                  erase.
+ * @param sz                    The number of bytes to erase.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+int
+boot_erase_region_start(const struct flash_area *fap, uint32_t off,
+                        uint32_t sz)
+{
+#ifdef MCUBOOT_FLASH_ASYNC
+    int rc;
+
+    boot_trailer_cache_invalidate(fap, off, sz);
+    rc = boot_flash_wait(fap);
+    if (rc != 0) {
+        return rc;
+    }
+    return flash_area_erase_start(fap, off, sz);
+#else
+    return boot_erase_region(fap, off, sz);
+#endif
+}
+
+#ifdef MCUBOOT_HASH_ON_COPY
+/**
+ * Feeds a chunk that is about to be written by boot_copy_region() into the
+ * running hash of the image being installed in the primary slot.
+ *
+ * Hashing starts when the first chunk of the secondary slot is copied to the
+ * start of the primary slot, and the digest stays usable only while the rest
+ * of the image follows in order from the secondary slot.  Any other write to
+ * the primary slot (swap using scratch, moving sectors up, or a swap resumed
+ * after a reset) drops the digest, so the image is hashed from flash as usual.
+ *
+ * @param fap_src               The area the chunk was read from.
+ * @param fap_dst               The area the chunk is written to.
+ * @param off                   The offset within fap_dst of the chunk.
+ * @param buf                   The (decrypted) chunk data.
+ * @param len                   The number of bytes in the chunk.
+ */
+static void
+boot_copy_hash_update(struct boot_loader_state *state,
+                      const struct flash_area *fap_src,
+                      const struct flash_area *fap_dst,
+                      uint32_t off, const uint8_t *buf, uint32_t len)
+{
+    struct boot_copy_hash *ch;
+    struct image_header hdr;
+    uint8_t image_index;
+    uint32_t blk_sz;
+
+    image_index = BOOT_CURR_IMG(state);
+    ch = &BOOT_CURR_COPY_HASH(state);
+
+    if (fap_dst->fa_id != FLASH_AREA_IMAGE_PRIMARY(image_index)) {
+        return;
+    }
+
+    if (fap_src->fa_id == FLASH_AREA_IMAGE_SECONDARY(image_index) &&
+            off == 0) {
+        ch->state = BOOT_COPY_HASH_NONE;
+        if (len < sizeof(hdr)) {
+            return;
+        }
+
+        memcpy(&hdr, buf, sizeof(hdr));
+        if (hdr.ih_magic != IMAGE_MAGIC) {
+            return;
+        }
+
+        ch->size = hdr.ih_hdr_size;
+        if (!boot_u32_safe_add(&ch->size, ch->size, hdr.ih_img_size) ||
+            !boot_u32_safe_add(&ch->size, ch->size,
+                               hdr.ih_protect_tlv_size)) {
+            return;
+        }
+
+        bootutil_sha256_init(&ch->sha256_ctx);
+        ch->off = 0;
+        ch->state = BOOT_COPY_HASH_RUNNING;
+    }
+
+    if (ch->state == BOOT_COPY_HASH_NONE) {
+        return;
+    }
+
+    if (fap_src->fa_id != FLASH_AREA_IMAGE_SECONDARY(image_index) ||
+            off != ch->off) {
+        ch->state = BOOT_COPY_HASH_NONE;
+        return;
+    }
+
+    if (ch->state == BOOT_COPY_HASH_RUNNING) {
+        blk_sz = ch->size - off;
+        if (blk_sz > len) {
+            blk_sz = len;
+        }
+        bootutil_sha256_update(&ch->sha256_ctx, buf, blk_sz);
+        if (off + blk_sz == ch->size) {
+            bootutil_sha256_finish(&ch->sha256_ctx, ch->hash);
+            ch->state = BOOT_COPY_HASH_DONE;
+        }
+    }
+
+    ch->off += len;
+}
+#endif /* MCUBOOT_HASH_ON_COPY */
+
+/**
+ * Returns the size of the next chunk of a copy of sz bytes, bytes_copied of
+ * which are already done.
+ */
+static uint32_t
+boot_copy_chunk_sz(uint32_t sz, uint32_t bytes_copied)
+{
+    if (sz - bytes_copied > MCUBOOT_COPY_BUF_SIZE) {
+        return MCUBOOT_COPY_BUF_SIZE;
+    }
+    return sz - bytes_copied;
+}
+
+#ifdef MCUBOOT_ENC_IMAGES
+/**
+ * Encrypts or decrypts, in place, sz bytes of an image read from offset off
+ * of its slot.  The header and the TLVs are stored in clear and left as they
+ * are.
+ *
+ * @param fap                   The area whose key is used.
+ * @param hdr                   The header of the image.
+ * @param off                   The offset of the data within the slot.
+ * @param buf                   The data to encrypt or decrypt.
+ * @param sz                    The number of bytes in buf.
+ */
+void
+boot_encrypt_region(struct boot_loader_state *state,
+                    const struct flash_area *fap,
+                    const struct image_header *hdr, uint32_t off,
+                    uint8_t *buf, uint32_t sz)
+{
+    uint32_t tlv_off;
+    size_t blk_off;
+    uint32_t idx;
+    uint32_t blk_sz;
+
+    if (!IS_ENCRYPTED(hdr)) {
+        return;
+    }
+
+    idx = 0;
+    if (off < hdr->ih_hdr_size) {
+        /* do not decrypt header, which may span several chunks */
+        idx = hdr->ih_hdr_size - off;
+        if (idx > sz) {
+            idx = sz;
+        }
+        blk_off = 0;
+    } else {
+        blk_off = (off - hdr->ih_hdr_size) & 0xf;
+    }
+    blk_sz = sz - idx;
+    tlv_off = BOOT_TLV_OFF(hdr);
+    if (off + sz > tlv_off) {
+        /* do not decrypt TLVs */
+        if (off + idx >= tlv_off) {
+            blk_sz = 0;
+        } else {
+            blk_sz = tlv_off - (off + idx);
+        }
+    }
+    if (blk_sz > 0) {
+        boot_encrypt(BOOT_CURR_ENC(state), BOOT_CURR_IMG(state), fap,
+                (off + idx) - hdr->ih_hdr_size, blk_sz, blk_off, &buf[idx]);
+    }
+}
+#endif
+
 /**
  * Copies the contents of one flash region to another.  You must erase the
  * destination region prior to calling this function.
  *
+ * The region is copied MCUBOOT_COPY_BUF_SIZE bytes at a time.  With
+ * MCUBOOT_COPY_DOUBLE_BUF, the read of the next chunk is started with
+ * flash_area_read_start() before the current one is programmed, so a flash
+ * backend that reads asynchronously overlaps both.  With MCUBOOT_FLASH_ASYNC,
+ * each chunk is programmed with flash_area_write_start() instead, while the
+ * next one is read, decrypted and hashed; all writes are complete on return.
+ *
  * @param flash_area_id_src     The ID of the source flash area.
  * @param flash_area_id_dst     The ID of the destination flash area.
  * @param off_src               The offset within the source flash area to
@@ -737,36 +1486,121 @@ boot_copy_region(struct boot_loader_state *state,
                  uint32_t off_src, uint32_t off_dst, uint32_t sz)
 {
     uint32_t bytes_copied;
-    int chunk_sz;
+    uint32_t chunk_sz;
+    uint8_t *buf;
     int rc;
+#ifdef MCUBOOT_COPY_DOUBLE_BUF
+    uint32_t next_sz;
+#endif
+#if defined(MCUBOOT_COPY_DOUBLE_BUF) || defined(MCUBOOT_FLASH_ASYNC)
+    uint8_t cur;
+#endif
+#ifdef MCUBOOT_FLASH_ASYNC
+    bool same_area;
+#endif
+#ifdef MCUBOOT_COMPRESSED_IMAGES
+    bool decomp;
+#endif
 #ifdef MCUBOOT_ENC_IMAGES
     uint32_t off;
-    uint32_t tlv_off;
-    size_t blk_off;
     struct image_header *hdr;
-    uint16_t idx;
-    uint32_t blk_sz;
     uint8_t image_index;
 #endif
 
-    TARGET_STATIC uint8_t buf[1024];
+    /* Word-aligned, for flash drivers that program or DMA from it. */
+    TARGET_STATIC uint32_t bufs[BOOT_COPY_BUF_CNT]
+                               [MCUBOOT_COPY_BUF_SIZE / sizeof(uint32_t)];
 
-#if !defined(MCUBOOT_ENC_IMAGES)
+#if !defined(MCUBOOT_ENC_IMAGES) && !defined(MCUBOOT_HASH_ON_COPY) && \
+    !defined(MCUBOOT_COMPRESSED_IMAGES)
     (void)state;
 #endif
 
+    boot_trailer_cache_invalidate(fap_dst, off_dst, sz);
+
+#ifdef MCUBOOT_COMPRESSED_IMAGES
+    /* The payload of a compressed image is decompressed as it is copied to
+     * the primary slot, see boot_decompress_image().
+     */
+    decomp = fap_src->fa_id == FLASH_AREA_IMAGE_SECONDARY(BOOT_CURR_IMG(state)) &&
+             fap_dst->fa_id == FLASH_AREA_IMAGE_PRIMARY(BOOT_CURR_IMG(state)) &&
+             (boot_img_hdr(state, BOOT_SECONDARY_SLOT)->ih_flags &
+              IMAGE_F_COMPRESSED);
+#endif
+
     bytes_copied = 0;
+#if defined(MCUBOOT_COPY_DOUBLE_BUF) || defined(MCUBOOT_FLASH_ASYNC)
+    cur = 0;
+#endif
+#ifdef MCUBOOT_FLASH_ASYNC
+    /* The destination may still be being erased, see
+     * boot_erase_region_start(); nothing else reads it until that is done.
+     */
+    same_area = fap_src->fa_id == fap_dst->fa_id;
+#endif
+#ifdef MCUBOOT_COPY_DOUBLE_BUF
+    chunk_sz = boot_copy_chunk_sz(sz, 0);
+    if (chunk_sz > 0) {
+#ifdef MCUBOOT_FLASH_ASYNC
+        if (same_area && boot_flash_wait(fap_dst) != 0) {
+            rc = BOOT_EFLASH;
+            goto done;
+        }
+#endif
+        rc = flash_area_read_start(fap_src, off_src, bufs[cur], chunk_sz);
+        if (rc != 0) {
+            rc = BOOT_EFLASH;
+            goto done;
+        }
+    }
+#endif
     while (bytes_copied < sz) {
-        if (sz - bytes_copied > sizeof buf) {
-            chunk_sz = sizeof buf;
-        } else {
-            chunk_sz = sz - bytes_copied;
+#ifdef MCUBOOT_COPY_DOUBLE_BUF
+        buf = (uint8_t *)bufs[cur];
+        rc = flash_area_read_wait(fap_src);
+        if (rc != 0) {
+            rc = BOOT_EFLASH;
+            goto done;
+        }
+
+#ifdef MCUBOOT_FLASH_ASYNC
+        /* The other buffer is the source of the write still in flight. */
+        rc = boot_flash_wait(fap_dst);
+        if (rc != 0) {
+            rc = BOOT_EFLASH;
+            goto done;
         }
+#endif
 
+        /* Fetch the next chunk while this one is being programmed. */
+        next_sz = boot_copy_chunk_sz(sz, bytes_copied + chunk_sz);
+        if (next_sz > 0) {
+            rc = flash_area_read_start(fap_src,
+                                       off_src + bytes_copied + chunk_sz,
+                                       bufs[cur ^ 1], next_sz);
+            if (rc != 0) {
+                rc = BOOT_EFLASH;
+                goto done;
+            }
+        }
+#else
+#ifdef MCUBOOT_FLASH_ASYNC
+        /* Read this chunk while the last one is being programmed. */
+        buf = (uint8_t *)bufs[cur];
+        if (same_area && boot_flash_wait(fap_dst) != 0) {
+            rc = BOOT_EFLASH;
+            goto done;
+        }
+#else
+        buf = (uint8_t *)bufs[0];
+#endif
+        chunk_sz = boot_copy_chunk_sz(sz, bytes_copied);
         rc = flash_area_read(fap_src, off_src + bytes_copied, buf, chunk_sz);
         if (rc != 0) {
-            return BOOT_EFLASH;
+            rc = BOOT_EFLASH;
+            goto done;
         }
+#endif
 
 #ifdef MCUBOOT_ENC_IMAGES
         image_index = BOOT_CURR_IMG(state);
@@ -789,45 +1623,115 @@ boot_copy_region(struct boot_loader_state *state,
                 hdr = boot_img_hdr(state, BOOT_PRIMARY_SLOT);
             }
 #endif
-            if (IS_ENCRYPTED(hdr)) {
-                blk_sz = chunk_sz;
-                idx = 0;
-                if (off + bytes_copied < hdr->ih_hdr_size) {
-                    /* do not decrypt header */
-                    blk_off = 0;
-                    blk_sz = chunk_sz - hdr->ih_hdr_size;
-                    idx = hdr->ih_hdr_size;
-                } else {
-                    blk_off = ((off + bytes_copied) - hdr->ih_hdr_size) & 0xf;
-                }
-                tlv_off = BOOT_TLV_OFF(hdr);
-                if (off + bytes_copied + chunk_sz > tlv_off) {
-                    /* do not decrypt TLVs */
-                    if (off + bytes_copied >= tlv_off) {
-                        blk_sz = 0;
-                    } else {
-                        blk_sz = tlv_off - (off + bytes_copied);
-                    }
-                }
-                boot_encrypt(BOOT_CURR_ENC(state), image_index, fap_src,
-                        (off + bytes_copied + idx) - hdr->ih_hdr_size, blk_sz,
-                        blk_off, &buf[idx]);
+            boot_encrypt_region(state, fap_src, hdr, off + bytes_copied, buf,
+                                chunk_sz);
+        }
+#endif
+
+#ifdef MCUBOOT_COMPRESSED_IMAGES
+        if (decomp) {
+            rc = boot_decomp_update(&boot_decomp_ctx, buf, chunk_sz);
+        } else
+#endif
+        {
+#ifdef MCUBOOT_HASH_ON_COPY
+            boot_copy_hash_update(state, fap_src, fap_dst,
+                                  off_dst + bytes_copied, buf, chunk_sz);
+#endif
+
+#ifdef MCUBOOT_FLASH_ASYNC
+            rc = boot_flash_wait(fap_dst);
+            if (rc == 0) {
+                rc = flash_area_write_start(fap_dst, off_dst + bytes_copied,
+                                            buf, chunk_sz);
             }
+#else
+            rc = flash_area_write(fap_dst, off_dst + bytes_copied, buf,
+                                  chunk_sz);
+#endif
+        }
+        if (rc != 0) {
+#ifdef MCUBOOT_COPY_DOUBLE_BUF
+            if (next_sz > 0) {
+                /* Do not leave a read in flight into the other buffer. */
+                (void)flash_area_read_wait(fap_src);
+            }
+#endif
+            rc = BOOT_EFLASH;
+            goto done;
         }
+
+        bytes_copied += chunk_sz;
+#ifdef MCUBOOT_COPY_DOUBLE_BUF
+        chunk_sz = next_sz;
+#endif
+#if defined(MCUBOOT_COPY_DOUBLE_BUF) || defined(MCUBOOT_FLASH_ASYNC)
+        cur ^= 1;
+#endif
+
+        MCUBOOT_WATCHDOG_FEED();
+    }
+
+    rc = 0;
+
+done:
+#ifdef MCUBOOT_FLASH_ASYNC
+    /* The copy must be complete before it is recorded in the boot status,
+     * and no write may be left in flight from the buffers.
+     */
+    if (boot_flash_wait(fap_dst) != 0) {
+        rc = BOOT_EFLASH;
+    }
 #endif
+    return rc;
+}
 
-        rc = flash_area_write(fap_dst, off_dst + bytes_copied, buf, chunk_sz);
-        if (rc != 0) {
-            return BOOT_EFLASH;
-        }
+#ifdef MCUBOOT_ENC_DECRYPT_ONCE
+/**
+ * Checks the image just installed in the primary slot against the hash
+ * whose signature was verified before the upgrade.  An encrypted image is
+ * only hashed as it is decrypted into the primary slot, so this must pass
+ * before the upgrade is committed.
+ *
+ * @return                      0 if the image matches its signed hash or was
+ *                                  fully validated before being installed;
+ *                                  nonzero otherwise.
+ */
+static int
+boot_check_installed_image(struct boot_loader_state *state)
+{
+    TARGET_STATIC uint8_t tmpbuf[BOOT_TMPBUF_SZ];
+    const struct flash_area *fap;
+    struct image_header hdr;
+    uint8_t image_index;
+    int rc;
 
-        bytes_copied += chunk_sz;
+    image_index = BOOT_CURR_IMG(state);
+    fap = BOOT_IMG_AREA(state, BOOT_PRIMARY_SLOT);
 
-        MCUBOOT_WATCHDOG_FEED();
+    rc = flash_area_read(fap, 0, &hdr, sizeof(hdr));
+    if (rc != 0 || hdr.ih_magic != IMAGE_MAGIC) {
+        return -1;
     }
 
-    return 0;
+    if (!boot_is_decrypted_once(&hdr)) {
+        return 0;
+    }
+
+    if (BOOT_CURR_COPY_HASH(state).state == BOOT_COPY_HASH_DONE) {
+        rc = bootutil_img_validate_hash(image_index, &hdr, fap,
+                                        BOOT_CURR_COPY_HASH(state).hash);
+    } else {
+        /* The copy was resumed after a reset; the primary slot holds the
+         * image decrypted, so hashing it does not decrypt it again.
+         */
+        rc = bootutil_img_validate(BOOT_CURR_ENC(state), image_index, &hdr,
+                                   fap, tmpbuf, BOOT_TMPBUF_SZ, NULL, 0, NULL);
+    }
+
+    return rc;
 }
+#endif /* MCUBOOT_ENC_DECRYPT_ONCE */
 
 /**
  * Overwrite primary slot with the image contained in the secondary slot.
@@ -858,10 +1762,27 @@ boot_copy_image(struct boot_loader_state *state, struct boot_status *bs)
 
     (void)bs;
 
-#if defined(MCUBOOT_OVERWRITE_ONLY_FAST)
+#if defined(MCUBOOT_OVERWRITE_ONLY_FAST) || defined(MCUBOOT_VALIDATED_MARKER)
     uint32_t src_size = 0;
     rc = boot_read_image_size(state, BOOT_SECONDARY_SLOT, &src_size);
     assert(rc == 0);
+#endif
+#ifdef MCUBOOT_COMPRESSED_IMAGES
+    bool compressed;
+
+    compressed = (boot_img_hdr(state, BOOT_SECONDARY_SLOT)->ih_flags &
+                  IMAGE_F_COMPRESSED) != 0;
+#if defined(MCUBOOT_OVERWRITE_ONLY_FAST) || defined(MCUBOOT_VALIDATED_MARKER)
+    if (compressed) {
+        uint8_t hash[32];
+
+        /* Only the size of the decompressed image matters from now on. */
+        rc = boot_read_decomp_info(boot_img_hdr(state, BOOT_SECONDARY_SLOT),
+                                   BOOT_IMG_AREA(state, BOOT_SECONDARY_SLOT),
+                                   &src_size, hash);
+        assert(rc == 0);
+    }
+#endif
 #endif
 
     BOOT_LOG_INF("Image upgrade secondary slot -> primary slot");
@@ -880,9 +1801,6 @@ boot_copy_image(struct boot_loader_state *state, struct boot_status *bs)
     sect_count = boot_img_num_sectors(state, BOOT_PRIMARY_SLOT);
     for (sect = 0, size = 0; sect < sect_count; sect++) {
         this_size = boot_img_sector_size(state, BOOT_PRIMARY_SLOT, sect);
-        rc = boot_erase_region(fap_primary_slot, size, this_size);
-        assert(rc == 0);
-
         size += this_size;
 
 #if defined(MCUBOOT_OVERWRITE_ONLY_FAST)
@@ -892,6 +1810,10 @@ boot_copy_image(struct boot_loader_state *state, struct boot_status *bs)
 #endif
     }
 
+    /* The sectors are contiguous, so erase them all at once. */
+    rc = boot_erase_region(fap_primary_slot, 0, size);
+    assert(rc == 0);
+
 #ifdef MCUBOOT_ENC_IMAGES
     if (IS_ENCRYPTED(boot_img_hdr(state, BOOT_SECONDARY_SLOT))) {
         rc = boot_enc_load(BOOT_CURR_ENC(state), image_index,
@@ -907,9 +1829,32 @@ boot_copy_image(struct boot_loader_state *state, struct boot_status *bs)
     }
 #endif
 
-    BOOT_LOG_INF("Copying the secondary slot to the primary slot: 0x%zx bytes",
-                 size);
-    rc = boot_copy_region(state, fap_secondary_slot, fap_primary_slot, 0, 0, size);
+#ifdef MCUBOOT_VALIDATED_MARKER
+    /* Only copy the image, so the trailer of the primary slot is left erased
+     * for the validated marker.
+     */
+    size = (src_size + BOOT_WRITE_SZ(state) - 1) &
+           ~(BOOT_WRITE_SZ(state) - 1);
+#endif
+
+#ifdef MCUBOOT_COMPRESSED_IMAGES
+    if (compressed) {
+        BOOT_LOG_INF("Decompressing the secondary slot to the primary slot");
+        rc = boot_decompress_image(state, fap_primary_slot);
+        if (rc != 0) {
+            BOOT_LOG_ERR("Failed to decompress the secondary slot");
+            flash_area_close(fap_primary_slot);
+            flash_area_close(fap_secondary_slot);
+            return rc;
+        }
+    } else
+#endif
+    {
+        BOOT_LOG_INF("Copying the secondary slot to the primary slot: 0x%zx bytes",
+                     size);
+        rc = boot_copy_region(state, fap_secondary_slot, fap_primary_slot, 0, 0,
+                              size);
+    }
 
 #ifdef MCUBOOT_HW_ROLLBACK_PROT
     /* Update the stored security counter with the new image's security counter
@@ -953,7 +1898,7 @@ boot_copy_image(struct boot_loader_state *state, struct boot_status *bs)
 }
 #endif
 
-#if !defined(MCUBOOT_OVERWRITE_ONLY)
+#if !defined(MCUBOOT_OVERWRITE_ONLY) && !defined(MCUBOOT_DIRECT_XIP)
 /**
  * Swaps the two images in flash.  If a prior copy operation was interrupted
  * by a system reset, this function completes that operation.
@@ -970,6 +1915,9 @@ static int
 boot_swap_image(struct boot_loader_state *state, struct boot_status *bs)
 {
     struct image_header *hdr;
+#ifdef MCUBOOT_DELTA_UPGRADE
+    const struct flash_area *fap_secondary_slot;
+#endif
 #ifdef MCUBOOT_ENC_IMAGES
     const struct flash_area *fap;
     uint8_t slot;
@@ -985,6 +1933,36 @@ boot_swap_image(struct boot_loader_state *state, struct boot_status *bs)
     size = copy_size = 0;
     image_index = BOOT_CURR_IMG(state);
 
+#ifdef MCUBOOT_DELTA_UPGRADE
+    /* The header in the secondary slot only tells what to do for a new
+     * upgrade, as it can be anything while a swap is being resumed.
+     */
+    hdr = boot_img_hdr(state, BOOT_SECONDARY_SLOT);
+    if (boot_status_is_reset(bs) ?
+            (hdr->ih_magic == IMAGE_MAGIC && (hdr->ih_flags & IMAGE_F_DELTA)) :
+            bs->source == BOOT_STATUS_SOURCE_SECONDARY_SLOT) {
+        rc = swap_delta_run(state, bs);
+        if (rc == SWAP_DELTA_REJECTED) {
+            /* Nothing was written yet: drop the patch like an image that
+             * fails validation, and keep booting the primary slot.
+             */
+            BOOT_LOG_ERR("Rejected the patch in the secondary slot");
+            fap_secondary_slot = BOOT_IMG_AREA(state, BOOT_SECONDARY_SLOT);
+            rc = boot_erase_region(fap_secondary_slot, 0,
+                                   fap_secondary_slot->fa_size);
+            bs->swap_type = (rc == 0) ? BOOT_SWAP_TYPE_FAIL :
+                                        BOOT_SWAP_TYPE_PANIC;
+            BOOT_SWAP_TYPE(state) = bs->swap_type;
+        } else if (rc != 0) {
+            /* The primary slot is partially rebuilt and cannot be booted. */
+            BOOT_LOG_ERR("Failed to apply the patch in the secondary slot");
+            bs->swap_type = BOOT_SWAP_TYPE_PANIC;
+            BOOT_SWAP_TYPE(state) = BOOT_SWAP_TYPE_PANIC;
+        }
+        return 0;
+    }
+#endif
+
     if (boot_status_is_reset(bs)) {
         /*
          * No swap ever happened, so need to find the largest image which
@@ -1109,8 +2087,9 @@ boot_verify_slot_dependency(struct boot_loader_state *state,
                                           : BOOT_PRIMARY_SLOT;
     dep_version = &state->imgs[dep->image_id][dep_slot].hdr.ih_ver;
 
-    rc = boot_is_version_sufficient(&dep->image_min_version, dep_version);
-    if (rc != 0) {
+    rc = 0;
+    if (boot_version_cmp(dep_version, &dep->image_min_version, false) < 0) {
+        rc = BOOT_EBADVERSION;
         /* Dependency not satisfied.
          * Modify the swap type to decrease the version number of the image
          * (which will be located in the primary slot after the boot process),
@@ -1242,8 +2221,95 @@ boot_verify_dependencies(struct boot_loader_state *state)
     }
     return rc;
 }
+
+#ifdef MCUBOOT_IMAGE_MANIFEST
+/**
+ * When the manifest image is upgraded, check that each image it lists is
+ * either upgraded too, and was then checked against it, or already in the
+ * primary slot.  Otherwise, disable all image upgrades.
+ *
+ * @return                  0 on success; nonzero on failure.
+ */
+static int
+boot_verify_manifest(struct boot_loader_state *state)
+{
+    TARGET_STATIC uint8_t tmpbuf[BOOT_TMPBUF_SZ];
+    const uint8_t *manifest_hash;
+    uint8_t hash[32];
+    int rc;
+
+    if (!BOOT_IS_UPGRADE(state->swap_type[BOOT_MANIFEST_IMAGE])) {
+        return 0;
+    }
+
+    IMAGES_ITER(BOOT_CURR_IMG(state)) {
+        manifest_hash = bootutil_manifest_hash(BOOT_SECONDARY_SLOT,
+                                               BOOT_CURR_IMG(state));
+        if (manifest_hash == NULL || BOOT_IS_UPGRADE(BOOT_SWAP_TYPE(state))) {
+            continue;
+        }
+
+        rc = bootutil_img_hash(BOOT_CURR_ENC(state), BOOT_CURR_IMG(state),
+                               boot_img_hdr(state, BOOT_PRIMARY_SLOT),
+                               BOOT_IMG_AREA(state, BOOT_PRIMARY_SLOT),
+                               tmpbuf, BOOT_TMPBUF_SZ, hash, NULL, 0);
+        if (rc != 0 || memcmp(hash, manifest_hash, sizeof(hash)) != 0) {
+            BOOT_LOG_ERR("Image %d does not match the manifest",
+                         BOOT_CURR_IMG(state));
+            IMAGES_ITER(BOOT_CURR_IMG(state)) {
+                BOOT_SWAP_TYPE(state) = BOOT_SWAP_TYPE_NONE;
+            }
+            return BOOT_EBADIMAGE;
+        }
+    }
+
+    return 0;
+}
+#endif /* MCUBOOT_IMAGE_MANIFEST */
 #endif /* (BOOT_IMAGE_NUMBER > 1) */
 
+#ifdef MCUBOOT_ENC_DECRYPT_ONCE
+/**
+ * Swaps the previous image back after an upgrade installed an image that
+ * does not match its signed hash, as a revert would on the next boot.
+ * Neither image_ok nor the security counter were updated for the rejected
+ * image, since that is only done once the swap is checked.
+ *
+ * @param bs                    The current boot status, reset for the
+ *                                  revert.
+ */
+static void
+boot_revert_rejected_image(struct boot_loader_state *state,
+                           struct boot_status *bs)
+{
+    int rc;
+
+    BOOT_LOG_ERR("Image in the primary slot does not match its hash; "
+                 "reverting");
+
+    /* The trailer now reads as a test upgrade that was not confirmed, so a
+     * reset from here on resumes the revert.
+     */
+    rc = swap_set_copy_done(BOOT_CURR_IMG(state));
+    if (rc == 0) {
+        rc = boot_read_image_headers(state, false, NULL);
+    }
+    if (rc != 0) {
+        BOOT_SWAP_TYPE(state) = BOOT_SWAP_TYPE_PANIC;
+        return;
+    }
+
+    boot_enc_zeroize(BOOT_CURR_ENC(state));
+    boot_status_reset(bs);
+    bs->swap_type = BOOT_SWAP_TYPE_REVERT;
+    BOOT_SWAP_TYPE(state) = BOOT_SWAP_TYPE_REVERT;
+
+    rc = boot_swap_image(state, bs);
+    assert(rc == 0);
+}
+#endif
+
+#ifndef MCUBOOT_DIRECT_XIP
 /**
  * Performs a clean (not aborted) image update.
  *
@@ -1279,6 +2345,14 @@ boot_perform_update(struct boot_loader_state *state, struct boot_status *bs)
     assert(rc == 0);
 
 #ifndef MCUBOOT_OVERWRITE_ONLY
+#ifdef MCUBOOT_ENC_DECRYPT_ONCE
+    if ((BOOT_SWAP_TYPE(state) == BOOT_SWAP_TYPE_TEST ||
+         BOOT_SWAP_TYPE(state) == BOOT_SWAP_TYPE_PERM) &&
+        boot_check_installed_image(state) != 0) {
+        boot_revert_rejected_image(state, bs);
+    }
+#endif
+
     /* The following state needs image_ok be explicitly set after the
      * swap was finished to avoid a new revert.
      */
@@ -1293,6 +2367,8 @@ boot_perform_update(struct boot_loader_state *state, struct boot_status *bs)
 
 #ifdef MCUBOOT_HW_ROLLBACK_PROT
     if (swap_type == BOOT_SWAP_TYPE_PERM) {
+        struct image_header *hdr;
+
         /* Update the stored security counter with the new image's security
          * counter value. The primary slot holds the new image at this point,
          * but the secondary slot's image header must be passed since image
@@ -1302,10 +2378,15 @@ boot_perform_update(struct boot_loader_state *state, struct boot_status *bs)
          * revert the images on the next reboot. Therefore, the security
          * counter must be increased right after the image upgrade.
          */
-        rc = boot_update_security_counter(
-                                    BOOT_CURR_IMG(state),
-                                    BOOT_PRIMARY_SLOT,
-                                    boot_img_hdr(state, BOOT_SECONDARY_SLOT));
+        hdr = boot_img_hdr(state, BOOT_SECONDARY_SLOT);
+#ifdef MCUBOOT_DELTA_UPGRADE
+        /* A patch leaves the header of the image it rebuilt in boot_data. */
+        if (hdr->ih_flags & IMAGE_F_DELTA) {
+            hdr = boot_img_hdr(state, BOOT_PRIMARY_SLOT);
+        }
+#endif
+        rc = boot_update_security_counter(BOOT_CURR_IMG(state),
+                                          BOOT_PRIMARY_SLOT, hdr);
         if (rc != 0) {
             BOOT_LOG_ERR("Security counter update failed after "
                          "image upgrade.");
@@ -1347,6 +2428,14 @@ boot_complete_partial_swap(struct boot_loader_state *state,
 
     BOOT_SWAP_TYPE(state) = bs->swap_type;
 
+#ifdef MCUBOOT_ENC_DECRYPT_ONCE
+    if ((bs->swap_type == BOOT_SWAP_TYPE_TEST ||
+         bs->swap_type == BOOT_SWAP_TYPE_PERM) &&
+        boot_check_installed_image(state) != 0) {
+        boot_revert_rejected_image(state, bs);
+    }
+#endif
+
     /* The following states need image_ok be explicitly set after the
      * swap was finished to avoid a new revert.
      */
@@ -1490,12 +2579,28 @@ boot_prepare_image_for_update(struct boot_loader_state *state,
         }
 #endif
 
+#ifdef MCUBOOT_DELTA_UPGRADE
+        /* A patch being applied keeps its status in the secondary slot. */
+        if (boot_status_is_reset(bs)) {
+            rc = swap_delta_read_status(state, bs);
+            if (rc != 0) {
+                BOOT_LOG_WRN("Failed reading patch status; Image=%u",
+                        BOOT_CURR_IMG(state));
+                BOOT_SWAP_TYPE(state) = BOOT_SWAP_TYPE_NONE;
+                return;
+            }
+        }
+#endif
+
 #ifdef MCUBOOT_SWAP_USING_MOVE
         /*
          * Must re-read image headers because the boot status might
-         * have been updated in the previous function call.
+         * have been updated in the previous function call.  Without a swap
+         * in progress, the headers read above are still valid.
          */
-        rc = boot_read_image_headers(state, !boot_status_is_reset(bs), bs);
+        if (!boot_status_is_reset(bs)) {
+            rc = boot_read_image_headers(state, true, bs);
+        }
         if (rc != 0) {
             /* Continue with next image if there is one. */
             BOOT_LOG_WRN("Failed reading image headers; Image=%u",
@@ -1576,6 +2681,10 @@ boot_prepare_image_for_update(struct boot_loader_state *state,
         /* In that case if slots are not compatible. */
         BOOT_SWAP_TYPE(state) = BOOT_SWAP_TYPE_NONE;
     }
+
+#ifdef MCUBOOT_IMAGE_MANIFEST
+    boot_load_installed_manifest(state);
+#endif
 }
 
 int
@@ -1606,6 +2715,16 @@ context_boot_go(struct boot_loader_state *state, struct boot_rsp *rsp)
     (void)has_upgrade;
 #endif
 
+    /* Each trailer is only read again after it has been written. */
+    boot_trailer_cache_start();
+
+#ifdef MCUBOOT_IMAGE_MANIFEST
+    /* Manifests are recorded again as the manifest image is validated. */
+    for (slot = 0; slot < BOOT_NUM_SLOTS; slot++) {
+        bootutil_manifest_clear(slot);
+    }
+#endif
+
     /* Iterate over all the images. By the end of the loop the swap type has
      * to be determined for each image and all aborted swaps have to be
      * completed.
@@ -1667,6 +2786,12 @@ context_boot_go(struct boot_loader_state *state, struct boot_rsp *rsp)
              */
             rc = 0;
         }
+#ifdef MCUBOOT_IMAGE_MANIFEST
+        /* Images that do not match the manifest are not upgraded. */
+        if (boot_verify_manifest(state) != 0) {
+            rc = 0;
+        }
+#endif
     }
 #endif
 
@@ -1768,6 +2893,20 @@ context_boot_go(struct boot_loader_state *state, struct boot_rsp *rsp)
             rc = BOOT_EBADIMAGE;
             goto out;
         }
+
+#ifdef MCUBOOT_HASH_ON_COPY
+        /* An image that was hashed while being copied to the primary slot can
+         * be verified without reading it back, so check the result of the
+         * upgrade.
+         */
+        if (BOOT_CURR_COPY_HASH(state).state == BOOT_COPY_HASH_DONE) {
+            rc = boot_validate_slot(state, BOOT_PRIMARY_SLOT, NULL);
+            if (rc != 0) {
+                rc = BOOT_EBADIMAGE;
+                goto out;
+            }
+        }
+#endif
 #endif /* MCUBOOT_VALIDATE_PRIMARY_SLOT */
 
 #ifdef MCUBOOT_HW_ROLLBACK_PROT
@@ -1838,8 +2977,226 @@ out:
             flash_area_close(BOOT_IMG_AREA(state, BOOT_NUM_SLOTS - 1 - slot));
         }
     }
+    boot_trailer_cache_stop();
+    return rc;
+}
+#else /* MCUBOOT_DIRECT_XIP */
+/*
+ * Checks that an image linked for a fixed address, with IMAGE_F_ROM_FIXED set,
+ * is in the slot it was linked for: run from the other slot, it would crash.
+ *
+ * @returns
+ *         true if the image can run from the slot, false otherwise
+ */
+static bool
+boot_direct_xip_is_linked(struct boot_loader_state *state, int slot)
+{
+    const struct image_header *hdr;
+    const struct flash_area *fap;
+
+    hdr = boot_img_hdr(state, slot);
+    fap = BOOT_IMG_AREA(state, slot);
+    if (!(hdr->ih_flags & IMAGE_F_ROM_FIXED) ||
+        hdr->ih_load_addr == fap->fa_off) {
+        return true;
+    }
+
+    BOOT_LOG_WRN("Image in the %s slot is linked for 0x%lx, not 0x%lx",
+                 (slot == BOOT_PRIMARY_SLOT) ? "primary" : "secondary",
+                 (unsigned long)hdr->ih_load_addr,
+                 (unsigned long)fap->fa_off);
+    return false;
+}
+
+/*
+ * Reads the trailer of the image in a slot, and checks whether the image was
+ * marked bad: a test image which was already run once (copy_done set) and was
+ * not confirmed (image_ok unset) before the following reset.  Such an image is
+ * erased, so that it is never selected again.
+ *
+ * @returns
+ *         true if the image must not be run, false otherwise
+ */
+static bool
+boot_direct_xip_is_rejected(struct boot_loader_state *state, int slot,
+                            struct boot_swap_state *swap_state)
+{
+    const struct flash_area *fap;
+    int rc;
+
+    fap = BOOT_IMG_AREA(state, slot);
+    rc = boot_read_swap_state(fap, swap_state);
+    if (rc != 0) {
+        return true;
+    }
+
+    if (swap_state->magic != BOOT_MAGIC_GOOD ||
+        swap_state->copy_done != BOOT_FLAG_SET ||
+        swap_state->image_ok == BOOT_FLAG_SET) {
+        return false;
+    }
+
+    BOOT_LOG_INF("Image in the %s slot was not confirmed, erasing it",
+                 (slot == BOOT_PRIMARY_SLOT) ? "primary" : "secondary");
+    rc = boot_erase_region(fap, 0, fap->fa_size);
+    if (rc != 0) {
+        BOOT_LOG_ERR("Failed to erase the %s slot",
+                     (slot == BOOT_PRIMARY_SLOT) ? "primary" : "secondary");
+    }
+
+    return true;
+}
+
+/*
+ * Record that the image in a slot was selected, by setting copy_done in its
+ * trailer if it was marked pending.  A test image that is not confirmed
+ * before the next reset is then rejected.
+ *
+ * @returns
+ *         0 on success, BOOT_EFLASH if the trailer could not be written
+ */
+static int
+boot_direct_xip_mark_selected(struct boot_loader_state *state, int slot,
+                              const struct boot_swap_state *swap_state)
+{
+    int rc;
+
+    if (swap_state->magic == BOOT_MAGIC_GOOD &&
+        swap_state->copy_done != BOOT_FLAG_SET) {
+        rc = boot_write_copy_done(BOOT_IMG_AREA(state, slot));
+        if (rc != 0) {
+            return BOOT_EFLASH;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Selects the image to run in place, without copying anything: the newest
+ * image which is valid and was not marked bad, from either slot.  Images
+ * marked with a trailer, pending or confirmed, are preferred; an image without
+ * one was never installed through boot_set_pending_slot(), and is only run
+ * when no marked image is valid.  If the image selected fails validation, the
+ * next one is tried.
+ */
+int
+context_boot_go(struct boot_loader_state *state, struct boot_rsp *rsp)
+{
+    struct boot_swap_state swap_state[BOOT_NUM_SLOTS];
+    bool candidate[BOOT_NUM_SLOTS];
+    bool marked[BOOT_NUM_SLOTS];
+    int selected;
+    int slot;
+    int fa_id;
+    int rc;
+
+    memset(state, 0, sizeof(struct boot_loader_state));
+
+    /* Each trailer is only read again after it has been written. */
+    boot_trailer_cache_start();
+
+    for (slot = 0; slot < BOOT_NUM_SLOTS; slot++) {
+        fa_id = flash_area_id_from_multi_image_slot(BOOT_CURR_IMG(state), slot);
+        rc = flash_area_open(fa_id, &BOOT_IMG_AREA(state, slot));
+        assert(rc == 0);
+    }
+
+    for (slot = 0; slot < BOOT_NUM_SLOTS; slot++) {
+        rc = boot_read_image_header(state, slot, boot_img_hdr(state, slot),
+                                    NULL);
+        candidate[slot] = (rc == 0 &&
+                           boot_check_header_erased(state, slot) != 0 &&
+                           boot_direct_xip_is_linked(state, slot) &&
+                           !boot_direct_xip_is_rejected(state, slot,
+                                                        &swap_state[slot]));
+        marked[slot] = (candidate[slot] &&
+                        swap_state[slot].magic == BOOT_MAGIC_GOOD);
+    }
+
+    while (1) {
+        selected = -1;
+        for (slot = 0; slot < BOOT_NUM_SLOTS; slot++) {
+            if (!candidate[slot]) {
+                continue;
+            }
+            if (selected < 0 ||
+                (marked[slot] && !marked[selected]) ||
+                (marked[slot] == marked[selected] &&
+                 boot_version_cmp(&boot_img_hdr(state, slot)->ih_ver,
+                                  &boot_img_hdr(state, selected)->ih_ver,
+                                  true) > 0)) {
+                selected = slot;
+            }
+        }
+
+        if (selected < 0) {
+            BOOT_LOG_ERR("No bootable image found");
+            rc = BOOT_EBADIMAGE;
+            goto out;
+        }
+
+        if (boot_validate_slot(state, selected, NULL) == 0) {
+            break;
+        }
+        candidate[selected] = false;
+    }
+
+    rc = boot_direct_xip_mark_selected(state, selected, &swap_state[selected]);
+    if (rc != 0) {
+        goto out;
+    }
+
+    BOOT_LOG_INF("Running the image in the %s slot in place",
+                 (selected == BOOT_PRIMARY_SLOT) ? "primary" : "secondary");
+
+#ifdef MCUBOOT_HW_ROLLBACK_PROT
+    /* A test image may still be rejected, and an image without a trailer was
+     * never tested, so the security counter is only updated from an image
+     * which was confirmed.
+     */
+    if (marked[selected] && swap_state[selected].image_ok == BOOT_FLAG_SET) {
+        rc = boot_update_security_counter(BOOT_CURR_IMG(state), selected,
+                                          boot_img_hdr(state, selected));
+        if (rc != 0) {
+            BOOT_LOG_ERR("Security counter update failed after image "
+                         "validation.");
+            goto out;
+        }
+    }
+#endif /* MCUBOOT_HW_ROLLBACK_PROT */
+
+#ifdef MCUBOOT_MEASURED_BOOT
+    rc = boot_save_boot_status(BOOT_CURR_IMG(state),
+                               boot_img_hdr(state, selected),
+                               BOOT_IMG_AREA(state, selected));
+    if (rc != 0) {
+        BOOT_LOG_ERR("Failed to add Image %u data to shared memory area",
+                     BOOT_CURR_IMG(state));
+    }
+#endif /* MCUBOOT_MEASURED_BOOT */
+
+#ifdef MCUBOOT_DATA_SHARING
+    rc = boot_save_shared_data(boot_img_hdr(state, selected),
+                               BOOT_IMG_AREA(state, selected));
+    if (rc != 0) {
+        BOOT_LOG_ERR("Failed to add data to shared memory area.");
+    }
+#endif /* MCUBOOT_DATA_SHARING */
+
+    rc = 0;
+    rsp->br_flash_dev_id = BOOT_IMG_AREA(state, selected)->fa_device_id;
+    rsp->br_image_off = boot_img_slot_off(state, selected);
+    rsp->br_hdr = boot_img_hdr(state, selected);
+
+out:
+    for (slot = 0; slot < BOOT_NUM_SLOTS; slot++) {
+        flash_area_close(BOOT_IMG_AREA(state, BOOT_NUM_SLOTS - 1 - slot));
+    }
+    boot_trailer_cache_stop();
     return rc;
 }
+#endif /* MCUBOOT_DIRECT_XIP */
 
 /**
  * Prepares the booting process.  This function moves images around in flash as
@@ -0,0 +1,663 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <string.h>
+#include "bootutil/bootutil.h"
+#include "bootutil/image.h"
+#include "bootutil_priv.h"
+#include "swap_priv.h"
+#include "bootutil/bootutil_log.h"
+
+#include "mcuboot_config/mcuboot_config.h"
+
+MCUBOOT_LOG_MODULE_DECLARE(mcuboot);
+
+#ifdef MCUBOOT_DELTA_UPGRADE
+
+/*
+ * The payload of a patch image is a sequence of commands, each producing the
+ * next bytes of the new image.  A command starts with a 32-bit word holding
+ * the number of bytes it produces.  If BOOT_DELTA_LITERAL is set in it, these
+ * bytes follow the word; otherwise a second word holds the offset, in the
+ * primary slot, of the bytes of the current image to copy.
+ *
+ * The primary slot is rebuilt one range of sectors at a time, starting from
+ * its beginning, and each range is saved to the scratch area before being
+ * erased.  A copy can thus read from the range it writes to and from the
+ * following ones, but not from the previous ranges which already hold the new
+ * image; swap_delta_check() rejects patches that would.
+ *
+ * The progress is recorded in the status area of the secondary slot trailer,
+ * which is left alone until the patch is fully applied.
+ */
+#define BOOT_DELTA_LITERAL      0x80000000
+
+struct swap_delta_cmd {
+    uint32_t out_off;   /* Offset in the primary slot of the bytes produced */
+    uint32_t len;       /* Number of bytes produced */
+    uint32_t src_off;   /* Offset of the bytes to copy, in the secondary slot
+                         * for a literal, in the primary slot otherwise */
+    bool literal;
+};
+
+struct swap_delta_iter {
+    const struct flash_area *fap;
+    uint32_t off;       /* Offset of the next command in the secondary slot */
+    uint32_t end;       /* Offset of the end of the patch */
+    uint32_t out_off;   /* Offset of the bytes produced by the next command */
+};
+
+static int
+swap_delta_iter_begin(struct swap_delta_iter *it,
+                      const struct flash_area *fap,
+                      const struct image_header *hdr)
+{
+    it->fap = fap;
+    it->off = hdr->ih_hdr_size;
+    it->out_off = 0;
+    if (!boot_u32_safe_add(&it->end, hdr->ih_hdr_size, hdr->ih_img_size)) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Reads the next command of a patch.
+ *
+ * @returns 0 if a command was read
+ *          1 at the end of the patch
+ *          -1 on errors
+ */
+static int
+swap_delta_iter_next(struct swap_delta_iter *it, struct swap_delta_cmd *cmd)
+{
+    uint32_t word;
+
+    if (it->off == it->end) {
+        return 1;
+    }
+
+    if (it->end - it->off < sizeof(word) ||
+        flash_area_read(it->fap, it->off, &word, sizeof(word)) != 0) {
+        return -1;
+    }
+    it->off += sizeof(word);
+
+    cmd->out_off = it->out_off;
+    cmd->len = word & ~BOOT_DELTA_LITERAL;
+    cmd->literal = (word & BOOT_DELTA_LITERAL) != 0;
+
+    if (cmd->literal) {
+        if (it->end - it->off < cmd->len) {
+            return -1;
+        }
+        cmd->src_off = it->off;
+        it->off += cmd->len;
+    } else {
+        if (it->end - it->off < sizeof(word) ||
+            flash_area_read(it->fap, it->off, &word, sizeof(word)) != 0) {
+            return -1;
+        }
+        cmd->src_off = word;
+        it->off += sizeof(word);
+    }
+
+    if (cmd->len == 0 ||
+        !boot_u32_safe_add(&it->out_off, it->out_off, cmd->len)) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Returns the size of the range of sectors of the primary slot, starting at
+ * sector *sector, that is rebuilt in a single step, and moves *sector past
+ * it.  A range spans as many sectors as fit in the scratch area.
+ */
+static uint32_t
+swap_delta_range_sz(const struct boot_loader_state *state, size_t *sector)
+{
+    size_t scratch_sz;
+    size_t num_sectors;
+    uint32_t new_sz;
+    uint32_t sz;
+
+    scratch_sz = boot_scratch_area_size(state);
+    num_sectors = boot_img_num_sectors(state, BOOT_PRIMARY_SLOT);
+
+    sz = 0;
+    while (*sector < num_sectors) {
+        new_sz = sz + boot_img_sector_size(state, BOOT_PRIMARY_SLOT, *sector);
+        if (new_sz > scratch_sz) {
+            break;
+        }
+        sz = new_sz;
+        (*sector)++;
+    }
+
+    return sz;
+}
+
+/*
+ * Returns the offset of the range of sectors holding the byte at off.
+ */
+static uint32_t
+swap_delta_range_off(const struct boot_loader_state *state, uint32_t off)
+{
+    size_t sector;
+    uint32_t range_off;
+    uint32_t sz;
+
+    sector = 0;
+    range_off = 0;
+    while (1) {
+        sz = swap_delta_range_sz(state, &sector);
+        if (sz == 0 || off - range_off < sz) {
+            return range_off;
+        }
+        range_off += sz;
+    }
+}
+
+int
+swap_delta_check(struct boot_loader_state *state)
+{
+    const struct flash_area *fap_primary_slot;
+    const struct flash_area *fap_secondary_slot;
+    struct image_header *hdr_primary;
+    struct image_header *hdr_secondary;
+    struct image_tlv_iter it;
+    struct swap_delta_iter patch;
+    struct swap_delta_cmd cmd;
+    uint8_t tmpbuf[BOOT_TMPBUF_SZ];
+    uint8_t base_hash[32];
+    uint8_t hash[32];
+    uint32_t base_sz;
+    uint32_t range_off;
+    uint32_t off;
+    uint16_t len;
+    int rc;
+
+    fap_primary_slot = BOOT_IMG_AREA(state, BOOT_PRIMARY_SLOT);
+    fap_secondary_slot = BOOT_IMG_AREA(state, BOOT_SECONDARY_SLOT);
+    hdr_primary = boot_img_hdr(state, BOOT_PRIMARY_SLOT);
+    hdr_secondary = boot_img_hdr(state, BOOT_SECONDARY_SLOT);
+
+    if (IS_ENCRYPTED(hdr_secondary) ||
+        hdr_primary->ih_magic != IMAGE_MAGIC ||
+        (hdr_primary->ih_flags & (IMAGE_F_DELTA | IMAGE_F_ENCRYPTED))) {
+        return -1;
+    }
+
+    rc = bootutil_tlv_iter_begin(&it, hdr_secondary, fap_secondary_slot,
+                                 IMAGE_TLV_DELTA_BASE, true);
+    if (rc) {
+        return -1;
+    }
+
+    rc = bootutil_tlv_iter_next(&it, &off, &len, NULL);
+    if (rc != 0 || len != sizeof(base_hash)) {
+        return -1;
+    }
+
+    rc = flash_area_read(fap_secondary_slot, off, base_hash, len);
+    if (rc) {
+        return -1;
+    }
+
+    /* The patch only applies to the image it was made against. */
+    if (!boot_u32_safe_add(&base_sz, hdr_primary->ih_hdr_size,
+                           hdr_primary->ih_img_size) ||
+        !boot_u32_safe_add(&base_sz, base_sz,
+                           hdr_primary->ih_protect_tlv_size) ||
+        base_sz > boot_status_off(fap_primary_slot)) {
+        return -1;
+    }
+
+    rc = bootutil_img_hash(BOOT_CURR_ENC(state), BOOT_CURR_IMG(state),
+                           hdr_primary, fap_primary_slot, tmpbuf,
+                           BOOT_TMPBUF_SZ, hash, NULL, 0);
+    if (rc != 0 || memcmp(hash, base_hash, sizeof(hash)) != 0) {
+        BOOT_LOG_ERR("Patch does not apply to the image in the primary slot");
+        return -1;
+    }
+
+    /* Copies must only read the current image, and only the part of it that
+     * is not yet overwritten when they are run.
+     */
+    rc = swap_delta_iter_begin(&patch, fap_secondary_slot, hdr_secondary);
+    if (rc) {
+        return -1;
+    }
+
+    while ((rc = swap_delta_iter_next(&patch, &cmd)) == 0) {
+        if (cmd.literal) {
+            continue;
+        }
+
+        if (cmd.src_off > base_sz || base_sz - cmd.src_off < cmd.len) {
+            return -1;
+        }
+
+        range_off = swap_delta_range_off(state, cmd.out_off);
+        if (cmd.src_off < range_off) {
+            return -1;
+        }
+
+        if (cmd.src_off < cmd.out_off &&
+            swap_delta_range_off(state, cmd.out_off + cmd.len - 1) !=
+                range_off) {
+            return -1;
+        }
+    }
+
+    if (rc < 0) {
+        return -1;
+    }
+
+    /* The new image must leave room for the trailer. */
+    if (patch.out_off < sizeof(struct image_header) ||
+        patch.out_off > boot_status_off(fap_primary_slot)) {
+        return -1;
+    }
+
+    return 0;
+}
+
+static int
+swap_delta_write_status(const struct boot_loader_state *state,
+                        const struct flash_area *fap,
+                        const struct boot_status *bs)
+{
+    uint8_t buf[BOOT_MAX_ALIGN];
+    uint32_t off;
+    uint8_t align;
+
+    off = boot_status_off(fap) +
+          boot_status_internal_off(bs, BOOT_WRITE_SZ(state));
+    align = flash_area_align(fap);
+    memset(buf, flash_area_erased_val(fap), BOOT_MAX_ALIGN);
+    buf[0] = bs->state;
+
+    if (flash_area_write(fap, off, buf, align) != 0) {
+        return BOOT_EFLASH;
+    }
+
+    return 0;
+}
+
+int
+swap_delta_read_status(struct boot_loader_state *state, struct boot_status *bs)
+{
+    const struct flash_area *fap;
+    struct image_header *hdr;
+    struct boot_swap_state swap_state;
+    int rc;
+
+    hdr = boot_img_hdr(state, BOOT_SECONDARY_SLOT);
+    if (hdr->ih_magic != IMAGE_MAGIC || !(hdr->ih_flags & IMAGE_F_DELTA)) {
+        return 0;
+    }
+
+    fap = BOOT_IMG_AREA(state, BOOT_SECONDARY_SLOT);
+    rc = boot_read_swap_state(fap, &swap_state);
+    if (rc != 0) {
+        return BOOT_EFLASH;
+    }
+
+    /* Once applied, the patch has its trailer erased. */
+    if (swap_state.magic != BOOT_MAGIC_GOOD) {
+        return 0;
+    }
+
+    rc = swap_read_status_bytes(fap, state, bs);
+    if (rc == 0 && !boot_status_is_reset(bs)) {
+        BOOT_LOG_INF("Boot source: secondary slot (patch)");
+        bs->source = BOOT_STATUS_SOURCE_SECONDARY_SLOT;
+        bs->swap_type = BOOT_SWAP_TYPE_PERM;
+    }
+
+    return rc;
+}
+
+/**
+ * Writes the bytes of the new image that belong to the range of sz bytes at
+ * off in the primary slot, which must be erased and saved to the scratch area.
+ *
+ * @param img_sz                The size of the new image.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+static int
+swap_delta_write_range(struct boot_loader_state *state, uint32_t off,
+                       uint32_t sz, uint32_t img_sz)
+{
+    const struct flash_area *fap_primary_slot;
+    const struct flash_area *fap_secondary_slot;
+    const struct flash_area *fap_scratch;
+    struct swap_delta_iter patch;
+    struct swap_delta_cmd cmd;
+    uint8_t buf[BOOT_TMPBUF_SZ];
+    uint32_t buf_off;
+    uint32_t chunk_sz;
+    uint32_t write_sz;
+    uint32_t end;
+    uint32_t pos;
+    uint32_t src;
+    uint8_t align;
+    int rc;
+
+    fap_primary_slot = BOOT_IMG_AREA(state, BOOT_PRIMARY_SLOT);
+    fap_secondary_slot = BOOT_IMG_AREA(state, BOOT_SECONDARY_SLOT);
+    fap_scratch = BOOT_SCRATCH_AREA(state);
+    align = flash_area_align(fap_primary_slot);
+
+    end = off + sz;
+    if (end > img_sz) {
+        end = img_sz;
+    }
+
+    rc = swap_delta_iter_begin(&patch, fap_secondary_slot,
+                               boot_img_hdr(state, BOOT_SECONDARY_SLOT));
+    if (rc) {
+        return BOOT_EBADIMAGE;
+    }
+
+    /* Skip the commands producing the previous ranges. */
+    do {
+        if (swap_delta_iter_next(&patch, &cmd) != 0) {
+            return BOOT_EBADIMAGE;
+        }
+    } while (cmd.out_off + cmd.len <= off);
+
+    buf_off = 0;
+    pos = off;
+    while (pos < end) {
+        if (pos == cmd.out_off + cmd.len &&
+            swap_delta_iter_next(&patch, &cmd) != 0) {
+            return BOOT_EBADIMAGE;
+        }
+
+        chunk_sz = cmd.out_off + cmd.len - pos;
+        if (chunk_sz > end - pos) {
+            chunk_sz = end - pos;
+        }
+        if (chunk_sz > sizeof(buf) - buf_off) {
+            chunk_sz = sizeof(buf) - buf_off;
+        }
+
+        src = cmd.src_off + (pos - cmd.out_off);
+        if (cmd.literal) {
+            rc = flash_area_read(fap_secondary_slot, src, &buf[buf_off],
+                                 chunk_sz);
+        } else if (src < off) {
+            return BOOT_EBADIMAGE;
+        } else if (src - off < sz) {
+            /* This range of the current image is now in the scratch area. */
+            if (chunk_sz > sz - (src - off)) {
+                chunk_sz = sz - (src - off);
+            }
+            rc = flash_area_read(fap_scratch, src - off, &buf[buf_off],
+                                 chunk_sz);
+        } else {
+            rc = flash_area_read(fap_primary_slot, src, &buf[buf_off],
+                                 chunk_sz);
+        }
+        if (rc != 0) {
+            return BOOT_EFLASH;
+        }
+
+        buf_off += chunk_sz;
+        pos += chunk_sz;
+
+        if (buf_off == sizeof(buf) || pos == end) {
+            write_sz = (buf_off + align - 1) & ~(align - 1);
+            memset(&buf[buf_off], flash_area_erased_val(fap_primary_slot),
+                   write_sz - buf_off);
+            rc = flash_area_write(fap_primary_slot, pos - buf_off, buf,
+                                  write_sz);
+            if (rc != 0) {
+                return BOOT_EFLASH;
+            }
+            buf_off = 0;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Rebuilds a range of sectors of the primary slot.
+ *
+ * @param off                   The offset of the range in the primary slot.
+ * @param sz                    The size of the range.
+ * @param img_sz                The size of the new image.
+ * @param bs                    The current boot status.  This struct gets
+ *                                  updated according to the outcome.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+static int
+swap_delta_range(struct boot_loader_state *state, uint32_t off, uint32_t sz,
+                 uint32_t img_sz, struct boot_status *bs)
+{
+    const struct flash_area *fap_primary_slot;
+    const struct flash_area *fap_secondary_slot;
+    const struct flash_area *fap_scratch;
+    uint32_t trailer_off;
+    uint32_t copy_sz;
+    int rc;
+
+    fap_primary_slot = BOOT_IMG_AREA(state, BOOT_PRIMARY_SLOT);
+    fap_secondary_slot = BOOT_IMG_AREA(state, BOOT_SECONDARY_SLOT);
+    fap_scratch = BOOT_SCRATCH_AREA(state);
+
+    if (bs->state == BOOT_STATUS_STATE_0) {
+        /* The trailer of the primary slot never holds data a patch can copy,
+         * and keeping it out of the scratch area ensures it is not mistaken
+         * for the status of an interrupted swap.
+         */
+        copy_sz = sz;
+        trailer_off = boot_status_off(fap_primary_slot);
+        if (off + copy_sz > trailer_off) {
+            copy_sz = trailer_off - off;
+        }
+
+        rc = boot_erase_region_start(fap_scratch, 0, fap_scratch->fa_size);
+        assert(rc == 0);
+
+        rc = boot_copy_region(state, fap_primary_slot, fap_scratch, off, 0,
+                              copy_sz);
+        assert(rc == 0);
+
+        rc = swap_delta_write_status(state, fap_secondary_slot, bs);
+        assert(rc == 0);
+        bs->state = BOOT_STATUS_STATE_1;
+    }
+
+    if (bs->state == BOOT_STATUS_STATE_1) {
+        rc = boot_erase_region(fap_primary_slot, off, sz);
+        assert(rc == 0);
+
+        rc = swap_delta_write_range(state, off, sz, img_sz);
+        if (rc != 0) {
+            return rc;
+        }
+
+        rc = swap_delta_write_status(state, fap_secondary_slot, bs);
+        assert(rc == 0);
+        bs->state = BOOT_STATUS_STATE_2;
+    }
+
+    if (bs->state == BOOT_STATUS_STATE_2) {
+        /* Entries are read back up to the first erased one, so each range
+         * fills all of its own.
+         */
+        rc = swap_delta_write_status(state, fap_secondary_slot, bs);
+        assert(rc == 0);
+    }
+
+    bs->idx++;
+    bs->state = BOOT_STATUS_STATE_0;
+
+    return 0;
+}
+
+/**
+ * Validates the patched image and writes the trailer of the primary slot,
+ * then erases the trailer of the secondary slot to mark the patch as applied.
+ *
+ * @param rebuilt_sz            The size of the ranges of sectors rebuilt.
+ *
+ * @return                      0 on success; nonzero on failure.
+ */
+static int
+swap_delta_finish(struct boot_loader_state *state, uint32_t rebuilt_sz)
+{
+    const struct flash_area *fap_primary_slot;
+    const struct flash_area *fap_secondary_slot;
+    struct image_header *hdr;
+    struct boot_swap_state swap_state;
+    uint8_t tmpbuf[BOOT_TMPBUF_SZ];
+    uint32_t trailer_off;
+    uint32_t sector_off;
+    size_t sector;
+    int rc;
+
+    fap_primary_slot = BOOT_IMG_AREA(state, BOOT_PRIMARY_SLOT);
+    fap_secondary_slot = BOOT_IMG_AREA(state, BOOT_SECONDARY_SLOT);
+
+    hdr = boot_img_hdr(state, BOOT_PRIMARY_SLOT);
+    rc = boot_read_image_header(state, BOOT_PRIMARY_SLOT, hdr, NULL);
+    if (rc != 0) {
+        return BOOT_EFLASH;
+    }
+
+    if (hdr->ih_magic != IMAGE_MAGIC ||
+        bootutil_img_validate(BOOT_CURR_ENC(state), BOOT_CURR_IMG(state), hdr,
+                              fap_primary_slot, tmpbuf, BOOT_TMPBUF_SZ,
+                              NULL, 0, NULL) != 0) {
+        BOOT_LOG_ERR("Patched image in the primary slot is not valid!");
+        return BOOT_EBADIMAGE;
+    }
+
+    /* Erase the trailer of the previous image, unless it was in a sector
+     * that has been rebuilt.
+     */
+    trailer_off = boot_status_off(fap_primary_slot);
+    sector = boot_img_num_sectors(state, BOOT_PRIMARY_SLOT) - 1;
+    while (1) {
+        sector_off = boot_img_sector_off(state, BOOT_PRIMARY_SLOT, sector);
+        if (sector_off < rebuilt_sz) {
+            break;
+        }
+
+        rc = boot_erase_region(fap_primary_slot, sector_off,
+                boot_img_sector_size(state, BOOT_PRIMARY_SLOT, sector));
+        assert(rc == 0);
+
+        if (sector_off <= trailer_off) {
+            break;
+        }
+        sector--;
+    }
+
+    /* The trailer might already be written if this step is being resumed. */
+    rc = boot_read_swap_state(fap_primary_slot, &swap_state);
+    assert(rc == 0);
+
+    if (swap_state.magic != BOOT_MAGIC_GOOD) {
+        rc = boot_write_magic(fap_primary_slot);
+        assert(rc == 0);
+    }
+
+    if (swap_state.image_ok == BOOT_FLAG_UNSET) {
+        rc = boot_write_image_ok(fap_primary_slot);
+        assert(rc == 0);
+    }
+
+    rc = swap_erase_trailer_sectors(state, fap_secondary_slot);
+    assert(rc == 0);
+
+    return 0;
+}
+
+int
+swap_delta_run(struct boot_loader_state *state, struct boot_status *bs)
+{
+    struct swap_delta_iter patch;
+    struct swap_delta_cmd cmd;
+    uint32_t img_sz;
+    uint32_t off;
+    uint32_t sz;
+    uint32_t idx;
+    size_t sector;
+    bool resumed;
+    int rc;
+
+    /* Until the first range is saved to the scratch area, the primary slot
+     * is untouched and the patch can still be dropped.
+     */
+    resumed = !boot_status_is_reset(bs);
+
+    rc = swap_delta_iter_begin(&patch, BOOT_IMG_AREA(state, BOOT_SECONDARY_SLOT),
+                               boot_img_hdr(state, BOOT_SECONDARY_SLOT));
+    if (rc) {
+        return resumed ? BOOT_EBADIMAGE : SWAP_DELTA_REJECTED;
+    }
+
+    while ((rc = swap_delta_iter_next(&patch, &cmd)) == 0) {
+        /* Only the size of the new image is needed. */
+    }
+    if (rc < 0) {
+        return resumed ? BOOT_EBADIMAGE : SWAP_DELTA_REJECTED;
+    }
+    img_sz = patch.out_off;
+
+    BOOT_LOG_INF("Patching the primary slot: 0x%" PRIx32 " bytes", img_sz);
+
+    /* The previous image is overwritten, so there is nothing to revert to. */
+    bs->swap_type = BOOT_SWAP_TYPE_PERM;
+    BOOT_SWAP_TYPE(state) = BOOT_SWAP_TYPE_PERM;
+
+    sector = 0;
+    off = 0;
+    for (idx = BOOT_STATUS_IDX_0; off < img_sz; idx++) {
+        sz = swap_delta_range_sz(state, &sector);
+        if (sz == 0) {
+            return (resumed || off > 0) ? BOOT_EBADIMAGE : SWAP_DELTA_REJECTED;
+        }
+
+        if (idx == bs->idx) {
+            rc = swap_delta_range(state, off, sz, img_sz, bs);
+            if (rc != 0) {
+                return rc;
+            }
+        }
+
+        off += sz;
+    }
+
+    return swap_delta_finish(state, off);
+}
+
+#endif /* MCUBOOT_DELTA_UPGRADE */
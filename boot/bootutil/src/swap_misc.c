@@ -31,7 +31,8 @@
 
 MCUBOOT_LOG_MODULE_DECLARE(mcuboot);
 
-#if defined(MCUBOOT_SWAP_USING_SCRATCH) || defined(MCUBOOT_SWAP_USING_MOVE)
+#if defined(MCUBOOT_SWAP_USING_SCRATCH) || defined(MCUBOOT_SWAP_USING_MOVE) || \
+    defined(MCUBOOT_SWAP_USING_RAM)
 
 int
 swap_erase_trailer_sectors(const struct boot_loader_state *state,
@@ -64,20 +65,26 @@ swap_erase_trailer_sectors(const struct boot_loader_state *state,
         return BOOT_EFLASH;
     }
 
-    /* delete starting from last sector and moving to beginning */
+    /* find the first sector of the trailer, and erase up to the end at once */
     sector = boot_img_num_sectors(state, slot) - 1;
     trailer_sz = boot_trailer_sz(BOOT_WRITE_SZ(state));
+#ifdef MCUBOOT_SWAP_SECTOR_STATUS
+    if (slot == BOOT_PRIMARY_SLOT) {
+        trailer_sz += boot_unit_status_sz(BOOT_WRITE_SZ(state));
+    }
+#endif
     total_sz = 0;
     do {
         sz = boot_img_sector_size(state, slot, sector);
         off = boot_img_sector_off(state, slot, sector);
-        rc = boot_erase_region(fap, off, sz);
-        assert(rc == 0);
 
         sector--;
         total_sz += sz;
     } while (total_sz < trailer_sz);
 
+    rc = boot_erase_region(fap, off, total_sz);
+    assert(rc == 0);
+
     return rc;
 }
 
@@ -107,12 +114,25 @@ swap_status_init(const struct boot_loader_state *state,
         assert(rc == 0);
     }
 
+#ifdef MCUBOOT_ENC_DECRYPT_ONCE
+    /* A permanent upgrade is only confirmed once the image it installs has
+     * been checked, see boot_perform_update().
+     */
+    if (bs->swap_type == BOOT_SWAP_TYPE_PERM) {
+        swap_state.image_ok = BOOT_FLAG_UNSET;
+    }
+#endif
+
     if (swap_state.image_ok == BOOT_FLAG_SET) {
         rc = boot_write_image_ok(fap);
         assert(rc == 0);
     }
 
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+    rc = boot_write_swap_size_scratch(fap, bs->swap_size, bs->scratch_off);
+#else
     rc = boot_write_swap_size(fap, bs->swap_size);
+#endif
     assert(rc == 0);
 
 #ifdef MCUBOOT_ENC_IMAGES
@@ -129,6 +149,110 @@ swap_status_init(const struct boot_loader_state *state,
     return 0;
 }
 
+#ifdef MCUBOOT_SWAP_SKIP_IDENTICAL
+int
+swap_regions_identical(struct boot_loader_state *state,
+                       const struct flash_area *fap_a, uint32_t off_a,
+                       const struct flash_area *fap_b, uint32_t off_b,
+                       uint32_t sz)
+{
+    uint8_t buf_a[BOOT_TMPBUF_SZ / 2];
+    uint8_t buf_b[BOOT_TMPBUF_SZ / 2];
+    const void *data_a;
+    const void *data_b;
+    uint32_t bytes_cmp;
+    uint32_t chunk_sz;
+
+#ifdef MCUBOOT_ENC_IMAGES
+    /* An encrypted image is not stored as it is in the primary slot. */
+    if (fap_a->fa_id != fap_b->fa_id &&
+        (IS_ENCRYPTED(boot_img_hdr(state, BOOT_PRIMARY_SLOT)) ||
+         IS_ENCRYPTED(boot_img_hdr(state, BOOT_SECONDARY_SLOT)))) {
+        return 0;
+    }
+#else
+    (void)state;
+#endif
+
+    for (bytes_cmp = 0; bytes_cmp < sz; bytes_cmp += chunk_sz) {
+        chunk_sz = sz - bytes_cmp;
+        if (chunk_sz > sizeof(buf_a)) {
+            chunk_sz = sizeof(buf_a);
+        }
+
+        if (bootutil_flash_ptr(fap_a, off_a + bytes_cmp, buf_a, chunk_sz,
+                               &data_a) ||
+            bootutil_flash_ptr(fap_b, off_b + bytes_cmp, buf_b, chunk_sz,
+                               &data_b)) {
+            return 0;
+        }
+
+        if (memcmp(data_a, data_b, chunk_sz) != 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+#endif /* MCUBOOT_SWAP_SKIP_IDENTICAL */
+
+void
+swap_status_reader_init(struct swap_status_reader *r,
+                        const struct boot_loader_state *state,
+                        const struct flash_area *fap, int max_entries)
+{
+    r->fap = fap;
+    r->off = boot_status_off(fap);
+    r->max_entries = max_entries;
+    r->first = 0;
+    r->count = 0;
+    r->write_sz = BOOT_WRITE_SZ(state);
+    r->erased = 0;
+}
+
+int
+swap_status_reader_get(struct swap_status_reader *r, int idx,
+                       uint8_t *status)
+{
+    int per_read;
+    int rc;
+
+    if (idx < r->first || idx >= r->first + r->count) {
+        /* Reads are aligned on a multiple of the read size, so that a scan
+         * in either direction reads each burst once.
+         */
+        per_read = sizeof(r->buf) / r->write_sz;
+        r->first = idx - idx % per_read;
+        r->count = r->max_entries - r->first;
+        if (r->count > per_read) {
+            r->count = per_read;
+        }
+
+        rc = flash_area_read_is_empty(r->fap, r->off + r->first * r->write_sz,
+                                      r->buf, r->count * r->write_sz);
+        if (rc < 0) {
+            r->count = 0;
+            return -1;
+        }
+        r->erased = (rc == 1);
+    }
+
+    if (r->erased) {
+        return 1;
+    }
+
+    /* Part of the burst is written.  Erased flash does not read back as the
+     * erased value on every port, so each entry is then checked on its own.
+     */
+    rc = flash_area_read_is_empty(r->fap, r->off + idx * r->write_sz, status,
+                                  1);
+    if (rc < 0) {
+        return -1;
+    }
+
+    return rc;
+}
+
 int
 swap_read_status(struct boot_loader_state *state, struct boot_status *bs)
 {
@@ -227,4 +351,5 @@ out:
 }
 
 
-#endif /* defined(MCUBOOT_SWAP_USING_SCRATCH) || defined(MCUBOOT_SWAP_USING_MOVE) */
+#endif /* defined(MCUBOOT_SWAP_USING_SCRATCH) || defined(MCUBOOT_SWAP_USING_MOVE) ||
+          defined(MCUBOOT_SWAP_USING_RAM) */
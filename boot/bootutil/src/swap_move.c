@@ -49,6 +49,157 @@ int boot_status_fails = 0;
 #endif
 
 static uint32_t g_last_idx = UINT32_MAX;
+static uint32_t g_last_move_idx = UINT32_MAX;
+
+/*
+ * Returns the index of the first sector of a slot holding the trailer.
+ */
+static size_t
+boot_first_trailer_idx(struct boot_loader_state *state, int slot)
+{
+    size_t first_trailer_idx;
+    uint32_t trailer_sz;
+    uint32_t sz;
+
+    sz = 0;
+    trailer_sz = boot_trailer_sz(BOOT_WRITE_SZ(state));
+    first_trailer_idx = boot_img_num_sectors(state, slot);
+
+    while (sz < trailer_sz && first_trailer_idx > 0) {
+        first_trailer_idx--;
+        sz += boot_img_sector_size(state, slot, first_trailer_idx);
+    }
+
+    return first_trailer_idx;
+}
+
+/*
+ * Walks the ranges of sectors swapped, in order.  Ranges start and end on
+ * sector boundaries of both slots, so with the same layout in both slots a
+ * range is a single sector.
+ */
+struct boot_swap_range_iter {
+    size_t pri_idx;
+    size_t sec_idx;
+    uint32_t pri_end;
+    uint32_t sec_end;
+};
+
+static void
+boot_swap_range_begin(struct boot_swap_range_iter *it)
+{
+    memset(it, 0, sizeof(*it));
+}
+
+/*
+ * Finds the next range of sectors swapped.
+ *
+ * @return                      0 on success; nonzero if the slots have no
+ *                                  more boundaries in common.
+ */
+static int
+boot_swap_range_next(struct boot_loader_state *state,
+                     struct boot_swap_range_iter *it, uint32_t *off,
+                     uint32_t *sz)
+{
+    uint32_t start;
+
+    /* The previous range ended on a boundary of both slots. */
+    start = it->pri_end;
+
+    while (1) {
+        if (it->pri_end <= it->sec_end) {
+            if (it->pri_idx == boot_img_num_sectors(state, BOOT_PRIMARY_SLOT)) {
+                return -1;
+            }
+            it->pri_end += boot_img_sector_size(state, BOOT_PRIMARY_SLOT,
+                                                it->pri_idx++);
+        } else {
+            if (it->sec_idx ==
+                    boot_img_num_sectors(state, BOOT_SECONDARY_SLOT)) {
+                return -1;
+            }
+            it->sec_end += boot_img_sector_size(state, BOOT_SECONDARY_SLOT,
+                                                it->sec_idx++);
+        }
+
+        if (it->pri_end == it->sec_end) {
+            *off = start;
+            *sz = it->pri_end - start;
+            return 0;
+        }
+    }
+}
+
+/*
+ * Finds the range of sectors swapped at step idx.
+ *
+ * @return                      0 on success; nonzero if the slots have no
+ *                                  more boundaries in common.
+ */
+static int
+boot_swap_range(struct boot_loader_state *state, uint32_t idx, uint32_t *off,
+                uint32_t *sz)
+{
+    struct boot_swap_range_iter it;
+    int rc;
+
+    boot_swap_range_begin(&it);
+    do {
+        rc = boot_swap_range_next(state, &it, off, sz);
+    } while (rc == 0 && idx-- > 0);
+
+    return rc;
+}
+
+/*
+ * Returns how far the image in the primary slot is moved up before the
+ * swap.  Neither a sector nor a swapped range may overlap the range it is
+ * moved to, so this is the first sector boundary that is not below the size
+ * of any of those that can hold part of an image; with sectors all of the
+ * same size in both slots, images are moved up by one sector.  Only called
+ * from boot_slots_compatible(), which stores it for BOOT_MOVE_SZ().
+ */
+static uint32_t
+boot_move_sz(struct boot_loader_state *state)
+{
+    struct boot_swap_range_iter it;
+    size_t first_trailer_idx;
+    size_t num_sectors;
+    uint32_t trailer_off;
+    uint32_t max_sz;
+    uint32_t off;
+    uint32_t sz;
+    size_t i;
+
+    num_sectors = boot_img_num_sectors(state, BOOT_PRIMARY_SLOT);
+    first_trailer_idx = boot_first_trailer_idx(state, BOOT_PRIMARY_SLOT);
+    trailer_off = boot_img_sector_off(state, BOOT_PRIMARY_SLOT,
+                                      first_trailer_idx);
+
+    max_sz = boot_img_sector_size(state, BOOT_PRIMARY_SLOT, 0);
+    for (i = 1; i < first_trailer_idx; i++) {
+        sz = boot_img_sector_size(state, BOOT_PRIMARY_SLOT, i);
+        if (sz > max_sz) {
+            max_sz = sz;
+        }
+    }
+
+    boot_swap_range_begin(&it);
+    while (boot_swap_range_next(state, &it, &off, &sz) == 0 &&
+           off < trailer_off) {
+        if (sz > max_sz) {
+            max_sz = sz;
+        }
+    }
+
+    sz = 0;
+    for (i = 0; i < num_sectors && sz < max_sz; i++) {
+        sz += boot_img_sector_size(state, BOOT_PRIMARY_SLOT, i);
+    }
+
+    return sz;
+}
 
 int
 boot_read_image_header(struct boot_loader_state *state, int slot,
@@ -66,10 +217,10 @@ boot_read_image_header(struct boot_loader_state *state, int slot,
 
     off = 0;
     if (bs) {
-        sz = boot_img_sector_size(state, BOOT_PRIMARY_SLOT, 0);
+        sz = BOOT_MOVE_SZ(state);
         if (bs->op == BOOT_STATUS_OP_MOVE) {
-            if (slot == 0 && bs->idx > g_last_idx) {
-                /* second sector */
+            if (slot == 0 && bs->idx > g_last_move_idx) {
+                /* moved up */
                 off = sz;
             }
         } else if (bs->op == BOOT_STATUS_OP_SWAP) {
@@ -120,11 +271,10 @@ int
 swap_read_status_bytes(const struct flash_area *fap,
         struct boot_loader_state *state, struct boot_status *bs)
 {
-    uint32_t off;
+    struct swap_status_reader reader;
     uint8_t status;
     int max_entries;
     int found_idx;
-    uint8_t write_sz;
     int move_entries;
     int rc;
     int last_rc;
@@ -136,14 +286,14 @@ swap_read_status_bytes(const struct flash_area *fap,
         return BOOT_EBADARGS;
     }
 
+    swap_status_reader_init(&reader, state, fap, max_entries);
+
     erased_sections = 0;
     found_idx = -1;
     /* skip erased sectors at the end */
     last_rc = 1;
-    write_sz = BOOT_WRITE_SZ(state);
-    off = boot_status_off(fap);
     for (i = max_entries; i > 0; i--) {
-        rc = flash_area_read_is_empty(fap, off + (i - 1) * write_sz, &status, 1);
+        rc = swap_status_reader_get(&reader, i - 1, &status);
         if (rc < 0) {
             return BOOT_EFLASH;
         }
@@ -212,26 +362,21 @@ boot_status_internal_off(const struct boot_status *bs, int elem_sz)
 int
 boot_slots_compatible(struct boot_loader_state *state)
 {
-    size_t num_sectors;
-    size_t i;
+    size_t first_trailer_idx;
 
-    num_sectors = boot_img_num_sectors(state, BOOT_PRIMARY_SLOT);
-    if (num_sectors != boot_img_num_sectors(state, BOOT_SECONDARY_SLOT)) {
-        BOOT_LOG_WRN("Cannot upgrade: slots don't have same amount of sectors");
-        return 0;
-    }
-
-    if (num_sectors > BOOT_MAX_IMG_SECTORS) {
+    if (boot_img_num_sectors(state, BOOT_PRIMARY_SLOT) > BOOT_MAX_IMG_SECTORS ||
+        boot_img_num_sectors(state, BOOT_SECONDARY_SLOT) > BOOT_MAX_IMG_SECTORS) {
         BOOT_LOG_WRN("Cannot upgrade: more sectors than allowed");
         return 0;
     }
 
-    for (i = 0; i < num_sectors; i++) {
-        if (boot_img_sector_size(state, BOOT_PRIMARY_SLOT, i) !=
-                boot_img_sector_size(state, BOOT_SECONDARY_SLOT, i)) {
-            BOOT_LOG_WRN("Cannot upgrade: not same sector layout");
-            return 0;
-        }
+    BOOT_MOVE_SZ(state) = boot_move_sz(state);
+
+    first_trailer_idx = boot_first_trailer_idx(state, BOOT_PRIMARY_SLOT);
+    if (BOOT_MOVE_SZ(state) >=
+            boot_img_sector_off(state, BOOT_PRIMARY_SLOT, first_trailer_idx)) {
+        BOOT_LOG_WRN("Cannot upgrade: no room to move the primary image up");
+        return 0;
     }
 
     return 1;
@@ -282,25 +427,22 @@ swap_status_source(struct boot_loader_state *state)
 }
 
 /*
- * "Moves" the sector located at idx - 1 to idx.
+ * Fills the sector located at idx with the data located move_sz bytes below.
  */
 static void
-boot_move_sector_up(int idx, uint32_t sz, struct boot_loader_state *state,
+boot_move_sector_up(int idx, uint32_t move_sz, struct boot_loader_state *state,
         struct boot_status *bs, const struct flash_area *fap_pri,
         const struct flash_area *fap_sec)
 {
     uint32_t new_off;
     uint32_t old_off;
+    uint32_t sz;
     int rc;
 
-    /*
-     * FIXME: assuming sectors of size == sz, a single off variable
-     * would be enough
-     */
-
     /* Calculate offset from start of image area. */
     new_off = boot_img_sector_off(state, BOOT_PRIMARY_SLOT, idx);
-    old_off = boot_img_sector_off(state, BOOT_PRIMARY_SLOT, idx - 1);
+    old_off = new_off - move_sz;
+    sz = boot_img_sector_size(state, BOOT_PRIMARY_SLOT, idx);
 
     if (bs->idx == BOOT_STATUS_IDX_0) {
         if (bs->source != BOOT_STATUS_SOURCE_PRIMARY_SLOT) {
@@ -315,11 +457,21 @@ boot_move_sector_up(int idx, uint32_t sz, struct boot_loader_state *state,
         assert(rc == 0);
     }
 
-    rc = boot_erase_region(fap_pri, new_off, sz);
-    assert(rc == 0);
+#ifdef MCUBOOT_SWAP_SKIP_IDENTICAL
+    /*
+     * The source of each copy is left untouched until its status is written,
+     * so a destination that already matches it is done, whether it was like
+     * that from the start or written before a reset.
+     */
+    if (!swap_regions_identical(state, fap_pri, old_off, fap_pri, new_off, sz))
+#endif
+    {
+        rc = boot_erase_region_start(fap_pri, new_off, sz);
+        assert(rc == 0);
 
-    rc = boot_copy_region(state, fap_pri, fap_pri, old_off, new_off, sz);
-    assert(rc == 0);
+        rc = boot_copy_region(state, fap_pri, fap_pri, old_off, new_off, sz);
+        assert(rc == 0);
+    }
 
     rc = boot_write_status(state, bs);
 
@@ -327,26 +479,40 @@ boot_move_sector_up(int idx, uint32_t sz, struct boot_loader_state *state,
     BOOT_STATUS_ASSERT(rc == 0);
 }
 
+/*
+ * Swaps the range of sectors found for step idx - 1, whose content in the
+ * primary slot was moved up by move_sz bytes.
+ */
 static void
-boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
+boot_swap_sectors(int idx, uint32_t move_sz, struct boot_loader_state *state,
         struct boot_status *bs, const struct flash_area *fap_pri,
         const struct flash_area *fap_sec)
 {
     uint32_t pri_off;
     uint32_t pri_up_off;
     uint32_t sec_off;
+    uint32_t sz;
     int rc;
 
-    pri_up_off = boot_img_sector_off(state, BOOT_PRIMARY_SLOT, idx);
-    pri_off = boot_img_sector_off(state, BOOT_PRIMARY_SLOT, idx - 1);
-    sec_off = boot_img_sector_off(state, BOOT_SECONDARY_SLOT, idx - 1);
+    rc = boot_swap_range(state, idx - 1, &pri_off, &sz);
+    assert(rc == 0);
+
+    pri_up_off = pri_off + move_sz;
+    sec_off = pri_off;
 
     if (bs->state == BOOT_STATUS_STATE_0) {
-        rc = boot_erase_region(fap_pri, pri_off, sz);
-        assert(rc == 0);
+#ifdef MCUBOOT_SWAP_SKIP_IDENTICAL
+        if (!swap_regions_identical(state, fap_sec, sec_off, fap_pri, pri_off,
+                                    sz))
+#endif
+        {
+            rc = boot_erase_region_start(fap_pri, pri_off, sz);
+            assert(rc == 0);
 
-        rc = boot_copy_region(state, fap_sec, fap_pri, sec_off, pri_off, sz);
-        assert(rc == 0);
+            rc = boot_copy_region(state, fap_sec, fap_pri, sec_off, pri_off,
+                                  sz);
+            assert(rc == 0);
+        }
 
         rc = boot_write_status(state, bs);
         bs->state = BOOT_STATUS_STATE_1;
@@ -354,11 +520,18 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
     }
 
     if (bs->state == BOOT_STATUS_STATE_1) {
-        rc = boot_erase_region(fap_sec, sec_off, sz);
-        assert(rc == 0);
+#ifdef MCUBOOT_SWAP_SKIP_IDENTICAL
+        if (!swap_regions_identical(state, fap_pri, pri_up_off, fap_sec,
+                                    sec_off, sz))
+#endif
+        {
+            rc = boot_erase_region_start(fap_sec, sec_off, sz);
+            assert(rc == 0);
 
-        rc = boot_copy_region(state, fap_pri, fap_sec, pri_up_off, sec_off, sz);
-        assert(rc == 0);
+            rc = boot_copy_region(state, fap_pri, fap_sec, pri_up_off, sec_off,
+                                  sz);
+            assert(rc == 0);
+        }
 
         rc = boot_write_status(state, bs);
         bs->idx++;
@@ -419,46 +592,61 @@ void
 swap_run(struct boot_loader_state *state, struct boot_status *bs,
          uint32_t copy_size)
 {
+    struct boot_swap_range_iter it;
+    size_t num_sectors;
+    uint32_t off;
     uint32_t sz;
-    uint32_t sector_sz;
+    uint32_t range_sz;
+    uint32_t move_sz;
+    uint32_t move_idx;
     uint32_t idx;
-    uint32_t trailer_sz;
-    uint32_t first_trailer_idx;
+    uint32_t pri_trailer_off;
+    uint32_t sec_trailer_off;
     uint8_t image_index;
     const struct flash_area *fap_pri;
     const struct flash_area *fap_sec;
     int rc;
 
+    num_sectors = boot_img_num_sectors(state, BOOT_PRIMARY_SLOT);
+    move_sz = BOOT_MOVE_SZ(state);
+
+    /* Find the ranges of sectors holding either image. */
     sz = 0;
     g_last_idx = 0;
-
-    sector_sz = boot_img_sector_size(state, BOOT_PRIMARY_SLOT, 0);
-    while (1) {
-        sz += sector_sz;
-        /* Skip to next sector because all sectors will be moved up. */
-        g_last_idx++;
-        if (sz >= copy_size) {
+    boot_swap_range_begin(&it);
+    do {
+        if (boot_swap_range_next(state, &it, &off, &range_sz) != 0) {
             break;
         }
+        sz = off + range_sz;
+        g_last_idx++;
+    } while (sz < copy_size);
+
+    /* Find the sectors they are moved up to; move_sz is a sector boundary. */
+    move_idx = 0;
+    while (move_idx < num_sectors &&
+           boot_img_sector_off(state, BOOT_PRIMARY_SLOT, move_idx) < move_sz) {
+        move_idx++;
+    }
+
+    g_last_move_idx = 0;
+    while (move_idx + g_last_move_idx < num_sectors &&
+           boot_img_sector_off(state, BOOT_PRIMARY_SLOT,
+                               move_idx + g_last_move_idx) < move_sz + sz) {
+        g_last_move_idx++;
     }
 
     /*
      * When starting a new swap upgrade, check that there is enough space.
      */
     if (boot_status_is_reset(bs)) {
-        sz = 0;
-        trailer_sz = boot_trailer_sz(BOOT_WRITE_SZ(state));
-        first_trailer_idx = boot_img_num_sectors(state, BOOT_PRIMARY_SLOT) - 1;
-
-        while (1) {
-            sz += sector_sz;
-            if  (sz >= trailer_sz) {
-                break;
-            }
-            first_trailer_idx--;
-        }
+        pri_trailer_off = boot_img_sector_off(state, BOOT_PRIMARY_SLOT,
+                boot_first_trailer_idx(state, BOOT_PRIMARY_SLOT));
+        sec_trailer_off = boot_img_sector_off(state, BOOT_SECONDARY_SLOT,
+                boot_first_trailer_idx(state, BOOT_SECONDARY_SLOT));
 
-        if (g_last_idx >= first_trailer_idx) {
+        if (sz < copy_size || move_sz + sz > pri_trailer_off ||
+                sz > sec_trailer_off) {
             BOOT_LOG_WRN("Not enough free space to run swap upgrade");
             bs->swap_type = BOOT_SWAP_TYPE_NONE;
             return;
@@ -476,10 +664,11 @@ swap_run(struct boot_loader_state *state, struct boot_status *bs,
     fixup_revert(state, bs, fap_sec, FLASH_AREA_IMAGE_SECONDARY(image_index));
 
     if (bs->op == BOOT_STATUS_OP_MOVE) {
-        idx = g_last_idx;
+        idx = g_last_move_idx;
         while (idx > 0) {
-            if (idx <= (g_last_idx - bs->idx + 1)) {
-                boot_move_sector_up(idx, sector_sz, state, bs, fap_pri, fap_sec);
+            if (idx <= (g_last_move_idx - bs->idx + 1)) {
+                boot_move_sector_up(move_idx + idx - 1, move_sz, state, bs,
+                                    fap_pri, fap_sec);
             }
             idx--;
         }
@@ -491,7 +680,7 @@ swap_run(struct boot_loader_state *state, struct boot_status *bs,
     idx = 1;
     while (idx <= g_last_idx) {
         if (idx >= bs->idx) {
-            boot_swap_sectors(idx, sector_sz, state, bs, fap_pri, fap_sec);
+            boot_swap_sectors(idx, move_sz, state, bs, fap_pri, fap_sec);
         }
         idx++;
     }
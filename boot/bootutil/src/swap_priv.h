@@ -21,7 +21,8 @@
 
 #include "mcuboot_config/mcuboot_config.h"
 
-#if defined(MCUBOOT_SWAP_USING_SCRATCH) || defined(MCUBOOT_SWAP_USING_MOVE)
+#if defined(MCUBOOT_SWAP_USING_SCRATCH) || defined(MCUBOOT_SWAP_USING_MOVE) || \
+    defined(MCUBOOT_SWAP_USING_RAM)
 
 /**
  * Calculates the amount of space required to store the trailer, and erases
@@ -57,6 +58,39 @@ int swap_status_source(struct boot_loader_state *state);
  */
 int swap_read_status(struct boot_loader_state *state, struct boot_status *bs);
 
+/* Number of bytes of the swap status read from flash at once. */
+#define BOOT_STATUS_READ_SZ     BOOT_TMPBUF_SZ
+
+/**
+ * Window over the swap status entries of an area.  The entries are read in
+ * bursts of BOOT_STATUS_READ_SZ bytes, so that a burst found fully erased,
+ * which is most of the status area, takes a single read instead of one per
+ * entry.  The entries of any other burst are checked one at a time.
+ */
+struct swap_status_reader {
+    const struct flash_area *fap;
+    uint32_t off;           /* Offset of the first status entry */
+    int max_entries;
+    int first;              /* Index of the first entry in buf */
+    int count;              /* Number of entries in buf */
+    uint8_t write_sz;
+    uint8_t erased;         /* All the entries in buf are erased */
+    uint8_t buf[BOOT_STATUS_READ_SZ];
+};
+
+void swap_status_reader_init(struct swap_status_reader *r,
+                             const struct boot_loader_state *state,
+                             const struct flash_area *fap, int max_entries);
+
+/**
+ * Looks up status entry idx, reading the burst holding it if needed.
+ *
+ * Returns 1 if the entry is erased, 0 if it was written, in which case its
+ * status byte is stored in *status, or a negative value on flash error.
+ */
+int swap_status_reader_get(struct swap_status_reader *r, int idx,
+                           uint8_t *status);
+
 /**
  * Iterate over the swap status bytes in the given flash_area and populate
  * the given boot_status with the calculated index where a swap upgrade was
@@ -82,6 +116,19 @@ int swap_set_copy_done(uint8_t image_index);
  */
 int swap_set_image_ok(uint8_t image_index);
 
+#ifdef MCUBOOT_SWAP_SKIP_IDENTICAL
+/**
+ * Checks whether sz bytes at off_a in fap_a hold the same data as sz bytes
+ * at off_b in fap_b, in which case copying one to the other can be skipped.
+ *
+ * Returns 1 if they do, 0 if they do not or cannot be compared.
+ */
+int swap_regions_identical(struct boot_loader_state *state,
+                           const struct flash_area *fap_a, uint32_t off_a,
+                           const struct flash_area *fap_b, uint32_t off_b,
+                           uint32_t sz);
+#endif
+
 /**
  * Start a new or resume an interrupted swap according to the parameters
  * found in the given boot_status.
@@ -90,6 +137,38 @@ void swap_run(struct boot_loader_state *state,
               struct boot_status *bs,
               uint32_t copy_size);
 
+#ifdef MCUBOOT_DELTA_UPGRADE
+/**
+ * Checks that the patch in the secondary slot was made against the image in
+ * the primary slot, and that it can be applied in place.
+ *
+ * Returns 0 if the patch can be applied, nonzero otherwise.
+ */
+int swap_delta_check(struct boot_loader_state *state);
+
+/**
+ * Reads the status of an interrupted patch from the trailer of the
+ * secondary slot, if a patch is being applied.
+ */
+int swap_delta_read_status(struct boot_loader_state *state,
+                           struct boot_status *bs);
+
+/* Returned by swap_delta_run() for a patch rejected before anything was
+ * written.
+ */
+#define SWAP_DELTA_REJECTED     (-1)
+
+/**
+ * Start a new or resume an interrupted patch of the primary slot according
+ * to the parameters found in the given boot_status.
+ *
+ * Returns 0 on success, SWAP_DELTA_REJECTED if the patch cannot be applied
+ * and the primary slot was left untouched, and a BOOT_E* error once the
+ * primary slot has been modified.
+ */
+int swap_delta_run(struct boot_loader_state *state, struct boot_status *bs);
+#endif
+
 #if MCUBOOT_SWAP_USING_SCRATCH
 #define BOOT_SCRATCH_AREA(state) ((state)->scratch.area)
 
@@ -99,6 +178,7 @@ static inline size_t boot_scratch_area_size(const struct boot_loader_state *stat
 }
 #endif
 
-#endif /* defined(MCUBOOT_SWAP_USING_SCRATCH) || defined(MCUBOOT_SWAP_USING_MOVE) */
+#endif /* defined(MCUBOOT_SWAP_USING_SCRATCH) || defined(MCUBOOT_SWAP_USING_MOVE) ||
+          defined(MCUBOOT_SWAP_USING_RAM) */
 
 #endif /* H_SWAP_PRIV_ */
@@ -0,0 +1,598 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <string.h>
+#include "bootutil/bootutil.h"
+#include "bootutil/image.h"
+#include "bootutil/sha256.h"
+#include "bootutil_priv.h"
+#include "swap_priv.h"
+#include "bootutil/bootutil_log.h"
+
+#include "mcuboot_config/mcuboot_config.h"
+
+MCUBOOT_LOG_MODULE_DECLARE(mcuboot);
+
+#ifdef MCUBOOT_SWAP_USING_RAM
+
+/*
+ * The sectors holding the images are swapped one at a time, from the last one
+ * to the first, through a buffer in RAM.  Both slots must have the same
+ * layout, and their trailers are not swapped, so the images must end before
+ * the trailer sectors.  For each sector:
+ *
+ *   - STATE_0: the sector of the primary slot is read into RAM, and the
+ *     hash of its content is written to the swap status.
+ *   - STATE_1: the sector of the primary slot is erased and the one of the
+ *     secondary slot copied over it.
+ *   - STATE_2: the sector of the secondary slot is erased and written from
+ *     RAM.
+ *
+ * Between the start of STATE_1 and the end of STATE_2, RAM holds the only
+ * full copy of the old sector.  When resuming from either state, the hash
+ * tells whether the sector of the primary slot was still left untouched, or
+ * whether the one of the secondary slot was already written.  Otherwise the
+ * old sector is lost: the swap still installs the new image, but the copy of
+ * the old one left in the secondary slot is incomplete and fails validation.
+ *
+ * As that copy cannot be relied upon, only permanent upgrades are supported;
+ * test upgrades are refused, so a swap is never reverted.
+ */
+
+#if defined(MCUBOOT_VALIDATE_PRIMARY_SLOT)
+/*
+ * FIXME: this might have to be updated for threaded sim
+ */
+int boot_status_fails = 0;
+#define BOOT_STATUS_ASSERT(x)                \
+    do {                                     \
+        if (!(x)) {                          \
+            boot_status_fails++;             \
+        }                                    \
+    } while (0)
+#else
+#define BOOT_STATUS_ASSERT(x) ASSERT(x)
+#endif
+
+/* See loader.c */
+#if !defined(__BOOTSIM__)
+#define TARGET_STATIC static
+#else
+#define TARGET_STATIC
+#endif
+
+int
+boot_read_image_header(struct boot_loader_state *state, int slot,
+                       struct image_header *out_hdr, struct boot_status *bs)
+{
+    const struct flash_area *fap;
+    int area_id;
+    int rc;
+
+    /* The first sector is swapped last, so the headers stay in place. */
+    (void)bs;
+
+#if (BOOT_IMAGE_NUMBER == 1)
+    (void)state;
+#endif
+
+    area_id = flash_area_id_from_multi_image_slot(BOOT_CURR_IMG(state), slot);
+    rc = flash_area_open(area_id, &fap);
+    if (rc != 0) {
+        rc = BOOT_EFLASH;
+        goto done;
+    }
+
+    rc = flash_area_read(fap, 0, out_hdr, sizeof *out_hdr);
+    if (rc != 0) {
+        rc = BOOT_EFLASH;
+        goto done;
+    }
+
+    rc = 0;
+
+done:
+    flash_area_close(fap);
+    return rc;
+}
+
+int
+swap_read_status_bytes(const struct flash_area *fap,
+        struct boot_loader_state *state, struct boot_status *bs)
+{
+    struct swap_status_reader reader;
+    uint8_t status;
+    int max_entries;
+    int found;
+    int found_idx;
+    int invalid;
+    int rc;
+    int i;
+
+    max_entries = boot_status_entries(BOOT_CURR_IMG(state), fap);
+    if (max_entries < 0) {
+        return BOOT_EBADARGS;
+    }
+
+    swap_status_reader_init(&reader, state, fap, max_entries);
+
+    found = 0;
+    found_idx = 0;
+    invalid = 0;
+    for (i = 0; i < max_entries; i++) {
+        rc = swap_status_reader_get(&reader, i, &status);
+        if (rc < 0) {
+            return BOOT_EFLASH;
+        }
+
+        if (rc == 1) {
+            if (found && !found_idx) {
+                found_idx = i;
+            }
+        } else if (!found) {
+            found = 1;
+        } else if (found_idx) {
+            invalid = 1;
+            break;
+        }
+    }
+
+    if (invalid) {
+        /* This means there was an error writing status on the last
+         * swap. Tell user and move on to validation!
+         */
+#if !defined(__BOOTSIM__)
+        BOOT_LOG_ERR("Detected inconsistent status!");
+#endif
+
+#if !defined(MCUBOOT_VALIDATE_PRIMARY_SLOT)
+        /* With validation of the primary slot disabled, there is no way
+         * to be sure the swapped primary slot is OK, so abort!
+         */
+        assert(0);
+#endif
+    }
+
+    if (found) {
+        if (!found_idx) {
+            found_idx = i;
+        }
+        bs->idx = (found_idx / BOOT_STATUS_STATE_COUNT) + 1;
+        bs->state = (found_idx % BOOT_STATUS_STATE_COUNT) + 1;
+    }
+
+    return 0;
+}
+
+uint32_t
+boot_status_internal_off(const struct boot_status *bs, int elem_sz)
+{
+    int idx_sz;
+
+    idx_sz = elem_sz * BOOT_STATUS_STATE_COUNT;
+
+    return (bs->idx - BOOT_STATUS_IDX_0) * idx_sz +
+           (bs->state - BOOT_STATUS_STATE_0) * elem_sz;
+}
+
+/*
+ * The hashes follow the state entries in the status area.
+ */
+static uint32_t
+boot_status_hash_off(const struct boot_loader_state *state,
+                     const struct boot_status *bs,
+                     const struct flash_area *fap)
+{
+    return boot_status_off(fap) +
+           BOOT_STATUS_MAX_ENTRIES * BOOT_STATUS_STATE_COUNT *
+           BOOT_WRITE_SZ(state) +
+           (bs->idx - BOOT_STATUS_IDX_0) * BOOT_SWAP_RAM_HASH_ALIGN_SIZE;
+}
+
+int
+boot_slots_compatible(struct boot_loader_state *state)
+{
+    size_t num_sectors;
+    size_t i;
+
+    num_sectors = boot_img_num_sectors(state, BOOT_PRIMARY_SLOT);
+    if (num_sectors != boot_img_num_sectors(state, BOOT_SECONDARY_SLOT)) {
+        BOOT_LOG_WRN("Cannot upgrade: slots don't have same amount of sectors");
+        return 0;
+    }
+
+    if (num_sectors > BOOT_MAX_IMG_SECTORS) {
+        BOOT_LOG_WRN("Cannot upgrade: more sectors than allowed");
+        return 0;
+    }
+
+    for (i = 0; i < num_sectors; i++) {
+        if (boot_img_sector_size(state, BOOT_PRIMARY_SLOT, i) !=
+                boot_img_sector_size(state, BOOT_SECONDARY_SLOT, i)) {
+            BOOT_LOG_WRN("Cannot upgrade: not same sector layout");
+            return 0;
+        }
+
+        if (boot_img_sector_size(state, BOOT_PRIMARY_SLOT, i) >
+                MCUBOOT_SWAP_RAM_BUF_SIZE) {
+            BOOT_LOG_WRN("Cannot upgrade: not all sectors fit in RAM");
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+#define BOOT_LOG_SWAP_STATE(area, state)                            \
+    BOOT_LOG_INF("%s: magic=%s, swap_type=0x%x, copy_done=0x%x, "   \
+                 "image_ok=0x%x",                                   \
+                 (area),                                            \
+                 ((state)->magic == BOOT_MAGIC_GOOD ? "good" :      \
+                  (state)->magic == BOOT_MAGIC_UNSET ? "unset" :    \
+                  "bad"),                                           \
+                 (state)->swap_type,                                \
+                 (state)->copy_done,                                \
+                 (state)->image_ok)
+
+int
+swap_status_source(struct boot_loader_state *state)
+{
+    struct boot_swap_state state_primary_slot;
+    int rc;
+    uint8_t image_index;
+
+#if (BOOT_IMAGE_NUMBER == 1)
+    (void)state;
+#endif
+
+    image_index = BOOT_CURR_IMG(state);
+
+    rc = boot_read_swap_state_by_id(FLASH_AREA_IMAGE_PRIMARY(image_index),
+            &state_primary_slot);
+    assert(rc == 0);
+
+    BOOT_LOG_SWAP_STATE("Primary image", &state_primary_slot);
+
+    if (state_primary_slot.magic == BOOT_MAGIC_GOOD &&
+            state_primary_slot.copy_done == BOOT_FLAG_UNSET) {
+        BOOT_LOG_INF("Boot source: primary slot");
+        return BOOT_STATUS_SOURCE_PRIMARY_SLOT;
+    }
+
+    BOOT_LOG_INF("Boot source: none");
+    return BOOT_STATUS_SOURCE_NONE;
+}
+
+/*
+ * Encrypts a sector of the image in the primary slot as it is stored in the
+ * secondary slot, or decrypts it back.  The header read at boot may already
+ * be the one of the new image, so the first sector uses its own.
+ */
+static void
+swap_ram_crypt(struct boot_loader_state *state,
+               const struct flash_area *fap_pri, uint32_t off,
+               uint8_t *buf, uint32_t sz)
+{
+#ifdef MCUBOOT_ENC_IMAGES
+    struct image_header hdr;
+
+    if (off == 0) {
+        memcpy(&hdr, buf, sizeof(hdr));
+        if (IS_ENCRYPTED(&hdr) &&
+                !boot_enc_valid(BOOT_CURR_ENC(state), BOOT_CURR_IMG(state),
+                                fap_pri)) {
+            /* Not the old image, whose key would have been loaded. */
+            return;
+        }
+    } else {
+        memcpy(&hdr, boot_img_hdr(state, BOOT_PRIMARY_SLOT), sizeof(hdr));
+    }
+
+    if (hdr.ih_magic == IMAGE_MAGIC) {
+        boot_encrypt_region(state, fap_pri, &hdr, off, buf, sz);
+    }
+#else
+    (void)state;
+    (void)fap_pri;
+    (void)off;
+    (void)buf;
+    (void)sz;
+#endif
+}
+
+static void
+swap_ram_hash(const uint8_t *buf, uint32_t sz, uint8_t *hash)
+{
+    bootutil_sha256_context sha256_ctx;
+    uint8_t digest[32];
+
+    bootutil_sha256_init(&sha256_ctx);
+    bootutil_sha256_update(&sha256_ctx, buf, sz);
+    bootutil_sha256_finish(&sha256_ctx, digest);
+
+    memcpy(hash, digest, BOOT_SWAP_RAM_HASH_SIZE);
+}
+
+/*
+ * Reads the sector at off of the primary slot into buf, and writes the hash
+ * of its content to hash.  swap_ram_crypt() must then be run on buf before
+ * writing it to the secondary slot.
+ */
+static int
+swap_ram_stage(const struct flash_area *fap_pri, uint32_t off, uint32_t sz,
+               uint8_t *buf, uint8_t *hash)
+{
+    int rc;
+
+    rc = flash_area_read(fap_pri, off, buf, sz);
+    if (rc != 0) {
+        return BOOT_EFLASH;
+    }
+
+    swap_ram_hash(buf, sz, hash);
+
+    return 0;
+}
+
+/*
+ * Returns 1 if the hash of the current sector in the swap status is the given
+ * one, 0 otherwise.
+ */
+static int
+swap_ram_hash_matches(const struct boot_loader_state *state,
+                      const struct boot_status *bs,
+                      const struct flash_area *fap_pri, const uint8_t *hash)
+{
+    uint8_t saved[BOOT_SWAP_RAM_HASH_ALIGN_SIZE];
+    int rc;
+
+    rc = flash_area_read_is_empty(fap_pri,
+                                  boot_status_hash_off(state, bs, fap_pri),
+                                  saved, sizeof(saved));
+    if (rc != 0) {
+        return 0;
+    }
+
+    return memcmp(saved, hash, BOOT_SWAP_RAM_HASH_SIZE) == 0;
+}
+
+static int
+swap_ram_write_hash(const struct boot_loader_state *state,
+                    const struct boot_status *bs,
+                    const struct flash_area *fap_pri, const uint8_t *hash)
+{
+    uint8_t buf[BOOT_SWAP_RAM_HASH_ALIGN_SIZE];
+    uint32_t off;
+    int rc;
+
+    off = boot_status_hash_off(state, bs, fap_pri);
+    rc = flash_area_read_is_empty(fap_pri, off, buf, sizeof(buf));
+    if (rc < 0) {
+        return BOOT_EFLASH;
+    }
+
+    if (rc == 0) {
+        /* Written before a reset, while the sector was the same. */
+        if (memcmp(buf, hash, BOOT_SWAP_RAM_HASH_SIZE) != 0) {
+            BOOT_LOG_WRN("Mismatched hash in the swap status");
+        }
+        return 0;
+    }
+
+    memset(buf, flash_area_erased_val(fap_pri), sizeof(buf));
+    memcpy(buf, hash, BOOT_SWAP_RAM_HASH_SIZE);
+
+    rc = flash_area_write(fap_pri, off, buf, sizeof(buf));
+    if (rc != 0) {
+        return BOOT_EFLASH;
+    }
+
+    return 0;
+}
+
+/*
+ * Checks whether the sector at off of the secondary slot was fully written
+ * from RAM before a reset.  buf is overwritten.
+ */
+static int
+swap_ram_sector_written(struct boot_loader_state *state,
+                        const struct boot_status *bs,
+                        const struct flash_area *fap_pri,
+                        const struct flash_area *fap_sec,
+                        uint32_t off, uint32_t sz, uint8_t *buf)
+{
+    uint8_t hash[BOOT_SWAP_RAM_HASH_SIZE];
+    int rc;
+
+    rc = flash_area_read(fap_sec, off, buf, sz);
+    if (rc != 0) {
+        return 0;
+    }
+
+    swap_ram_crypt(state, fap_pri, off, buf, sz);
+    swap_ram_hash(buf, sz, hash);
+
+    return swap_ram_hash_matches(state, bs, fap_pri, hash);
+}
+
+/*
+ * The only copy of a sector of the image being swapped out was in RAM when the
+ * swap was interrupted.  The new image is still installed in full; only the
+ * copy of the old one left in the secondary slot is incomplete.
+ */
+static void
+swap_ram_sector_lost(struct boot_loader_state *state)
+{
+    BOOT_LOG_WRN("Image %d: lost a sector of the image in the primary slot",
+                 BOOT_CURR_IMG(state));
+}
+
+static void
+boot_swap_sectors(int idx, struct boot_loader_state *state,
+        struct boot_status *bs, const struct flash_area *fap_pri,
+        const struct flash_area *fap_sec, uint8_t *buf)
+{
+    uint8_t hash[BOOT_SWAP_RAM_HASH_SIZE];
+    uint32_t off;
+    uint32_t sz;
+    bool staged;
+    int rc;
+
+    /* Both slots have the same layout. */
+    off = boot_img_sector_off(state, BOOT_PRIMARY_SLOT, idx);
+    sz = boot_img_sector_size(state, BOOT_PRIMARY_SLOT, idx);
+    staged = false;
+
+    if (bs->state == BOOT_STATUS_STATE_0) {
+        rc = swap_ram_stage(fap_pri, off, sz, buf, hash);
+        assert(rc == 0);
+        swap_ram_crypt(state, fap_pri, off, buf, sz);
+        staged = true;
+
+        rc = swap_ram_write_hash(state, bs, fap_pri, hash);
+        BOOT_STATUS_ASSERT(rc == 0);
+
+        rc = boot_write_status(state, bs);
+        bs->state = BOOT_STATUS_STATE_1;
+        BOOT_STATUS_ASSERT(rc == 0);
+    }
+
+    if (bs->state == BOOT_STATUS_STATE_1) {
+        if (!staged) {
+            /* The reset may have happened before the sector was erased. */
+            rc = swap_ram_stage(fap_pri, off, sz, buf, hash);
+            staged = rc == 0 && swap_ram_hash_matches(state, bs, fap_pri, hash);
+            if (staged) {
+                swap_ram_crypt(state, fap_pri, off, buf, sz);
+            } else {
+                swap_ram_sector_lost(state);
+            }
+        }
+
+        rc = boot_erase_region_start(fap_pri, off, sz);
+        assert(rc == 0);
+
+        rc = boot_copy_region(state, fap_sec, fap_pri, off, off, sz);
+        assert(rc == 0);
+
+        rc = boot_write_status(state, bs);
+        bs->state = BOOT_STATUS_STATE_2;
+        BOOT_STATUS_ASSERT(rc == 0);
+    }
+
+    if (bs->state == BOOT_STATUS_STATE_2) {
+        if (staged) {
+            rc = boot_erase_region(fap_sec, off, sz);
+            assert(rc == 0);
+
+            rc = flash_area_write(fap_sec, off, buf, sz);
+            assert(rc == 0);
+        } else if (!swap_ram_sector_written(state, bs, fap_pri, fap_sec, off,
+                                            sz, buf)) {
+            swap_ram_sector_lost(state);
+        }
+
+        rc = boot_write_status(state, bs);
+        bs->idx++;
+        bs->state = BOOT_STATUS_STATE_0;
+        BOOT_STATUS_ASSERT(rc == 0);
+    }
+}
+
+void
+swap_run(struct boot_loader_state *state, struct boot_status *bs,
+         uint32_t copy_size)
+{
+    TARGET_STATIC uint32_t buf[MCUBOOT_SWAP_RAM_BUF_SIZE / sizeof(uint32_t)];
+    size_t num_sectors;
+    uint32_t sz;
+    uint32_t trailer_sz;
+    int last_idx;
+    int first_trailer_idx;
+    int idx;
+    uint8_t image_index;
+    const struct flash_area *fap_pri;
+    const struct flash_area *fap_sec;
+    int rc;
+
+    num_sectors = boot_img_num_sectors(state, BOOT_PRIMARY_SLOT);
+
+    /* Find the last sector holding either image. */
+    last_idx = 0;
+    sz = boot_img_sector_size(state, BOOT_PRIMARY_SLOT, 0);
+    while (sz < copy_size && (size_t)last_idx + 1 < num_sectors) {
+        last_idx++;
+        sz += boot_img_sector_size(state, BOOT_PRIMARY_SLOT, last_idx);
+    }
+
+    /*
+     * When starting a new swap upgrade, check that the images do not reach
+     * the trailers.
+     */
+    if (boot_status_is_reset(bs)) {
+        sz = 0;
+        trailer_sz = boot_trailer_sz(BOOT_WRITE_SZ(state));
+        first_trailer_idx = num_sectors;
+
+        while (sz < trailer_sz && first_trailer_idx > 0) {
+            first_trailer_idx--;
+            sz += boot_img_sector_size(state, BOOT_PRIMARY_SLOT,
+                                       first_trailer_idx);
+        }
+
+        if (last_idx >= first_trailer_idx) {
+            BOOT_LOG_WRN("Not enough free space to run swap upgrade");
+            bs->swap_type = BOOT_SWAP_TYPE_NONE;
+            return;
+        }
+    }
+
+    image_index = BOOT_CURR_IMG(state);
+
+    rc = flash_area_open(FLASH_AREA_IMAGE_PRIMARY(image_index), &fap_pri);
+    assert (rc == 0);
+
+    rc = flash_area_open(FLASH_AREA_IMAGE_SECONDARY(image_index), &fap_sec);
+    assert (rc == 0);
+
+    if (boot_status_is_reset(bs)) {
+        if (bs->source != BOOT_STATUS_SOURCE_PRIMARY_SLOT) {
+            rc = swap_erase_trailer_sectors(state, fap_pri);
+            assert(rc == 0);
+
+            rc = swap_status_init(state, fap_pri, bs);
+            assert(rc == 0);
+        }
+
+        rc = swap_erase_trailer_sectors(state, fap_sec);
+        assert(rc == 0);
+    }
+
+    idx = last_idx - (int)(bs->idx - BOOT_STATUS_IDX_0);
+    while (idx >= 0) {
+        boot_swap_sectors(idx, state, bs, fap_pri, fap_sec, (uint8_t *)buf);
+        idx--;
+    }
+
+    flash_area_close(fap_pri);
+    flash_area_close(fap_sec);
+}
+
+#endif /* MCUBOOT_SWAP_USING_RAM */
@@ -31,7 +31,7 @@
 
 MCUBOOT_LOG_MODULE_DECLARE(mcuboot);
 
-#if !defined(MCUBOOT_SWAP_USING_MOVE)
+#if !defined(MCUBOOT_SWAP_USING_MOVE) && !defined(MCUBOOT_SWAP_USING_RAM)
 
 #if defined(MCUBOOT_VALIDATE_PRIMARY_SLOT)
 /*
@@ -82,6 +82,7 @@ done:
     return rc;
 }
 
+#ifndef MCUBOOT_OVERWRITE_ONLY
 /**
  * Reads the status of a partially-completed swap, if any.  This is necessary
  * to recover in case the boot lodaer was reset in the middle of a swap
@@ -91,7 +92,7 @@ int
 swap_read_status_bytes(const struct flash_area *fap,
         struct boot_loader_state *state, struct boot_status *bs)
 {
-    uint32_t off;
+    struct swap_status_reader reader;
     uint8_t status;
     int max_entries;
     int found;
@@ -99,19 +100,22 @@ swap_read_status_bytes(const struct flash_area *fap,
     int invalid;
     int rc;
     int i;
+#ifdef MCUBOOT_SWAP_SKIP_IDENTICAL
+    uint8_t last_status = 0;
+#endif
 
-    off = boot_status_off(fap);
     max_entries = boot_status_entries(BOOT_CURR_IMG(state), fap);
     if (max_entries < 0) {
         return BOOT_EBADARGS;
     }
 
+    swap_status_reader_init(&reader, state, fap, max_entries);
+
     found = 0;
     found_idx = 0;
     invalid = 0;
     for (i = 0; i < max_entries; i++) {
-        rc = flash_area_read_is_empty(fap, off + i * BOOT_WRITE_SZ(state),
-                &status, 1);
+        rc = swap_status_reader_get(&reader, i, &status);
         if (rc < 0) {
             return BOOT_EFLASH;
         }
@@ -126,6 +130,11 @@ swap_read_status_bytes(const struct flash_area *fap,
             invalid = 1;
             break;
         }
+#ifdef MCUBOOT_SWAP_SKIP_IDENTICAL
+        if (rc == 0 && !found_idx) {
+            last_status = status;
+        }
+#endif
     }
 
     if (invalid) {
@@ -150,10 +159,16 @@ swap_read_status_bytes(const struct flash_area *fap,
         }
         bs->idx = (found_idx / BOOT_STATUS_STATE_COUNT) + 1;
         bs->state = (found_idx % BOOT_STATUS_STATE_COUNT) + 1;
+#ifdef MCUBOOT_SWAP_SKIP_IDENTICAL
+        /* Resuming in the middle of a range that was found identical. */
+        bs->skipped = (bs->state != BOOT_STATUS_STATE_0 &&
+                       (last_status & BOOT_STATUS_SKIPPED));
+#endif
     }
 
     return 0;
 }
+#endif /* !MCUBOOT_OVERWRITE_ONLY */
 
 uint32_t
 boot_status_internal_off(const struct boot_status *bs, int elem_sz)
@@ -423,6 +438,231 @@ swap_status_source(struct boot_loader_state *state)
 }
 
 #ifndef MCUBOOT_OVERWRITE_ONLY
+#if defined(MCUBOOT_SCRATCH_WEAR_LEVELING) || \
+    defined(MCUBOOT_SWAP_SECTOR_STATUS)
+/**
+ * Finds the scratch sectors holding a region of the scratch area.
+ *
+ * @param off                   The offset of the region.
+ * @param sz                    The size of the region.
+ * @param out_start             The offset of the first sector holding the
+ *                                  region gets written here.
+ *
+ * @return                      The offset right after the last sector
+ *                                  holding the region.
+ */
+static uint32_t
+boot_scratch_sectors(const struct boot_loader_state *state, uint32_t off,
+                     uint32_t sz, uint32_t *out_start)
+{
+    uint32_t sector_off;
+    uint32_t end;
+    size_t i;
+
+    *out_start = 0;
+    for (i = 0; i < state->scratch.num_sectors; i++) {
+        sector_off = boot_scratch_sector_off(state, i);
+        end = sector_off + boot_scratch_sector_size(state, i);
+        if (sector_off <= off) {
+            *out_start = sector_off;
+        }
+        if (end >= off + sz) {
+            return end;
+        }
+    }
+
+    return boot_scratch_area_size(state);
+}
+
+/**
+ * Erases the scratch sectors holding a region of the scratch area, instead of
+ * the whole area.
+ */
+static int
+boot_erase_scratch(const struct boot_loader_state *state,
+                   const struct flash_area *fap_scratch, uint32_t off,
+                   uint32_t sz)
+{
+    uint32_t start;
+    uint32_t end;
+
+    end = boot_scratch_sectors(state, off, sz, &start);
+
+    return boot_erase_region(fap_scratch, start, end - start);
+}
+
+static bool
+boot_img_sector_boundary(const struct boot_loader_state *state, size_t slot,
+                         uint32_t off)
+{
+    size_t i;
+
+    for (i = 0; i < boot_img_num_sectors(state, slot); i++) {
+        if (boot_img_sector_off(state, slot, i) >= off) {
+            return boot_img_sector_off(state, slot, i) == off;
+        }
+    }
+
+    return false;
+}
+
+#endif
+
+#ifdef MCUBOOT_SWAP_SECTOR_STATUS
+static bool
+boot_scratch_sector_boundary(const struct boot_loader_state *state,
+                             uint32_t off)
+{
+    size_t i;
+
+    for (i = 0; i < state->scratch.num_sectors; i++) {
+        if (boot_scratch_sector_off(state, i) >= off) {
+            return boot_scratch_sector_off(state, i) == off;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Finds the end of the unit of a range starting at off: the first offset
+ * after it that falls on a sector boundary of both slots and of the scratch
+ * area, so that each destination of the range can be erased one unit at a
+ * time.
+ *
+ * @param img_off               The offset of the range in the slots.
+ * @param scratch_off           The offset of the range in the scratch area.
+ * @param off                   The offset of the unit within the range.
+ * @param sz                    The size of the range.
+ *
+ * @return                      The offset within the range of the end of the
+ *                                  unit.
+ */
+static uint32_t
+boot_swap_unit_end(const struct boot_loader_state *state, uint32_t img_off,
+                   uint32_t scratch_off, uint32_t off, uint32_t sz)
+{
+    uint32_t end;
+    size_t i;
+
+    for (i = 0; i < boot_img_num_sectors(state, BOOT_PRIMARY_SLOT); i++) {
+        end = boot_img_sector_off(state, BOOT_PRIMARY_SLOT, i) +
+              boot_img_sector_size(state, BOOT_PRIMARY_SLOT, i) - img_off;
+        if (end <= off) {
+            continue;
+        }
+        if (end >= sz) {
+            break;
+        }
+        if (boot_img_sector_boundary(state, BOOT_SECONDARY_SLOT,
+                                     img_off + end) &&
+            boot_scratch_sector_boundary(state, scratch_off + end)) {
+            return end;
+        }
+    }
+
+    return sz;
+}
+
+/*
+ * The unit entries come right before the trailer of the primary slot, one for
+ * each sector of the slot in each state; a unit is recorded under the index
+ * of its first sector.
+ */
+static uint32_t
+boot_status_unit_off(const struct boot_loader_state *state,
+                     const struct boot_status *bs,
+                     const struct flash_area *fap, size_t sector)
+{
+    return boot_status_off(fap) - boot_unit_status_sz(BOOT_WRITE_SZ(state)) +
+           ((bs->state - BOOT_STATUS_STATE_0) * BOOT_STATUS_MAX_ENTRIES +
+            sector) * BOOT_WRITE_SZ(state);
+}
+
+static int
+boot_write_unit_status(const struct boot_loader_state *state,
+                       const struct boot_status *bs,
+                       const struct flash_area *fap, size_t sector)
+{
+    uint8_t buf[BOOT_MAX_ALIGN];
+    int rc;
+
+    memset(buf, flash_area_erased_val(fap), BOOT_MAX_ALIGN);
+    buf[0] = bs->state;
+
+    rc = flash_area_write(fap, boot_status_unit_off(state, bs, fap, sector),
+                          buf, flash_area_align(fap));
+    if (rc != 0) {
+        return BOOT_EFLASH;
+    }
+
+    return 0;
+}
+
+/**
+ * Copies a range of the current swap state one unit at a time, erasing each
+ * unit of the destination right before writing it, and records every unit
+ * copied in the status area of the primary slot.  Units recorded before a
+ * reset are skipped, so a resumed state only redoes the unit it was
+ * interrupted in, instead of the whole range.  The source of a state is not
+ * modified until the state is done, so this is safe to repeat.
+ *
+ * @param idx                   The index of the first sector in the range.
+ * @param scratch_off           The offset of the range in the scratch area.
+ * @param fap_pri               The primary slot, which holds the status.
+ * @param fap_src               The area the range is copied from.
+ * @param off_src               The offset of the range in fap_src.
+ * @param fap_dst               The area the range is copied to.
+ * @param off_dst               The offset of the range in fap_dst.
+ * @param sz                    The size of the range.
+ */
+static void
+boot_swap_copy_units(struct boot_loader_state *state, struct boot_status *bs,
+                     int idx, uint32_t scratch_off,
+                     const struct flash_area *fap_pri,
+                     const struct flash_area *fap_src, uint32_t off_src,
+                     const struct flash_area *fap_dst, uint32_t off_dst,
+                     uint32_t sz)
+{
+    uint8_t buf[BOOT_MAX_ALIGN];
+    uint32_t img_off;
+    uint32_t off;
+    uint32_t end;
+    size_t sector;
+    int rc;
+
+    img_off = boot_img_sector_off(state, BOOT_PRIMARY_SLOT, idx);
+    sector = idx;
+
+    for (off = 0; off < sz; off = end) {
+        end = boot_swap_unit_end(state, img_off, scratch_off, off, sz);
+        while (boot_img_sector_off(state, BOOT_PRIMARY_SLOT, sector) <
+                img_off + off) {
+            sector++;
+        }
+
+        rc = flash_area_read_is_empty(fap_pri,
+                boot_status_unit_off(state, bs, fap_pri, sector), buf,
+                BOOT_WRITE_SZ(state));
+        assert(rc >= 0);
+        if (rc == 0) {
+            /* Copied before a reset. */
+            continue;
+        }
+
+        rc = boot_erase_region_start(fap_dst, off_dst + off, end - off);
+        assert(rc == 0);
+
+        rc = boot_copy_region(state, fap_src, fap_dst, off_src + off,
+                              off_dst + off, end - off);
+        assert(rc == 0);
+
+        rc = boot_write_unit_status(state, bs, fap_pri, sector);
+        BOOT_STATUS_ASSERT(rc == 0);
+    }
+}
+#endif /* MCUBOOT_SWAP_SECTOR_STATUS */
+
 /**
  * Calculates the number of sectors the scratch area can contain.  A "last"
  * source sector is specified because images are copied backwards in flash
@@ -474,14 +714,16 @@ boot_copy_sz(const struct boot_loader_state *state, int last_sector_idx,
  * @param idx                   The index of the first sector in the range of
  *                                  sectors being swapped.
  * @param sz                    The number of bytes to swap.
+ * @param scratch_off           The offset in the scratch area the bytes are
+ *                                  saved to.
  * @param bs                    The current boot status.  This struct gets
  *                                  updated according to the outcome.
  *
  * @return                      0 on success; nonzero on failure.
  */
 static void
-boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
-        struct boot_status *bs)
+boot_swap_sectors(int idx, uint32_t sz, uint32_t scratch_off,
+        struct boot_loader_state *state, struct boot_status *bs)
 {
     const struct flash_area *fap_primary_slot;
     const struct flash_area *fap_secondary_slot;
@@ -501,6 +743,10 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
 
     copy_sz = sz;
     trailer_sz = boot_trailer_sz(BOOT_WRITE_SZ(state));
+#ifdef MCUBOOT_SWAP_SECTOR_STATUS
+    /* The unit entries are not swapped either. */
+    trailer_sz += boot_unit_status_sz(BOOT_WRITE_SZ(state));
+#endif
 
     /* sz in this function is always sized on a multiple of the sector size.
      * The check against the start offset of the last sector
@@ -532,10 +778,70 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
     rc = flash_area_open(FLASH_AREA_IMAGE_SCRATCH, &fap_scratch);
     assert (rc == 0);
 
+#ifdef MCUBOOT_SWAP_SKIP_IDENTICAL
+    /*
+     * A range holding the same data in both slots is left alone, and only
+     * its status entries are written; they are flagged so that a resumed
+     * swap does not restore the primary slot from the (unused) scratch.
+     * The first range, which holds the trailer, is always swapped.
+     */
+    if (bs->state == BOOT_STATUS_STATE_0 && bs->idx > BOOT_STATUS_IDX_0) {
+        bs->skipped = swap_regions_identical(state, fap_primary_slot, img_off,
+                                             fap_secondary_slot, img_off,
+                                             copy_sz);
+    }
+
+    if (bs->skipped) {
+        BOOT_LOG_DBG("skipping identical sectors at 0x%x", (unsigned)img_off);
+        while (bs->state <= BOOT_STATUS_STATE_2) {
+            rc = boot_write_status(state, bs);
+            bs->state++;
+            BOOT_STATUS_ASSERT(rc == 0);
+        }
+
+        bs->skipped = 0;
+        bs->idx++;
+        bs->state = BOOT_STATUS_STATE_0;
+
+        flash_area_close(fap_primary_slot);
+        flash_area_close(fap_secondary_slot);
+        flash_area_close(fap_scratch);
+        return;
+    }
+#endif
+
     if (bs->state == BOOT_STATUS_STATE_0) {
-        BOOT_LOG_DBG("erasing scratch area");
-        rc = boot_erase_region(fap_scratch, 0, fap_scratch->fa_size);
-        assert(rc == 0);
+#ifdef MCUBOOT_SWAP_SECTOR_STATUS
+        if (!bs->use_scratch) {
+            /* Units are erased as they are copied; only make room for the
+             * temporary trailer here.
+             */
+            if (bs->idx == BOOT_STATUS_IDX_0) {
+                rc = boot_erase_scratch(state, fap_scratch,
+                        boot_status_off(fap_scratch),
+                        fap_scratch->fa_size - boot_status_off(fap_scratch));
+                assert(rc == 0);
+            }
+        } else
+#endif
+        {
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+            BOOT_LOG_DBG("erasing scratch area at 0x%x", (unsigned)scratch_off);
+            rc = boot_erase_scratch(state, fap_scratch, scratch_off, sz);
+            assert(rc == 0);
+
+            if (bs->idx == BOOT_STATUS_IDX_0) {
+                rc = boot_erase_scratch(state, fap_scratch,
+                        boot_status_off(fap_scratch),
+                        fap_scratch->fa_size - boot_status_off(fap_scratch));
+                assert(rc == 0);
+            }
+#else
+            BOOT_LOG_DBG("erasing scratch area");
+            rc = boot_erase_region(fap_scratch, 0, fap_scratch->fa_size);
+            assert(rc == 0);
+#endif
+        }
 
         if (bs->idx == BOOT_STATUS_IDX_0) {
             /* Write a trailer to the scratch area, even if we don't need the
@@ -557,14 +863,29 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
                 assert(rc == 0);
 
                 /* Erase the temporary trailer from the scratch area. */
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+                rc = boot_erase_scratch(state, fap_scratch,
+                        boot_status_off(fap_scratch),
+                        fap_scratch->fa_size - boot_status_off(fap_scratch));
+#else
                 rc = boot_erase_region(fap_scratch, 0, fap_scratch->fa_size);
+#endif
                 assert(rc == 0);
             }
         }
 
-        rc = boot_copy_region(state, fap_secondary_slot, fap_scratch,
-                              img_off, 0, copy_sz);
-        assert(rc == 0);
+#ifdef MCUBOOT_SWAP_SECTOR_STATUS
+        if (!bs->use_scratch) {
+            boot_swap_copy_units(state, bs, idx, scratch_off, fap_primary_slot,
+                                 fap_secondary_slot, img_off,
+                                 fap_scratch, scratch_off, sz);
+        } else
+#endif
+        {
+            rc = boot_copy_region(state, fap_secondary_slot, fap_scratch,
+                                  img_off, scratch_off, copy_sz);
+            assert(rc == 0);
+        }
 
         rc = boot_write_status(state, bs);
         bs->state = BOOT_STATUS_STATE_1;
@@ -572,12 +893,21 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
     }
 
     if (bs->state == BOOT_STATUS_STATE_1) {
-        rc = boot_erase_region(fap_secondary_slot, img_off, sz);
-        assert(rc == 0);
+#ifdef MCUBOOT_SWAP_SECTOR_STATUS
+        if (!bs->use_scratch) {
+            boot_swap_copy_units(state, bs, idx, scratch_off, fap_primary_slot,
+                                 fap_primary_slot, img_off,
+                                 fap_secondary_slot, img_off, sz);
+        } else
+#endif
+        {
+            rc = boot_erase_region_start(fap_secondary_slot, img_off, sz);
+            assert(rc == 0);
 
-        rc = boot_copy_region(state, fap_primary_slot, fap_secondary_slot,
-                              img_off, img_off, copy_sz);
-        assert(rc == 0);
+            rc = boot_copy_region(state, fap_primary_slot, fap_secondary_slot,
+                                  img_off, img_off, copy_sz);
+            assert(rc == 0);
+        }
 
         if (bs->idx == BOOT_STATUS_IDX_0 && !bs->use_scratch) {
             /* If not all sectors of the slot are being swapped,
@@ -593,22 +923,37 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
     }
 
     if (bs->state == BOOT_STATUS_STATE_2) {
-        rc = boot_erase_region(fap_primary_slot, img_off, sz);
-        assert(rc == 0);
+#ifdef MCUBOOT_SWAP_SECTOR_STATUS
+        if (!bs->use_scratch) {
+            boot_swap_copy_units(state, bs, idx, scratch_off, fap_primary_slot,
+                                 fap_scratch, scratch_off,
+                                 fap_primary_slot, img_off, sz);
+        } else
+#endif
+        {
+            rc = boot_erase_region_start(fap_primary_slot, img_off, sz);
+            assert(rc == 0);
 
-        /* NOTE: If this is the final sector, we exclude the image trailer from
-         * this copy (copy_sz was truncated earlier).
-         */
-        rc = boot_copy_region(state, fap_scratch, fap_primary_slot,
-                              0, img_off, copy_sz);
-        assert(rc == 0);
+            /* NOTE: If this is the final sector, we exclude the image trailer
+             * from this copy (copy_sz was truncated earlier).
+             */
+            rc = boot_copy_region(state, fap_scratch, fap_primary_slot,
+                                  scratch_off, img_off, copy_sz);
+            assert(rc == 0);
+        }
 
         if (bs->use_scratch) {
             scratch_trailer_off = boot_status_off(fap_scratch);
 
             /* copy current status that is being maintained in scratch */
             rc = boot_copy_region(state, fap_scratch, fap_primary_slot,
-                        scratch_trailer_off, img_off + copy_sz,
+                        scratch_trailer_off,
+#ifdef MCUBOOT_SWAP_SECTOR_STATUS
+                        img_off + copy_sz +
+                            boot_unit_status_sz(BOOT_WRITE_SZ(state)),
+#else
+                        img_off + copy_sz,
+#endif
                         (BOOT_STATUS_STATE_COUNT - 1) * BOOT_WRITE_SZ(state));
             BOOT_STATUS_ASSERT(rc == 0);
 
@@ -627,7 +972,12 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
                 assert(rc == 0);
             }
 
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+            rc = boot_write_swap_size_scratch(fap_primary_slot, bs->swap_size,
+                                              bs->scratch_off);
+#else
             rc = boot_write_swap_size(fap_primary_slot, bs->swap_size);
+#endif
             assert(rc == 0);
 
 #ifdef MCUBOOT_ENC_IMAGES
@@ -655,7 +1005,17 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
         BOOT_STATUS_ASSERT(rc == 0);
 
         if (erase_scratch) {
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+            rc = boot_erase_scratch(state, fap_scratch, scratch_off, sz);
+            assert(rc == 0);
+
+            /* The range may end before the trailer of the scratch area. */
+            rc = boot_erase_scratch(state, fap_scratch,
+                    boot_status_off(fap_scratch),
+                    fap_scratch->fa_size - boot_status_off(fap_scratch));
+#else
             rc = boot_erase_region(fap_scratch, 0, sz);
+#endif
             assert(rc == 0);
         }
     }
@@ -665,28 +1025,26 @@ boot_swap_sectors(int idx, uint32_t sz, struct boot_loader_state *state,
     flash_area_close(fap_scratch);
 }
 
-void
-swap_run(struct boot_loader_state *state, struct boot_status *bs,
-         uint32_t copy_size)
+/**
+ * Finds the last sector of the primary slot that needs swapping, knowing the
+ * size of the largest image between both slots.  Since we already know that
+ * both slots are compatible, the secondary slot's last sector is not really
+ * required after this check is finished.
+ */
+static int
+boot_swap_last_sector_idx(const struct boot_loader_state *state,
+                          uint32_t copy_size)
 {
-    uint32_t sz;
-    int first_sector_idx;
     int last_sector_idx;
-    uint32_t swap_idx;
     int last_idx_secondary_slot;
     uint32_t primary_slot_size;
     uint32_t secondary_slot_size;
+
     primary_slot_size = 0;
     secondary_slot_size = 0;
     last_sector_idx = 0;
     last_idx_secondary_slot = 0;
 
-    /*
-     * Knowing the size of the largest image between both slots, here we
-     * find what is the last sector in the primary slot that needs swapping.
-     * Since we already know that both slots are compatible, the secondary
-     * slot's last sector is not really required after this check is finished.
-     */
     while (1) {
         if ((primary_slot_size < copy_size) ||
             (primary_slot_size < secondary_slot_size)) {
@@ -709,13 +1067,209 @@ swap_run(struct boot_loader_state *state, struct boot_status *bs,
         last_idx_secondary_slot++;
     }
 
+    return last_sector_idx;
+}
+
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+/**
+ * Like boot_copy_sz(), but only takes as many sectors as fit in max_sz bytes,
+ * and makes sure the range starts on a boundary of both slots.
+ *
+ * @return                      The number of bytes in the range; 0 if not
+ *                                  even one group of sectors fits.
+ */
+static uint32_t
+boot_copy_sz_max(const struct boot_loader_state *state, int last_sector_idx,
+                 uint32_t max_sz, int *out_first_sector_idx)
+{
+    uint32_t new_sz;
+    uint32_t fit_sz;
+    uint32_t sz;
+    int i;
+
+    sz = 0;
+    fit_sz = 0;
+    *out_first_sector_idx = last_sector_idx + 1;
+    for (i = last_sector_idx; i >= 0; i--) {
+        new_sz = sz + boot_img_sector_size(state, BOOT_PRIMARY_SLOT, i);
+        if (new_sz > max_sz) {
+            break;
+        }
+        sz = new_sz;
+
+        if (boot_img_sector_boundary(state, BOOT_SECONDARY_SLOT,
+                boot_img_sector_off(state, BOOT_PRIMARY_SLOT, i))) {
+            fit_sz = sz;
+            *out_first_sector_idx = i;
+        }
+    }
+
+    return fit_sz;
+}
+
+/**
+ * Sizes the next range of a swap and places it in the scratch area.  The
+ * range is saved right after the previous one, and only takes what fits
+ * before the end of the scratch area.  When nothing fits, it starts over at
+ * the beginning of the area, where it is sized as without wear leveling.  The
+ * first range of a swap must also end before the temporary scratch trailer.
+ *
+ * @param last_sector_idx       The index of the last sector of the range.
+ * @param first                 Whether this is the first range of the swap.
+ * @param scratch_off           The offset right after the previous range;
+ *                                  gets the offset of this range.
+ * @param out_first_sector_idx  The index of the first sector of the range
+ *                                  gets written here.
+ *
+ * @return                      The number of bytes in the range.
+ */
+static uint32_t
+boot_scratch_range(const struct boot_loader_state *state, int last_sector_idx,
+                   bool first, uint32_t *scratch_off, int *out_first_sector_idx)
+{
+    uint32_t trailer_sz;
+    uint32_t end;
+    uint32_t sz;
+
+    end = boot_scratch_area_size(state);
+    if (first) {
+        trailer_sz = boot_trailer_sz(BOOT_WRITE_SZ(state));
+        end = (end > trailer_sz) ? end - trailer_sz : 0;
+    }
+
+    if (*scratch_off != 0 && *scratch_off < end) {
+        sz = boot_copy_sz_max(state, last_sector_idx, end - *scratch_off,
+                              out_first_sector_idx);
+        if (sz != 0) {
+            return sz;
+        }
+    }
+
+    *scratch_off = 0;
+    return boot_copy_sz(state, last_sector_idx, out_first_sector_idx);
+}
+
+/**
+ * Finds the offset in the scratch area right after the last range of a swap.
+ *
+ * @param copy_size             The size of the swap.
+ * @param scratch_off           The offset of the first range of the swap.
+ */
+static uint32_t
+boot_scratch_end_off(const struct boot_loader_state *state, uint32_t copy_size,
+                     uint32_t scratch_off)
+{
+    int first_sector_idx;
+    int last_sector_idx;
+    uint32_t start;
+    uint32_t sz;
+    bool first;
+
+    first = true;
+    last_sector_idx = boot_swap_last_sector_idx(state, copy_size);
+    while (last_sector_idx >= 0) {
+        sz = boot_scratch_range(state, last_sector_idx, first, &scratch_off,
+                                &first_sector_idx);
+        scratch_off = boot_scratch_sectors(state, scratch_off, sz, &start);
+        last_sector_idx = first_sector_idx - 1;
+        first = false;
+    }
+
+    return scratch_off;
+}
+
+/**
+ * Finds where the first range of the swap is saved in the scratch area.  A
+ * resumed swap reads it back from its trailer.  A new swap goes on right after
+ * the last range of the previous one, found from the size and the offset that
+ * swap left in the trailer of the primary slot, so that the scratch sectors
+ * take turns across upgrades rather than starting over at each one.
+ */
+static void
+boot_scratch_first_off(const struct boot_loader_state *state,
+                       struct boot_status *bs, int last_sector_idx)
+{
+    const struct flash_area *fap;
+    uint32_t swap_size;
+    uint32_t scratch_off;
+    uint32_t slot_size;
+    int first_sector_idx;
+    int area_id;
+    int rc;
+
+    if (!boot_status_is_reset(bs) &&
+            bs->source == BOOT_STATUS_SOURCE_SCRATCH) {
+        area_id = FLASH_AREA_IMAGE_SCRATCH;
+    } else {
+        area_id = FLASH_AREA_IMAGE_PRIMARY(BOOT_CURR_IMG(state));
+    }
+
+    rc = flash_area_open(area_id, &fap);
+    assert(rc == 0);
+
+    slot_size = fap->fa_size;
+    rc = boot_read_swap_size_scratch(fap, &swap_size, &scratch_off);
+    flash_area_close(fap);
+
+    if (rc != 0 || scratch_off >= boot_scratch_area_size(state)) {
+        scratch_off = 0;
+    }
+
+    if (boot_status_is_reset(bs)) {
+        if (swap_size <= slot_size) {
+            scratch_off = boot_scratch_end_off(state, swap_size, scratch_off);
+        } else {
+            scratch_off = 0;
+        }
+        (void)boot_scratch_range(state, last_sector_idx, true, &scratch_off,
+                                 &first_sector_idx);
+    }
+
+    bs->scratch_off = scratch_off;
+}
+#endif /* MCUBOOT_SCRATCH_WEAR_LEVELING */
+
+void
+swap_run(struct boot_loader_state *state, struct boot_status *bs,
+         uint32_t copy_size)
+{
+    uint32_t sz;
+    uint32_t scratch_off;
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+    uint32_t range_off;
+#endif
+    int first_sector_idx;
+    int last_sector_idx;
+    uint32_t swap_idx;
+
+    last_sector_idx = boot_swap_last_sector_idx(state, copy_size);
+
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+    boot_scratch_first_off(state, bs, last_sector_idx);
+    scratch_off = bs->scratch_off;
+#else
+    scratch_off = 0;
+#endif
+
     swap_idx = 0;
     while (last_sector_idx >= 0) {
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+        /*
+         * The place of a range only depends on the ranges before it, so an
+         * interrupted swap finds it again from the index in its status.
+         */
+        sz = boot_scratch_range(state, last_sector_idx, swap_idx == 0,
+                                &scratch_off, &first_sector_idx);
+#else
         sz = boot_copy_sz(state, last_sector_idx, &first_sector_idx);
+#endif
         if (swap_idx >= (bs->idx - BOOT_STATUS_IDX_0)) {
-            boot_swap_sectors(first_sector_idx, sz, state, bs);
+            boot_swap_sectors(first_sector_idx, sz, scratch_off, state, bs);
         }
 
+#ifdef MCUBOOT_SCRATCH_WEAR_LEVELING
+        scratch_off = boot_scratch_sectors(state, scratch_off, sz, &range_off);
+#endif
         last_sector_idx = first_sector_idx - 1;
         swap_idx++;
     }
@@ -46,7 +46,7 @@ bootutil_tlv_iter_begin(struct image_tlv_iter *it, const struct image_header *hd
     }
 
     off_ = BOOT_TLV_OFF(hdr);
-    if (flash_area_read(fap, off_, &info, sizeof(info))) {
+    if (bootutil_flash_read(fap, off_, &info, sizeof(info))) {
         return -1;
     }
 
@@ -55,7 +55,8 @@ bootutil_tlv_iter_begin(struct image_tlv_iter *it, const struct image_header *hd
             return -1;
         }
 
-        if (flash_area_read(fap, off_ + info.it_tlv_tot, &info, sizeof(info))) {
+        if (bootutil_flash_read(fap, off_ + info.it_tlv_tot, &info,
+                                sizeof(info))) {
             return -1;
         }
     } else if (hdr->ih_protect_tlv_size != 0) {
@@ -105,7 +106,7 @@ bootutil_tlv_iter_next(struct image_tlv_iter *it, uint32_t *off, uint16_t *len,
             it->tlv_off += sizeof(struct image_tlv_info);
         }
 
-        rc = flash_area_read(it->fap, it->tlv_off, &tlv, sizeof tlv);
+        rc = bootutil_flash_read(it->fap, it->tlv_off, &tlv, sizeof tlv);
         if (rc) {
             return -1;
         }
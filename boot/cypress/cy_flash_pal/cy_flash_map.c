@@ -406,7 +406,7 @@ uint8_t flash_area_erased_val(const struct flash_area *fap)
 int flash_area_read_is_empty(const struct flash_area *fa, uint32_t off,
         void *dst, uint32_t len)
 {
-    uint8_t i = 0;
+    uint32_t i = 0;
     uint8_t *mem_dest;
     int rc;
 
@@ -7,6 +7,7 @@
 #ifndef __FLASH_MAP_BACKEND_H__
 #define __FLASH_MAP_BACKEND_H__
 
+#include <inttypes.h>
 #include <sysflash/sysflash.h>
 #include <mcuboot_config/mcuboot_config.h>
 
@@ -39,4 +40,15 @@
 int flash_area_id_from_multi_image_slot(int image_index, int slot);
 int flash_area_id_to_multi_image_slot(int image_index, int area_id);
 
+struct flash_area;
+
+/*
+ * Points *ptr at len bytes of the flash area at off, when they can be read
+ * in place through the memory map.
+ *
+ * Returns 0 on success, or non-zero if flash_area_read() has to be used.
+ */
+int flash_area_get_ptr(const struct flash_area *fa, uint32_t off,
+        uint32_t len, const void **ptr);
+
 #endif /* __FLASH_MAP_BACKEND_H__ */
@@ -42,3 +42,20 @@ int flash_area_id_to_multi_image_slot(int image_index, int area_id)
     }
     return 255;
 }
+
+#if MCUBOOT_FLASH_AREA_GET_PTR
+int flash_area_get_ptr(const struct flash_area *fa, uint32_t off,
+        uint32_t len, const void **ptr)
+{
+    /*
+     * Only flash device 0, the MCU's internal flash, is assumed to be
+     * memory-mapped; its areas are placed at their CPU address.
+     */
+    if (fa->fa_device_id != 0 || off > fa->fa_size || len > fa->fa_size - off) {
+        return -1;
+    }
+
+    *ptr = (const void *)(uintptr_t)(fa->fa_off + off);
+    return 0;
+}
+#endif
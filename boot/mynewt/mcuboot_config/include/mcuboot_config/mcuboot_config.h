@@ -32,6 +32,56 @@
 #if MYNEWT_VAL(BOOTUTIL_VALIDATE_SLOT0)
 #define MCUBOOT_VALIDATE_PRIMARY_SLOT 1
 #endif
+#if MYNEWT_VAL(BOOTUTIL_HASH_ON_COPY)
+#define MCUBOOT_HASH_ON_COPY 1
+#endif
+#if MYNEWT_VAL(BOOTUTIL_VALIDATED_MARKER)
+#define MCUBOOT_VALIDATED_MARKER 1
+#define MCUBOOT_VALIDATED_MARKER_MAX_BOOTS \
+    MYNEWT_VAL(BOOTUTIL_VALIDATED_MARKER_MAX_BOOTS)
+#endif
+#if MYNEWT_VAL(BOOTUTIL_FLASH_AREA_GET_PTR)
+#define MCUBOOT_FLASH_AREA_GET_PTR 1
+#endif
+#define MCUBOOT_COPY_BUF_SIZE MYNEWT_VAL(BOOTUTIL_COPY_BUF_SIZE)
+#if MYNEWT_VAL(BOOTUTIL_COPY_DOUBLE_BUF)
+#define MCUBOOT_COPY_DOUBLE_BUF 1
+#endif
+#if MYNEWT_VAL(BOOTUTIL_FLASH_ASYNC)
+#define MCUBOOT_FLASH_ASYNC 1
+#endif
+#if MYNEWT_VAL(BOOTUTIL_FLASH_BLOCK_ERASE)
+#define MCUBOOT_FLASH_BLOCK_ERASE 1
+#endif
+#if MYNEWT_VAL(BOOTUTIL_SWAP_SKIP_IDENTICAL)
+#define MCUBOOT_SWAP_SKIP_IDENTICAL 1
+#endif
+#if MYNEWT_VAL(BOOTUTIL_SCRATCH_WEAR_LEVELING)
+#define MCUBOOT_SCRATCH_WEAR_LEVELING 1
+#endif
+#if MYNEWT_VAL(BOOTUTIL_SWAP_SECTOR_STATUS)
+#define MCUBOOT_SWAP_SECTOR_STATUS 1
+#endif
+#if MYNEWT_VAL(BOOTUTIL_DELTA_UPGRADE)
+#define MCUBOOT_DELTA_UPGRADE 1
+#endif
+#if MYNEWT_VAL(BOOTUTIL_COMPRESSED_IMAGES)
+#define MCUBOOT_COMPRESSED_IMAGES 1
+#endif
+#if MYNEWT_VAL(BOOTUTIL_IMAGE_MANIFEST)
+#define MCUBOOT_IMAGE_MANIFEST 1
+#endif
+#if MYNEWT_VAL(BOOTUTIL_RSA_PRECOMP)
+#define MCUBOOT_RSA_PRECOMP 1
+#endif
+#if MYNEWT_VAL(BOOTUTIL_EC256_FIXED_BASE)
+#define MCUBOOT_EC256_FIXED_BASE 1
+#define MCUBOOT_EC256_FIXED_BASE_WIDTH \
+    MYNEWT_VAL(BOOTUTIL_EC256_FIXED_BASE_WIDTH)
+#endif
+#if MYNEWT_VAL(BOOTUTIL_ED25519_FIXED_BASE)
+#define MCUBOOT_ED25519_FIXED_BASE 1
+#endif
 #if MYNEWT_VAL(BOOTUTIL_USE_MBED_TLS)
 #define MCUBOOT_USE_MBED_TLS 1
 #endif
@@ -70,12 +120,28 @@
     MYNEWT_VAL(BOOTUTIL_ENCRYPT_EC256) || MYNEWT_VAL(BOOTUTIL_ENCRYPT_X25519)
 #define MCUBOOT_ENC_IMAGES 1
 #endif
+#if MYNEWT_VAL(BOOTUTIL_ENC_HW_KEYSTREAM)
+#define MCUBOOT_ENC_HW_KEYSTREAM 1
+#endif
+#if MYNEWT_VAL(BOOTUTIL_ENC_DECRYPT_ONCE)
+#define MCUBOOT_ENC_DECRYPT_ONCE 1
+#endif
 #if MYNEWT_VAL(BOOTUTIL_SWAP_USING_MOVE)
 #define MCUBOOT_SWAP_USING_MOVE 1
 #endif
+#if MYNEWT_VAL(BOOTUTIL_SWAP_USING_RAM)
+#define MCUBOOT_SWAP_USING_RAM 1
+#define MCUBOOT_SWAP_RAM_BUF_SIZE MYNEWT_VAL(BOOTUTIL_SWAP_RAM_BUF_SIZE)
+#endif
+#if MYNEWT_VAL(BOOTUTIL_DIRECT_XIP)
+#define MCUBOOT_DIRECT_XIP 1
+#endif
 #if MYNEWT_VAL(BOOTUTIL_SWAP_SAVE_ENCTLV)
 #define MCUBOOT_SWAP_SAVE_ENCTLV 1
 #endif
+#if MYNEWT_VAL(BOOTUTIL_SWAP_SEAL_ENCKEY)
+#define MCUBOOT_SWAP_SEAL_ENCKEY 1
+#endif
 #if MYNEWT_VAL(BOOTUTIL_OVERWRITE_ONLY)
 #define MCUBOOT_OVERWRITE_ONLY 1
 #endif
@@ -115,7 +115,7 @@ uint8_t flash_area_erased_val(const struct flash_area *fap)
 int flash_area_read_is_empty(const struct flash_area *fa, uint32_t off,
         void *dst, uint32_t len)
 {
-    uint8_t i;
+    uint32_t i;
     uint8_t *u8dst;
     int rc;
 
@@ -132,3 +132,22 @@ int flash_area_read_is_empty(const struct flash_area *fa, uint32_t off,
 
     return 1;
 }
+
+#ifdef CONFIG_BOOT_FLASH_AREA_GET_PTR
+int flash_area_get_ptr(const struct flash_area *fa, uint32_t off,
+        uint32_t len, const void **ptr)
+{
+#if (!defined(CONFIG_XTENSA) && defined(DT_CHOSEN_ZEPHYR_FLASH_CONTROLLER_LABEL))
+    if (fa->fa_device_id != FLASH_DEVICE_ID ||
+        off > fa->fa_size || len > fa->fa_size - off) {
+        return -EINVAL;
+    }
+
+    *ptr = (const void *)(FLASH_DEVICE_BASE + fa->fa_off + off);
+    return 0;
+#else
+    /* The SPI NOR flash is not memory-mapped. */
+    return -ENOTSUP;
+#endif
+}
+#endif
@@ -90,6 +90,15 @@ uint8_t flash_area_erased_val(const struct flash_area *fap);
 int flash_area_read_is_empty(const struct flash_area *fa, uint32_t off,
         void *dst, uint32_t len);
 
+/*
+ * Points *ptr at len bytes of the flash area at off, when they can be read
+ * in place through the memory map.
+ *
+ * Returns 0 on success, or non-zero if flash_area_read() has to be used.
+ */
+int flash_area_get_ptr(const struct flash_area *fa, uint32_t off,
+        uint32_t len, const void **ptr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -49,10 +49,64 @@
 #define MCUBOOT_HW_KEY
 #endif
 
+#ifdef CONFIG_BOOT_RSA_PRECOMP
+#define MCUBOOT_RSA_PRECOMP
+#endif
+
+#ifdef CONFIG_BOOT_EC256_FIXED_BASE
+#define MCUBOOT_EC256_FIXED_BASE
+#define MCUBOOT_EC256_FIXED_BASE_WIDTH CONFIG_BOOT_EC256_FIXED_BASE_WIDTH
+#endif
+
+#ifdef CONFIG_BOOT_ED25519_FIXED_BASE
+#define MCUBOOT_ED25519_FIXED_BASE
+#endif
+
 #ifdef CONFIG_BOOT_VALIDATE_SLOT0
 #define MCUBOOT_VALIDATE_PRIMARY_SLOT
 #endif
 
+#ifdef CONFIG_BOOT_HASH_ON_COPY
+#define MCUBOOT_HASH_ON_COPY
+#endif
+
+#ifdef CONFIG_BOOT_VALIDATED_MARKER
+#define MCUBOOT_VALIDATED_MARKER
+#define MCUBOOT_VALIDATED_MARKER_MAX_BOOTS CONFIG_BOOT_VALIDATED_MARKER_MAX_BOOTS
+#endif
+
+#ifdef CONFIG_BOOT_FLASH_AREA_GET_PTR
+#define MCUBOOT_FLASH_AREA_GET_PTR
+#endif
+
+#ifdef CONFIG_BOOT_COPY_BUF_SIZE
+#define MCUBOOT_COPY_BUF_SIZE CONFIG_BOOT_COPY_BUF_SIZE
+#endif
+
+#ifdef CONFIG_BOOT_SWAP_SKIP_IDENTICAL
+#define MCUBOOT_SWAP_SKIP_IDENTICAL
+#endif
+
+#ifdef CONFIG_BOOT_SCRATCH_WEAR_LEVELING
+#define MCUBOOT_SCRATCH_WEAR_LEVELING
+#endif
+
+#ifdef CONFIG_BOOT_SWAP_SECTOR_STATUS
+#define MCUBOOT_SWAP_SECTOR_STATUS
+#endif
+
+#ifdef CONFIG_BOOT_DELTA_UPGRADE
+#define MCUBOOT_DELTA_UPGRADE
+#endif
+
+#ifdef CONFIG_BOOT_COMPRESSED_IMAGES
+#define MCUBOOT_COMPRESSED_IMAGES
+#endif
+
+#ifdef CONFIG_BOOT_IMAGE_MANIFEST
+#define MCUBOOT_IMAGE_MANIFEST
+#endif
+
 #ifdef CONFIG_BOOT_UPGRADE_ONLY
 #define MCUBOOT_OVERWRITE_ONLY
 #define MCUBOOT_OVERWRITE_ONLY_FAST
@@ -62,6 +116,15 @@
 #define MCUBOOT_SWAP_USING_MOVE 1
 #endif
 
+#ifdef CONFIG_BOOT_SWAP_USING_RAM
+#define MCUBOOT_SWAP_USING_RAM 1
+#define MCUBOOT_SWAP_RAM_BUF_SIZE CONFIG_BOOT_SWAP_RAM_BUF_SIZE
+#endif
+
+#ifdef CONFIG_BOOT_DIRECT_XIP
+#define MCUBOOT_DIRECT_XIP 1
+#endif
+
 #ifdef CONFIG_LOG
 #define MCUBOOT_HAVE_LOGGING 1
 #endif
@@ -70,6 +133,10 @@
 #define MCUBOOT_SWAP_SAVE_ENCTLV 1
 #endif
 
+#ifdef CONFIG_BOOT_SWAP_SEAL_ENCKEY
+#define MCUBOOT_SWAP_SEAL_ENCKEY 1
+#endif
+
 #ifdef CONFIG_BOOT_ENCRYPT_RSA
 #define MCUBOOT_ENC_IMAGES
 #define MCUBOOT_ENCRYPT_RSA
@@ -85,6 +152,14 @@
 #define MCUBOOT_ENCRYPT_X25519
 #endif
 
+#ifdef CONFIG_BOOT_ENC_HW_KEYSTREAM
+#define MCUBOOT_ENC_HW_KEYSTREAM
+#endif
+
+#ifdef CONFIG_BOOT_ENC_DECRYPT_ONCE
+#define MCUBOOT_ENC_DECRYPT_ONCE
+#endif
+
 #ifdef CONFIG_BOOT_BOOTSTRAP
 #define MCUBOOT_BOOTSTRAP 1
 #endif
@@ -33,22 +33,29 @@
 #define HAVE_KEYS
 extern const unsigned char rsa_pub_key[];
 extern unsigned int rsa_pub_key_len;
+extern const unsigned char rsa_pub_key_hash[];
+extern const unsigned char rsa_pub_key_table[];
 #elif defined(MCUBOOT_SIGN_EC256)
 #define HAVE_KEYS
 extern const unsigned char ecdsa_pub_key[];
 extern unsigned int ecdsa_pub_key_len;
+extern const unsigned char ecdsa_pub_key_hash[];
+extern const unsigned char ecdsa_pub_key_table[];
 #elif defined(MCUBOOT_SIGN_ED25519)
 #define HAVE_KEYS
 extern const unsigned char ed25519_pub_key[];
 extern unsigned int ed25519_pub_key_len;
+extern const unsigned char ed25519_pub_key_hash[];
+extern const unsigned char ed25519_pub_key_table[];
 #else
 #error "No public key available for given signing algorithm."
 #endif
 
 /*
- * NOTE: *_pub_key and *_pub_key_len are autogenerated based on the provided
- *       key file. If no key file was configured, the array and length must be
- *       provided and added to the build manually.
+ * NOTE: *_pub_key, *_pub_key_len and *_pub_key_hash are autogenerated based
+ *       on the provided key file. If no key file was configured, the array and
+ *       length must be provided and added to the build manually; the hash is
+ *       then computed when needed.
  */
 #if defined(HAVE_KEYS)
 const struct bootutil_key bootutil_keys[] = {
@@ -56,12 +63,30 @@ const struct bootutil_key bootutil_keys[] = {
 #if defined(MCUBOOT_SIGN_RSA)
         .key = rsa_pub_key,
         .len = &rsa_pub_key_len,
+#if defined(MCUBOOT_HAVE_PUB_KEY_HASH)
+        .hash = rsa_pub_key_hash,
+#endif
+#if defined(MCUBOOT_HAVE_PUB_KEY_TABLE)
+        .table = rsa_pub_key_table,
+#endif
 #elif defined(MCUBOOT_SIGN_EC256)
         .key = ecdsa_pub_key,
         .len = &ecdsa_pub_key_len,
+#if defined(MCUBOOT_HAVE_PUB_KEY_HASH)
+        .hash = ecdsa_pub_key_hash,
+#endif
+#if defined(MCUBOOT_HAVE_PUB_KEY_TABLE)
+        .table = ecdsa_pub_key_table,
+#endif
 #elif defined(MCUBOOT_SIGN_ED25519)
         .key = ed25519_pub_key,
         .len = &ed25519_pub_key_len,
+#if defined(MCUBOOT_HAVE_PUB_KEY_HASH)
+        .hash = ed25519_pub_key_hash,
+#endif
+#if defined(MCUBOOT_HAVE_PUB_KEY_TABLE)
+        .table = ed25519_pub_key_table,
+#endif
 #endif
     },
 };
@@ -1046,24 +1046,10 @@ void x25519_sc_reduce(uint8_t s[64]) {
   s[31] = s11 >> 17;
 }
 
-int ED25519_verify(const uint8_t *message, size_t message_len,
-                   const uint8_t signature[64], const uint8_t public_key[32]) {
-  ge_p3 A;
-  if ((signature[63] & 224) != 0 ||
-      !x25519_ge_frombytes_vartime(&A, public_key)) {
-    return 0;
-  }
-
-  fe_loose t;
-  fe_neg(&t, &A.X);
-  fe_carry(&A.X, &t);
-  fe_neg(&t, &A.T);
-  fe_carry(&A.T, &t);
-
-  uint8_t pkcopy[32];
-  memcpy(pkcopy, public_key, 32);
-  uint8_t rcopy[32];
-  memcpy(rcopy, signature, 32);
+// Checks that s is in range and computes h = SHA512(R || A || M) mod l.
+static int ed25519_hram(uint8_t h[64], const uint8_t *message,
+                        size_t message_len, const uint8_t signature[64],
+                        const uint8_t public_key[32]) {
   union {
     uint64_t u64[4];
     uint8_t u8[32];
@@ -1107,7 +1093,6 @@ int ED25519_verify(const uint8_t *message, size_t message_len,
   ret = mbedtls_sha512_update_ret(&ctx, message, message_len);
   assert(ret == 0);
 
-  uint8_t h[SHA512_DIGEST_LENGTH];
   ret = mbedtls_sha512_finish_ret(&ctx, h);
   assert(ret == 0);
   mbedtls_sha512_free(&ctx);
@@ -1127,7 +1112,6 @@ int ED25519_verify(const uint8_t *message, size_t message_len,
   rc = tc_sha512_update(&s, message, message_len);
   assert(rc == TC_CRYPTO_SUCCESS);
 
-  uint8_t h[TC_SHA512_DIGEST_SIZE];
   rc = tc_sha512_final(h, &s);
   assert(rc == TC_CRYPTO_SUCCESS);
 
@@ -1135,15 +1119,132 @@ int ED25519_verify(const uint8_t *message, size_t message_len,
 
   x25519_sc_reduce(h);
 
+  return 1;
+}
+
+int ED25519_verify(const uint8_t *message, size_t message_len,
+                   const uint8_t signature[64], const uint8_t public_key[32]) {
+  ge_p3 A;
+  if ((signature[63] & 224) != 0 ||
+      !x25519_ge_frombytes_vartime(&A, public_key)) {
+    return 0;
+  }
+
+  fe_loose t;
+  fe_neg(&t, &A.X);
+  fe_carry(&A.X, &t);
+  fe_neg(&t, &A.T);
+  fe_carry(&A.T, &t);
+
+  uint8_t h[SHA512_DIGEST_LENGTH];
+  if (!ed25519_hram(h, message, message_len, signature, public_key)) {
+    return 0;
+  }
+
+  ge_p2 R;
+  ge_double_scalarmult_vartime(&R, h, &A, signature + 32);
+
+  uint8_t rcheck[32];
+  x25519_ge_tobytes(rcheck, &R);
+
+  return CRYPTO_memcmp(rcheck, signature, sizeof(rcheck)) == 0;
+}
+
+#if defined(MCUBOOT_ED25519_FIXED_BASE)
+
+// Loads a point of a table built by imgtool: y+x, y-x and 2dxy, each as a
+// 32-byte little-endian field element.
+static void ge_precomp_frombytes(ge_precomp *r, const uint8_t s[96]) {
+  fe t;
+
+  fe_frombytes(&t, s);
+  fe_copy_lt(&r->yplusx, &t);
+  fe_frombytes(&t, s + 32);
+  fe_copy_lt(&r->yminusx, &t);
+  fe_frombytes(&t, s + 64);
+  fe_copy_lt(&r->xy2d, &t);
+}
+
+// Adds digit * P to the point being accumulated in t, where Pi holds the odd
+// multiples of P.  Pi is either a table in the imgtool format or, if table is
+// NULL, an array of ge_precomp.
+static void ge_madd_digit(ge_p1p1 *t, signed char digit, const ge_precomp *Pi,
+                          const uint8_t *table) {
+  ge_precomp q;
+  ge_p3 u;
+  int i;
+
+  if (digit == 0) {
+    return;
+  }
+
+  i = (digit > 0 ? digit : -digit) / 2;
+  if (table != NULL) {
+    ge_precomp_frombytes(&q, table + i * 96);
+    Pi = &q;
+  } else {
+    Pi = &Pi[i];
+  }
+
+  x25519_ge_p1p1_to_p3(&u, t);
+  if (digit > 0) {
+    ge_madd(t, &u, Pi);
+  } else {
+    ge_msub(t, &u, Pi);
+  }
+}
+
+// Same as ED25519_verify, with the odd multiples of 2^(64*j) * A, for j from
+// 0 to 3, from table, which is the part of a table built by imgtool's
+// ed25519_table.py that follows the encoded key.
+//
+// R = s * B - h * A is computed with the NAF digits of h and s split in four
+// rows of 64 bits, the digits of row j using the multiples of 2^(64*j) * A
+// and 2^(64*j) * B, so the main loop takes 64 doublings instead of up to
+// 256.  The key itself is never decompressed.
+int ED25519_verify_with_table(const uint8_t *message, size_t message_len,
+                              const uint8_t signature[64],
+                              const uint8_t public_key[32],
+                              const uint8_t *table) {
+  signed char hslide[256];
+  signed char sslide[256];
+  uint8_t h[SHA512_DIGEST_LENGTH];
+  ge_p1p1 t;
   ge_p2 R;
-  ge_double_scalarmult_vartime(&R, h, &A, scopy.u8);
+  int i;
+  int j;
+
+  if ((signature[63] & 224) != 0 ||
+      !ed25519_hram(h, message, message_len, signature, public_key)) {
+    return 0;
+  }
+
+  slide(hslide, h);
+  slide(sslide, signature + 32);
+
+  ge_p2_0(&R);
+
+  for (i = 63; i >= 0; --i) {
+    ge_p2_dbl(&t, &R);
+
+    for (j = 0; j < 4; j++) {
+      // -h * A, so the digits of h are subtracted.
+      ge_madd_digit(&t, -hslide[i + 64 * j], NULL, table + j * 8 * 96);
+      ge_madd_digit(&t, sslide[i + 64 * j], j == 0 ? Bi : Bi_rows[j - 1],
+                    NULL);
+    }
+
+    x25519_ge_p1p1_to_p2(&R, &t);
+  }
 
   uint8_t rcheck[32];
   x25519_ge_tobytes(rcheck, &R);
 
-  return CRYPTO_memcmp(rcheck, rcopy, sizeof(rcheck)) == 0;
+  return CRYPTO_memcmp(rcheck, signature, sizeof(rcheck)) == 0;
 }
 
+#endif
+
 static void fe_cswap(fe *f, fe *g, fe_limb_t b) {
   b = 0-b;
   for (unsigned i = 0; i < FE_NUM_LIMBS; i++) {
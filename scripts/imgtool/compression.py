@@ -0,0 +1,121 @@
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Compression of images into LZ4 blocks.
+
+The bootloader decompresses images while copying them, keeping only the last
+WINDOW_SIZE bytes of output, so matches never reach further back than that.
+The blocks are otherwise standard and can be decompressed by any LZ4
+implementation.
+"""
+
+WINDOW_SIZE = 4096
+
+MIN_MATCH = 4
+
+# The format requires the last bytes of a block to be literals.
+LAST_LITERALS = 5
+MF_LIMIT = 12
+
+HASH_BITS = 14
+
+
+def _put_len(out, n):
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+
+
+def _put_sequence(out, literals, match_len, dist):
+    lit_len = len(literals)
+    token = min(lit_len, 15) << 4
+    if match_len:
+        token |= min(match_len - MIN_MATCH, 15)
+    out.append(token)
+    if lit_len >= 15:
+        _put_len(out, lit_len - 15)
+    out.extend(literals)
+    if match_len:
+        out.extend(dist.to_bytes(2, 'little'))
+        if match_len - MIN_MATCH >= 15:
+            _put_len(out, match_len - MIN_MATCH - 15)
+
+
+def compress(data):
+    """Compress data into a single LZ4 block."""
+    data = bytes(data)
+    size = len(data)
+    out = bytearray()
+    table = {}
+    anchor = 0
+    pos = 0
+    limit = size - MF_LIMIT
+
+    while pos < limit:
+        key = data[pos:pos + MIN_MATCH]
+        cand = table.get(key)
+        table[key] = pos
+        if cand is None or pos - cand > WINDOW_SIZE:
+            pos += 1
+            continue
+
+        end = size - LAST_LITERALS
+        n = MIN_MATCH
+        while pos + n < end and data[cand + n] == data[pos + n]:
+            n += 1
+
+        _put_sequence(out, data[anchor:pos], n, pos - cand)
+        for i in range(pos + 1, min(pos + n, limit)):
+            table[data[i:i + MIN_MATCH]] = i
+        pos += n
+        anchor = pos
+
+    _put_sequence(out, data[anchor:], 0, 0)
+    return bytes(out)
+
+
+def decompress(block):
+    """Decompress a single LZ4 block."""
+    out = bytearray()
+    pos = 0
+    while True:
+        token = block[pos]
+        pos += 1
+        n = token >> 4
+        if n == 15:
+            while True:
+                b = block[pos]
+                pos += 1
+                n += b
+                if b != 255:
+                    break
+        out.extend(block[pos:pos + n])
+        pos += n
+        if pos == len(block):
+            return bytes(out)
+        dist = block[pos] | (block[pos + 1] << 8)
+        pos += 2
+        n = token & 0xf
+        if n == 15:
+            while True:
+                b = block[pos]
+                pos += 1
+                n += b
+                if b != 255:
+                    break
+        n += MIN_MATCH
+        if dist == 0 or dist > len(out):
+            raise ValueError("Invalid match distance")
+        for _ in range(n):
+            out.append(out[-dist])
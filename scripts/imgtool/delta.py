@@ -0,0 +1,120 @@
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Patch creation for delta upgrades.
+
+A patch is a sequence of commands, each producing the next bytes of the new
+image.  A command starts with a 32-bit word holding the number of bytes it
+produces.  If LITERAL is set in it, these bytes follow; otherwise a second
+word holds the offset in the base image of the bytes to copy.
+
+The bootloader rebuilds the new image in place, over the base image, one
+range of sectors at a time.  A copy must therefore not read from a sector
+that precedes the one it writes to, and a copy reading from before its
+destination must not cross a sector boundary.  Any sector size that divides
+the offsets of all the sectors of the primary slot gives valid patches.
+"""
+
+import struct
+
+LITERAL = 0x80000000
+
+# Shorter matches cost more to encode than the literal bytes they replace.
+MIN_MATCH = 16
+
+# Matches are looked up by the first KEY_SIZE bytes, keeping the last
+# MAX_CANDIDATES offsets of the base image for each key.
+KEY_SIZE = 8
+MAX_CANDIDATES = 32
+
+STRUCT_ENDIAN_DICT = {
+        'little': '<',
+        'big':    '>'
+}
+
+
+def _match_len(base, src, target, dst, limit):
+    """Length of the common run of base[src:] and target[dst:], up to
+    limit."""
+    n = 0
+    step = 64
+    while n < limit:
+        m = min(step, limit - n)
+        if base[src + n:src + n + m] == target[dst + n:dst + n + m]:
+            n += m
+            continue
+        while n < limit and base[src + n] == target[dst + n]:
+            n += 1
+        break
+    return n
+
+
+def create_patch(base, target, sector_size, endian='little'):
+    """Create a patch rebuilding target from base.  Both are the full
+    images, from the header to the end of the TLVs."""
+    if sector_size <= 0:
+        raise ValueError("Invalid sector size")
+
+    e = STRUCT_ENDIAN_DICT[endian]
+    base = memoryview(bytes(base))
+    target = memoryview(bytes(target))
+
+    index = {}
+    for off in range(len(base) - KEY_SIZE + 1):
+        cands = index.setdefault(bytes(base[off:off + KEY_SIZE]), [])
+        if len(cands) == MAX_CANDIDATES:
+            del cands[0]
+        cands.append(off)
+
+    patch = bytearray()
+    literal = bytearray()
+
+    def flush_literal():
+        if literal:
+            patch.extend(struct.pack(e + 'I', LITERAL | len(literal)))
+            patch.extend(literal)
+            del literal[:]
+
+    dst = 0
+    delta = None
+    while dst < len(target):
+        sector_off = dst - dst % sector_size
+        cands = []
+        if delta is not None:
+            cands.append(dst + delta)
+        cands.extend(index.get(bytes(target[dst:dst + KEY_SIZE]), []))
+
+        best_len = 0
+        best_src = 0
+        for src in cands:
+            if src < sector_off or src >= len(base):
+                continue
+            limit = min(len(target) - dst, len(base) - src)
+            if src < dst:
+                limit = min(limit, sector_off + sector_size - dst)
+            n = _match_len(base, src, target, dst, limit)
+            if n > best_len:
+                best_len = n
+                best_src = src
+
+        if best_len >= MIN_MATCH:
+            flush_literal()
+            patch.extend(struct.pack(e + 'II', best_len, best_src))
+            delta = best_src - dst
+            dst += best_len
+        else:
+            literal.append(target[dst])
+            dst += 1
+
+    flush_literal()
+    return bytes(patch)
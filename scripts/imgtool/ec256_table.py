@@ -0,0 +1,86 @@
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Precomputed multiples of P-256 points, for the fixed-base verifier of the
+bootloader (MCUBOOT_EC256_FIXED_BASE).
+
+A table for a width w starts with a 4-byte header holding w, followed by
+the 2**w - 1 points T[i], for i from 1, each as its big-endian affine x
+and y coordinates.  With d = ceil(256 / w), T[i] is the sum of the
+2**(j * d) * P for each bit j set in i, so T[1] is P itself.
+"""
+
+P = 0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff
+A = P - 3
+GX = 0x6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296
+GY = 0x4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5
+B = 0x5ac635d8aa3a93e7b3ebbd55769886bc651d06b0cc53b0f63bce3c3e27d2604b
+
+MIN_WIDTH = 4
+MAX_WIDTH = 6
+
+
+def _add(p1, p2):
+    if p1 is None:
+        return p2
+    if p2 is None:
+        return p1
+    x1, y1 = p1
+    x2, y2 = p2
+    if x1 == x2:
+        if (y1 + y2) % P == 0:
+            return None
+        lam = (3 * x1 * x1 + A) * pow(2 * y1, P - 2, P) % P
+    else:
+        lam = (y2 - y1) * pow(x2 - x1, P - 2, P) % P
+    x3 = (lam * lam - x1 - x2) % P
+    return x3, (lam * (x1 - x3) - y1) % P
+
+
+def _double_n(p, n):
+    for _ in range(n):
+        p = _add(p, p)
+    return p
+
+
+def create_table(x, y, width):
+    """Create the table of a point, given by its affine coordinates."""
+    if width < MIN_WIDTH or width > MAX_WIDTH:
+        raise ValueError("Table width must be between {} and {}".format(
+                         MIN_WIDTH, MAX_WIDTH))
+    if (y * y - x * x * x - A * x - B) % P != 0:
+        raise ValueError("Point is not on the P-256 curve")
+
+    d = (256 + width - 1) // width
+    rows = [(x, y)]
+    for _ in range(1, width):
+        rows.append(_double_n(rows[-1], d))
+
+    table = bytearray([width, 0, 0, 0])
+    for i in range(1, 1 << width):
+        point = None
+        for j in range(width):
+            if i & (1 << j):
+                point = _add(point, rows[j])
+        table += point[0].to_bytes(32, 'big') + point[1].to_bytes(32, 'big')
+    return bytes(table)
+
+
+def create_public_key_table(pub_bytes, width):
+    """Create the table of an uncompressed public key (0x04 || x || y), the
+    last 65 bytes of a SubjectPublicKeyInfo."""
+    point = pub_bytes[-65:]
+    if len(point) != 65 or point[0] != 0x04:
+        raise ValueError("Not an uncompressed P-256 public key")
+    return create_table(int.from_bytes(point[1:33], 'big'),
+                        int.from_bytes(point[33:], 'big'), width)
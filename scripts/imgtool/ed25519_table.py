@@ -0,0 +1,98 @@
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Precomputed multiples of Ed25519 public keys, for the fixed-base verifier
+of the bootloader (MCUBOOT_ED25519_FIXED_BASE).
+
+A table starts with the 32-byte encoded key, followed by the odd multiples
+(2 * i + 1) * 2**(64 * j) * A, for j from 0 to 3 and then i from 0 to 7.
+Each point is stored as y + x, y - x and 2 * d * x * y, as 32-byte
+little-endian field elements.
+"""
+
+P = 2**255 - 19
+D = -121665 * pow(121666, P - 2, P) % P
+SQRTM1 = pow(2, (P - 1) // 4, P)
+BX = 0x216936d3cd6e53fec0a4e231fdd6dc5c692cc7609525a7b2c9562d608f25d51a
+BY = 0x6666666666666666666666666666666666666666666666666666666666666658
+
+ODD_MULTIPLES = 8
+ROWS = 4
+ROW_BITS = 64
+
+
+def _add(p1, p2):
+    x1, y1 = p1
+    x2, y2 = p2
+    t = D * x1 * x2 * y1 * y2
+    x3 = (x1 * y2 + x2 * y1) * pow(1 + t, P - 2, P)
+    y3 = (y1 * y2 + x1 * x2) * pow(1 - t, P - 2, P)
+    return x3 % P, y3 % P
+
+
+def _decode(s):
+    if len(s) != 32:
+        raise ValueError("Ed25519 public keys are 32 bytes")
+    y = int.from_bytes(s, 'little')
+    sign = y >> 255
+    y &= (1 << 255) - 1
+    if y >= P:
+        raise ValueError("Invalid Ed25519 public key")
+    u = (y * y - 1) % P
+    v = (D * y * y + 1) % P
+    x = u * pow(v, 3, P) * pow(u * pow(v, 7, P), (P - 5) // 8, P) % P
+    if (v * x * x - u) % P != 0:
+        x = x * SQRTM1 % P
+        if (v * x * x - u) % P != 0:
+            raise ValueError("Invalid Ed25519 public key")
+    if x & 1 != sign:
+        if x == 0:
+            raise ValueError("Invalid Ed25519 public key")
+        x = P - x
+    return x, y
+
+
+def odd_multiples(point):
+    """(2 * i + 1) * point, for i from 0 to 7."""
+    twice = _add(point, point)
+    points = [point]
+    for _ in range(1, ODD_MULTIPLES):
+        points.append(_add(points[-1], twice))
+    return points
+
+
+def rows(point):
+    """2**(64 * j) * point, for j from 0 to 3."""
+    points = [point]
+    for _ in range(1, ROWS):
+        for _ in range(ROW_BITS):
+            point = _add(point, point)
+        points.append(point)
+    return points
+
+
+def precomp(point):
+    """The y + x, y - x, 2 * d * x * y form of a point."""
+    x, y = point
+    return (y + x) % P, (y - x) % P, 2 * D * x * y % P
+
+
+def create_public_key_table(pub):
+    """Create the table of a raw 32-byte public key."""
+    point = _decode(pub)
+    table = bytearray(pub)
+    for base in rows(point):
+        for multiple in odd_multiples(base):
+            for fe in precomp(multiple):
+                table += fe.to_bytes(32, 'little')
+    return bytes(table)
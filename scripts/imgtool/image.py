@@ -19,6 +19,8 @@ Image signing and management.
 """
 
 from . import version as versmod
+from . import compression
+from . import delta
 from .boot_record import create_sw_component_data
 import click
 from enum import Enum
@@ -42,6 +44,7 @@ BIN_EXT = "bin"
 INTEL_HEX_EXT = "hex"
 DEFAULT_MAX_SECTORS = 128
 MAX_ALIGN = 8
+SEALED_KEY_LEN = 40
 DEP_IMAGES_KEY = "images"
 DEP_VERSIONS_KEY = "versions"
 MAX_SW_TYPE_LENGTH = 12  # Bytes
@@ -52,6 +55,9 @@ IMAGE_F = {
         'NON_BOOTABLE':          0x0000010,
         'RAM_LOAD':              0x0000020,
         'ENCRYPTED':             0x0000004,
+        'DELTA':                 0x0000040,
+        'COMPRESSED':            0x0000080,
+        'ROM_FIXED':             0x0000100,
 }
 
 TLV_VALUES = {
@@ -70,6 +76,10 @@ TLV_VALUES = {
         'DEPENDENCY': 0x40,
         'SEC_CNT': 0x50,
         'BOOT_RECORD': 0x60,
+        'DELTA_BASE': 0x70,
+        'DECOMP_SIZE': 0x71,
+        'DECOMP_SHA256': 0x72,
+        'MANIFEST': 0x73,
 }
 
 TLV_SIZE = 4
@@ -127,7 +137,8 @@ class Image():
                  pad_header=False, pad=False, confirm=False, align=1,
                  slot_size=0, max_sectors=DEFAULT_MAX_SECTORS,
                  overwrite_only=False, endian="little", load_addr=0,
-                 erased_val=None, save_enctlv=False, security_counter=None):
+                 erased_val=None, save_enctlv=False, seal_enckey=False,
+                 security_counter=None, rom_fixed=None):
         self.version = version or versmod.decode_version("0")
         self.header_size = header_size
         self.pad_header = pad_header
@@ -140,11 +151,16 @@ class Image():
         self.endian = endian
         self.base_addr = None
         self.load_addr = 0 if load_addr is None else load_addr
+        self.rom_fixed = rom_fixed
         self.erased_val = 0xff if erased_val is None else int(erased_val, 0)
         self.payload = []
         self.enckey = None
         self.save_enctlv = save_enctlv
+        self.seal_enckey = seal_enckey
         self.enctlv_len = 0
+        self.delta_base = None
+        self.decomp = None
+        self.manifest = None
 
         if security_counter == 'auto':
             # Security counter has not been explicitly provided,
@@ -214,7 +230,8 @@ class Image():
                                                   self.overwrite_only,
                                                   self.enckey,
                                                   self.save_enctlv,
-                                                  self.enctlv_len)
+                                                  self.enctlv_len,
+                                                  self.seal_enckey)
                 trailer_addr = (self.base_addr + self.slot_size) - trailer_size
                 padding = bytes([self.erased_val] *
                                 (trailer_size - len(boot_magic))) + boot_magic
@@ -236,7 +253,8 @@ class Image():
         if self.slot_size > 0:
             tsize = self._trailer_size(self.align, self.max_sectors,
                                        self.overwrite_only, self.enckey,
-                                       self.save_enctlv, self.enctlv_len)
+                                       self.save_enctlv, self.enctlv_len,
+                                       self.seal_enckey)
             padding = self.slot_size - (len(self.payload) + tsize)
             if padding < 0:
                 msg = "Image size (0x{:x}) + trailer (0x{:x}) exceeds " \
@@ -318,6 +336,20 @@ class Image():
 
             protected_tlv_size += TLV_SIZE + len(boot_record)
 
+        if self.delta_base is not None:
+            # Size of the delta base TLV: header ('HH') + SHA256 digest
+            protected_tlv_size += TLV_SIZE + len(self.delta_base)
+
+        if self.decomp is not None:
+            # Size of the decompressed image TLVs: header ('HH') + size
+            # ('I'), and header ('HH') + SHA256 digest
+            protected_tlv_size += TLV_SIZE + 4 + TLV_SIZE + len(self.decomp[1])
+
+        if self.manifest is not None:
+            # Size of a Manifest TLV = Header ('HH') + Payload ('B3x' +
+            # SHA256 digest) = 4 + 36 = 40 Bytes
+            protected_tlv_size += len(self.manifest) * (TLV_SIZE + 36)
+
         if dependencies is not None:
             # Size of a Dependency TLV = Header ('HH') + Payload('IBBHI')
             # = 4 + 12 = 16 Bytes
@@ -348,6 +380,19 @@ class Image():
             if sw_type is not None:
                 prot_tlv.add('BOOT_RECORD', boot_record)
 
+            if self.delta_base is not None:
+                prot_tlv.add('DELTA_BASE', self.delta_base)
+
+            if self.decomp is not None:
+                payload = struct.pack(e + 'I', self.decomp[0])
+                prot_tlv.add('DECOMP_SIZE', payload)
+                prot_tlv.add('DECOMP_SHA256', self.decomp[1])
+
+            if self.manifest is not None:
+                for image_id, digest in self.manifest:
+                    payload = struct.pack(e + 'B3x', image_id) + digest
+                    prot_tlv.add('MANIFEST', payload)
+
             if dependencies is not None:
                 for i in range(dependencies_num):
                     payload = struct.pack(
@@ -427,6 +472,110 @@ class Image():
 
         self.check_trailer()
 
+    def set_manifest(self, members):
+        """
+        List the other images of a set, given as (image_id, path) pairs of
+        already created images, in the protected TLVs of this one.  The
+        bootloader then accepts them without a signature of their own.
+        """
+        e = STRUCT_ENDIAN_DICT[self.endian]
+        self.manifest = []
+        for image_id, path in members:
+            ext = os.path.splitext(path)[1][1:].lower()
+            try:
+                if ext == INTEL_HEX_EXT:
+                    member = IntelHex(path).tobinarray().tobytes()
+                else:
+                    with open(path, 'rb') as f:
+                        member = f.read()
+            except FileNotFoundError:
+                raise click.UsageError("Manifest image file not found")
+
+            if len(member) < IMAGE_HEADER_SIZE:
+                raise click.UsageError("{} is not an image".format(path))
+            (magic, _, hdr_size, prot_tlv_size,
+             img_size) = struct.unpack(e + 'IIHHI', member[:16])
+            if magic != IMAGE_MAGIC:
+                raise click.UsageError("{} is not an image".format(path))
+
+            # The image is listed with the hash in its SHA256 TLV, which
+            # the bootloader also checks the image against.
+            digest = None
+            tlv_off = hdr_size + img_size + prot_tlv_size
+            info = member[tlv_off:tlv_off + TLV_INFO_SIZE]
+            if len(info) == TLV_INFO_SIZE:
+                magic, tlv_tot = struct.unpack(e + 'HH', info)
+                tlv_end = tlv_off + tlv_tot if magic == TLV_INFO_MAGIC else 0
+                tlv_off += TLV_INFO_SIZE
+                while tlv_off + TLV_SIZE <= tlv_end:
+                    tlv_type, _, tlv_len = struct.unpack(
+                        e + 'BBH', member[tlv_off:tlv_off + TLV_SIZE])
+                    if tlv_type == TLV_VALUES['SHA256'] and tlv_len == 32:
+                        digest = member[tlv_off + TLV_SIZE:
+                                        tlv_off + TLV_SIZE + tlv_len]
+                        break
+                    tlv_off += TLV_SIZE + tlv_len
+            if digest is None or len(digest) != 32:
+                raise click.UsageError("{} has no image hash".format(path))
+
+            self.manifest.append((image_id, bytes(digest)))
+
+    def create_delta(self, base_path, sector_size, key, public_key_format,
+                     dependencies=None):
+        """
+        Replace the image created by create() with a patch rebuilding it
+        from the image in base_path, which must be the one currently in the
+        primary slot.  sector_size is the smallest sector size of the slot.
+        """
+        if self.enckey is not None:
+            raise click.UsageError("Delta images cannot be encrypted")
+
+        ext = os.path.splitext(base_path)[1][1:].lower()
+        try:
+            if ext == INTEL_HEX_EXT:
+                base = IntelHex(base_path).tobinarray().tobytes()
+            else:
+                with open(base_path, 'rb') as f:
+                    base = f.read()
+        except FileNotFoundError:
+            raise click.UsageError("Delta base file not found")
+
+        e = STRUCT_ENDIAN_DICT[self.endian]
+        if len(base) < IMAGE_HEADER_SIZE:
+            raise click.UsageError("Delta base is not an image")
+        (magic, _, hdr_size, prot_tlv_size, img_size,
+         flags) = struct.unpack(e + 'IIHHII', base[:20])
+        if magic != IMAGE_MAGIC:
+            raise click.UsageError("Delta base is not an image")
+        if flags & (IMAGE_F['ENCRYPTED'] | IMAGE_F['DELTA']):
+            raise click.UsageError("Delta base must be a plain image")
+
+        # The base is identified by the same hash the bootloader checks,
+        # covering the header, the image and the protected TLVs.
+        base_size = hdr_size + img_size + prot_tlv_size
+        if len(base) < base_size:
+            raise click.UsageError("Delta base is truncated")
+        base = base[:base_size]
+
+        patch = delta.create_patch(base, self.payload, sector_size,
+                                   self.endian)
+        self.delta_base = hashlib.sha256(base).digest()
+        self.payload = bytes(self.header_size) + patch
+        self.create(key, public_key_format, None, dependencies)
+
+    def create_compressed(self, key, public_key_format, dependencies=None):
+        """
+        Replace the image created by create() with an image holding it
+        compressed, which the bootloader decompresses while installing it.
+        """
+        if self.enckey is not None:
+            raise click.UsageError("Compressed images cannot be encrypted")
+
+        image = bytes(self.payload)
+        self.decomp = (len(image), hashlib.sha256(image).digest())
+        self.payload = bytes(self.header_size) + compression.compress(image)
+        self.create(key, public_key_format, None, dependencies)
+
     def add_header(self, enckey, protected_tlv_size):
         """Install the image header."""
 
@@ -437,6 +586,14 @@ class Image():
             # Indicates that this image should be loaded into RAM
             # instead of run directly from flash.
             flags |= IMAGE_F['RAM_LOAD']
+        if self.rom_fixed is not None:
+            # Indicates that this image is linked to run in place from the
+            # slot at this offset.
+            flags |= IMAGE_F['ROM_FIXED']
+        if self.delta_base is not None:
+            flags |= IMAGE_F['DELTA']
+        if self.decomp is not None:
+            flags |= IMAGE_F['COMPRESSED']
 
         e = STRUCT_ENDIAN_DICT[self.endian]
         fmt = (e +
@@ -453,6 +610,7 @@ class Image():
         assert struct.calcsize(fmt) == IMAGE_HEADER_SIZE
         header = struct.pack(fmt,
                 IMAGE_MAGIC,
+                self.rom_fixed if self.rom_fixed is not None else
                 self.load_addr,
                 self.header_size,
                 protected_tlv_size,  # TLV Info header + Protected TLVs
@@ -467,7 +625,7 @@ class Image():
         self.payload[:len(header)] = header
 
     def _trailer_size(self, write_size, max_sectors, overwrite_only, enckey,
-                      save_enctlv, enctlv_len):
+                      save_enctlv, enctlv_len, seal_enckey=False):
         # NOTE: should already be checked by the argument parser
         magic_size = 16
         if overwrite_only:
@@ -482,6 +640,10 @@ class Image():
                 if save_enctlv:
                     # TLV saved by the bootloader is aligned
                     keylen = (int((enctlv_len - 1) / MAX_ALIGN) + 1) * MAX_ALIGN
+                elif seal_enckey:
+                    # Wrapped key and TLV digest, aligned
+                    keylen = (int((SEALED_KEY_LEN - 1) / MAX_ALIGN) + 1) * \
+                             MAX_ALIGN
                 else:
                     keylen = 16
                 trailer += keylen * 2  # encryption keys
@@ -493,7 +655,8 @@ class Image():
         """Pad the image to the given size, with the given flash alignment."""
         tsize = self._trailer_size(self.align, self.max_sectors,
                                    self.overwrite_only, self.enckey,
-                                   self.save_enctlv, self.enctlv_len)
+                                   self.save_enctlv, self.enctlv_len,
+                                   self.seal_enckey)
         padding = size - (len(self.payload) + tsize)
         pbytes = bytearray([self.erased_val] * padding)
         pbytes += bytearray([self.erased_val] * (tsize - len(boot_magic)))
@@ -2,12 +2,15 @@
 ECDSA key management
 """
 
+import sys
+
 from cryptography.hazmat.backends import default_backend
 from cryptography.hazmat.primitives import serialization
 from cryptography.hazmat.primitives.asymmetric import ec
 from cryptography.hazmat.primitives.hashes import SHA256
 
 from .general import KeyClass
+from ..ec256_table import create_public_key_table
 
 class ECDSAUsageError(Exception):
     pass
@@ -45,6 +48,17 @@ class ECDSA256P1Public(KeyClass):
         with open(path, 'wb') as f:
             f.write(pem)
 
+    def emit_c_public_table(self, width, file=sys.stdout):
+        """Emit the precomputed multiples of the key used by the
+        MCUBOOT_EC256_FIXED_BASE verifier."""
+        self._emit(
+                header="const unsigned char {}_pub_key_table[] = {{".format(self.shortname()),
+                trailer="};",
+                encoded_bytes=create_public_key_table(self.get_public_bytes(), width),
+                indent="    ",
+                file=file,
+                autogen_message=False)
+
     def sig_type(self):
         return "ECDSA256_SHA256"
 
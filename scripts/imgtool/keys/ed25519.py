@@ -2,11 +2,14 @@
 ED25519 key management
 """
 
+import sys
+
 from cryptography.hazmat.backends import default_backend
 from cryptography.hazmat.primitives import serialization
 from cryptography.hazmat.primitives.asymmetric import ed25519
 
 from .general import KeyClass
+from ..ed25519_table import create_public_key_table
 
 
 class Ed25519UsageError(Exception):
@@ -46,6 +49,18 @@ class Ed25519Public(KeyClass):
         with open(path, 'wb') as f:
             f.write(pem)
 
+    def emit_c_public_table(self, file=sys.stdout):
+        """Emit the precomputed multiples of the key used by the
+        MCUBOOT_ED25519_FIXED_BASE verifier."""
+        # The raw key is the end of the SubjectPublicKeyInfo.
+        self._emit(
+                header="const unsigned char {}_pub_key_table[] = {{".format(self.shortname()),
+                trailer="};",
+                encoded_bytes=create_public_key_table(self.get_public_bytes()[-32:]),
+                indent="    ",
+                file=file,
+                autogen_message=False)
+
     def sig_type(self):
         return "ED25519"
 
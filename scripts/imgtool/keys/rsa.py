@@ -2,6 +2,8 @@
 RSA Key management
 """
 
+import sys
+
 from cryptography.hazmat.backends import default_backend
 from cryptography.hazmat.primitives import serialization
 from cryptography.hazmat.primitives.asymmetric import rsa
@@ -56,6 +58,20 @@ class RSAPublic(KeyClass):
         with open(path, 'wb') as f:
             f.write(pem)
 
+    def emit_c_public_table(self, file=sys.stdout):
+        """Emit the modulus N and RR = 2^(2 * key_size) mod N, used by the
+        MCUBOOT_RSA_PRECOMP verifier."""
+        size = self.key_size() // 8
+        n = self._get_public().public_numbers().n
+        rr = pow(2, 2 * self.key_size(), n)
+        self._emit(
+                header="const unsigned char {}_pub_key_table[] = {{".format(self.shortname()),
+                trailer="};",
+                encoded_bytes=n.to_bytes(size, 'big') + rr.to_bytes(size, 'big'),
+                indent="    ",
+                file=file,
+                autogen_message=False)
+
     def sig_type(self):
         return "PKCS1_PSS_RSA{}_SHA256".format(self.key_size())
 
@@ -101,16 +101,40 @@ def keygen(type, key, password):
     keygens[type](key, password)
 
 
+@click.option('--rsa-precomp', default=False, is_flag=True,
+              help='Also dump the precomputed Montgomery constant of an RSA '
+              'key, for MCUBOOT_RSA_PRECOMP (C only)')
+@click.option('--ed25519-table', default=False, is_flag=True,
+              help='Also dump the table of precomputed multiples of an '
+              'Ed25519 key, for MCUBOOT_ED25519_FIXED_BASE (C only)')
+@click.option('--ec256-table-width', type=click.IntRange(4, 6),
+              default=None, help='Also dump the table of precomputed '
+              'multiples of an ECDSA P-256 key, with this comb width, for '
+              'MCUBOOT_EC256_FIXED_BASE (C only)')
 @click.option('-l', '--lang', metavar='lang', default=valid_langs[0],
               type=click.Choice(valid_langs))
 @click.option('-k', '--key', metavar='filename', required=True)
 @click.command(help='Dump public key from keypair')
-def getpub(key, lang):
+def getpub(key, lang, ec256_table_width, ed25519_table, rsa_precomp):
     key = load_key(key)
     if key is None:
         print("Invalid passphrase")
     elif lang == 'c':
         key.emit_c_public()
+        if ec256_table_width is not None:
+            if not isinstance(key, keys.ECDSA256P1Public):
+                raise click.UsageError("--ec256-table-width requires an "
+                                       "ECDSA P-256 key")
+            key.emit_c_public_table(ec256_table_width)
+        if ed25519_table:
+            if not isinstance(key, keys.Ed25519Public):
+                raise click.UsageError("--ed25519-table requires an Ed25519 "
+                                       "key")
+            key.emit_c_public_table()
+        if rsa_precomp:
+            if not isinstance(key, keys.RSAPublic):
+                raise click.UsageError("--rsa-precomp requires an RSA key")
+            key.emit_c_public_table()
     elif lang == 'rust':
         key.emit_rust_public()
     else:
@@ -211,6 +235,19 @@ def get_dependencies(ctx, param, value):
         return dependencies
 
 
+def get_manifest(ctx, param, value):
+    if value is not None:
+        members = re.findall(r"\((\d+)\s*,\s*([^)]+?)\s*\)", value)
+        if len(members) == 0:
+            raise click.BadParameter(
+                "Image manifest format is invalid: {}".format(value))
+        images = [int(image_id) for image_id, _ in members]
+        if 0 in images or len(set(images)) != len(images):
+            raise click.BadParameter(
+                "Image manifest must list distinct images other than 0")
+        return [(int(image_id), path) for image_id, path in members]
+
+
 class BasedIntParamType(click.ParamType):
     name = 'integer'
 
@@ -232,10 +269,27 @@ class BasedIntParamType(click.ParamType):
               help='Adjust address in hex output file.')
 @click.option('-L', '--load-addr', type=BasedIntParamType(), required=False,
               help='Load address for image when it should run from RAM.')
+@click.option('--rom-fixed', type=BasedIntParamType(), required=False,
+              help='Offset of the slot the image is linked to run in place '
+                   'from. Only for BOOT_DIRECT_XIP.')
 @click.option('--save-enctlv', default=False, is_flag=True,
               help='When upgrading, save encrypted key TLVs instead of plain '
                    'keys. Enable when BOOT_SWAP_SAVE_ENCTLV config option '
                    'was set.')
+@click.option('--seal-enckey', default=False, is_flag=True,
+              help='When upgrading, save keys sealed with a device key '
+                   'instead of plain keys. Enable when BOOT_SWAP_SEAL_ENCKEY '
+                   'config option was set.')
+@click.option('--delta-sector-size', type=BasedIntParamType(),
+              required=False,
+              help='Smallest sector size of the primary slot, required with '
+                   '--delta-base.')
+@click.option('--delta-base', metavar='filename',
+              help='Create a patch against this image, which must be the one '
+                   'in the primary slot. Requires BOOT_DELTA_UPGRADE.')
+@click.option('--compress', default=False, is_flag=True,
+              help='Compress the image, which the bootloader decompresses '
+                   'while installing it. Requires BOOT_COMPRESSED_IMAGES.')
 @click.option('-E', '--encrypt', metavar='filename',
               help='Encrypt image using the provided public key')
 @click.option('-e', '--endian', type=click.Choice(['little', 'big']),
@@ -266,6 +320,10 @@ class BasedIntParamType(click.ParamType):
 @click.option('-d', '--dependencies', callback=get_dependencies,
               required=False, help='''Add dependence on another image, format:
               "(<image_ID>,<image_version>), ... "''')
+@click.option('--manifest', callback=get_manifest, required=False,
+              help='''List the images of a set, which are then accepted without
+              a signature of their own. Only for image 0. Requires
+              BOOT_IMAGE_MANIFEST. Format: "(<image_ID>,<filename>), ... "''')
 @click.option('-s', '--security-counter', callback=validate_security_counter,
               help='Specify the value of security counter. Use the `auto` '
               'keyword to automatically generate it from the image version.')
@@ -282,14 +340,15 @@ class BasedIntParamType(click.ParamType):
 def sign(key, public_key_format, align, version, pad_sig, header_size,
          pad_header, slot_size, pad, confirm, max_sectors, overwrite_only,
          endian, encrypt, infile, outfile, dependencies, load_addr, hex_addr,
-         erased_val, save_enctlv, security_counter, boot_record):
+         erased_val, save_enctlv, seal_enckey, security_counter, boot_record,
+         delta_base, delta_sector_size, compress, manifest, rom_fixed):
     img = image.Image(version=decode_version(version), header_size=header_size,
                       pad_header=pad_header, pad=pad, confirm=confirm,
                       align=int(align), slot_size=slot_size,
                       max_sectors=max_sectors, overwrite_only=overwrite_only,
                       endian=endian, load_addr=load_addr, erased_val=erased_val,
-                      save_enctlv=save_enctlv,
-                      security_counter=security_counter)
+                      save_enctlv=save_enctlv, seal_enckey=seal_enckey,
+                      security_counter=security_counter, rom_fixed=rom_fixed)
     img.load(infile)
     key = load_key(key) if key else None
     enckey = load_key(encrypt) if encrypt else None
@@ -305,7 +364,23 @@ def sign(key, public_key_format, align, version, pad_sig, header_size,
     if pad_sig and hasattr(key, 'pad_sig'):
         key.pad_sig = True
 
+    if load_addr and rom_fixed is not None:
+        raise click.UsageError("--load-addr and --rom-fixed cannot be "
+                               "combined")
+    if delta_base and not delta_sector_size:
+        raise click.UsageError("--delta-base requires --delta-sector-size")
+    if delta_base and compress:
+        raise click.UsageError("--delta-base and --compress cannot be "
+                               "combined")
+
+    if manifest:
+        img.set_manifest(manifest)
     img.create(key, public_key_format, enckey, dependencies, boot_record)
+    if delta_base:
+        img.create_delta(delta_base, delta_sector_size, key,
+                         public_key_format, dependencies)
+    if compress:
+        img.create_compressed(key, public_key_format, dependencies)
     img.save(outfile, hex_addr)
 
 
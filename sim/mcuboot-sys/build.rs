@@ -15,12 +15,31 @@ fn main() {
     let sig_ed25519 = env::var("CARGO_FEATURE_SIG_ED25519").is_ok();
     let overwrite_only = env::var("CARGO_FEATURE_OVERWRITE_ONLY").is_ok();
     let swap_move = env::var("CARGO_FEATURE_SWAP_MOVE").is_ok();
+    let swap_ram = env::var("CARGO_FEATURE_SWAP_RAM").is_ok();
+    let direct_xip = env::var("CARGO_FEATURE_DIRECT_XIP").is_ok();
     let validate_primary_slot =
                   env::var("CARGO_FEATURE_VALIDATE_PRIMARY_SLOT").is_ok();
+    let hash_on_copy = env::var("CARGO_FEATURE_HASH_ON_COPY").is_ok();
+    let validated_marker = env::var("CARGO_FEATURE_VALIDATED_MARKER").is_ok();
+    let flash_area_get_ptr = env::var("CARGO_FEATURE_FLASH_AREA_GET_PTR").is_ok();
+    let copy_double_buf = env::var("CARGO_FEATURE_COPY_DOUBLE_BUF").is_ok();
+    let flash_async = env::var("CARGO_FEATURE_FLASH_ASYNC").is_ok();
+    let flash_block_erase = env::var("CARGO_FEATURE_FLASH_BLOCK_ERASE").is_ok();
+    let swap_skip_identical = env::var("CARGO_FEATURE_SWAP_SKIP_IDENTICAL").is_ok();
+    let scratch_wear_leveling = env::var("CARGO_FEATURE_SCRATCH_WEAR_LEVELING").is_ok();
+    let swap_sector_status = env::var("CARGO_FEATURE_SWAP_SECTOR_STATUS").is_ok();
+    let delta_upgrade = env::var("CARGO_FEATURE_DELTA_UPGRADE").is_ok();
+    let compressed_images = env::var("CARGO_FEATURE_COMPRESSED_IMAGES").is_ok();
+    let image_manifest = env::var("CARGO_FEATURE_IMAGE_MANIFEST").is_ok();
+    let rsa_precomp = env::var("CARGO_FEATURE_RSA_PRECOMP").is_ok();
+    let ec256_fixed_base = env::var("CARGO_FEATURE_EC256_FIXED_BASE").is_ok();
+    let ed25519_fixed_base = env::var("CARGO_FEATURE_ED25519_FIXED_BASE").is_ok();
     let enc_rsa = env::var("CARGO_FEATURE_ENC_RSA").is_ok();
     let enc_kw = env::var("CARGO_FEATURE_ENC_KW").is_ok();
     let enc_ec256 = env::var("CARGO_FEATURE_ENC_EC256").is_ok();
     let enc_x25519 = env::var("CARGO_FEATURE_ENC_X25519").is_ok();
+    let enc_decrypt_once = env::var("CARGO_FEATURE_ENC_DECRYPT_ONCE").is_ok();
+    let seal_enckey = env::var("CARGO_FEATURE_SEAL_ENCKEY").is_ok();
     let bootstrap = env::var("CARGO_FEATURE_BOOTSTRAP").is_ok();
     let multiimage = env::var("CARGO_FEATURE_MULTIIMAGE").is_ok();
     let downgrade_prevention = env::var("CARGO_FEATURE_DOWNGRADE_PREVENTION").is_ok();
@@ -45,6 +64,101 @@ fn main() {
         conf.define("MCUBOOT_VALIDATE_PRIMARY_SLOT", None);
     }
 
+    if hash_on_copy {
+        conf.define("MCUBOOT_HASH_ON_COPY", None);
+    }
+
+    if enc_decrypt_once {
+        if !hash_on_copy || !swap_move {
+            panic!("Decrypt once requires hash on copy and swap move");
+        }
+        conf.define("MCUBOOT_ENC_DECRYPT_ONCE", None);
+    }
+
+    if seal_enckey {
+        if !(enc_rsa || enc_kw || enc_ec256 || enc_x25519) || overwrite_only {
+            panic!("Sealed keys require image encryption with swap upgrades");
+        }
+        conf.define("MCUBOOT_SWAP_SEAL_ENCKEY", None);
+    }
+
+    if validated_marker {
+        if !validate_primary_slot {
+            panic!("Validated marker requires validate primary slot");
+        }
+        conf.define("MCUBOOT_VALIDATED_MARKER", None);
+        conf.define("MCUBOOT_VALIDATED_MARKER_MAX_BOOTS", Some("4"));
+    }
+
+    if flash_area_get_ptr {
+        conf.define("MCUBOOT_FLASH_AREA_GET_PTR", None);
+    }
+
+    if copy_double_buf {
+        conf.define("MCUBOOT_COPY_DOUBLE_BUF", None);
+        // Use small chunks so that copies go through many of them.
+        conf.define("MCUBOOT_COPY_BUF_SIZE", Some("128"));
+    }
+
+    if flash_async {
+        conf.define("MCUBOOT_FLASH_ASYNC", None);
+    }
+
+    if flash_block_erase {
+        conf.define("MCUBOOT_FLASH_BLOCK_ERASE", None);
+    }
+
+    if swap_skip_identical {
+        conf.define("MCUBOOT_SWAP_SKIP_IDENTICAL", None);
+    }
+
+    if scratch_wear_leveling {
+        if overwrite_only || swap_move || swap_ram {
+            panic!("Scratch wear leveling requires swap using scratch");
+        }
+        conf.define("MCUBOOT_SCRATCH_WEAR_LEVELING", None);
+    }
+
+    if swap_sector_status {
+        if overwrite_only || swap_move || swap_ram {
+            panic!("Per-sector swap status requires swap using scratch");
+        }
+        conf.define("MCUBOOT_SWAP_SECTOR_STATUS", None);
+    }
+
+    if delta_upgrade {
+        if overwrite_only || swap_move || swap_ram {
+            panic!("Delta upgrades require swap using scratch");
+        }
+        conf.define("MCUBOOT_DELTA_UPGRADE", None);
+    }
+
+    if compressed_images {
+        if !overwrite_only {
+            panic!("Compressed images require overwrite only");
+        }
+        conf.define("MCUBOOT_COMPRESSED_IMAGES", None);
+    }
+
+    if image_manifest {
+        if !multiimage {
+            panic!("Image manifests require multiimage");
+        }
+        conf.define("MCUBOOT_IMAGE_MANIFEST", None);
+    }
+
+    if rsa_precomp {
+        conf.define("MCUBOOT_RSA_PRECOMP", None);
+    }
+
+    if ec256_fixed_base {
+        conf.define("MCUBOOT_EC256_FIXED_BASE", None);
+    }
+
+    if ed25519_fixed_base {
+        conf.define("MCUBOOT_ED25519_FIXED_BASE", None);
+    }
+
     if downgrade_prevention {
         conf.define("MCUBOOT_DOWNGRADE_PREVENTION", None);
     }
@@ -128,6 +242,21 @@ fn main() {
         conf.define("MCUBOOT_SWAP_USING_MOVE", None);
     }
 
+    if swap_ram {
+        if overwrite_only || swap_move {
+            panic!("Swap using RAM cannot be combined with overwrite only or swap move");
+        }
+        conf.define("MCUBOOT_SWAP_USING_RAM", None);
+    }
+
+    if direct_xip {
+        if overwrite_only || swap_move || swap_ram || delta_upgrade || multiimage ||
+            enc_rsa || enc_kw || enc_ec256 || enc_x25519 {
+            panic!("Direct-XIP requires a single plain image, without upgrades");
+        }
+        conf.define("MCUBOOT_DIRECT_XIP", None);
+    }
+
     if enc_rsa {
         conf.define("MCUBOOT_ENCRYPT_RSA", None);
         conf.define("MCUBOOT_ENC_IMAGES", None);
@@ -189,7 +318,9 @@ fn main() {
         conf.define("MCUBOOT_ENCRYPT_EC256", None);
         conf.define("MCUBOOT_ENC_IMAGES", None);
         conf.define("MCUBOOT_USE_TINYCRYPT", None);
-        conf.define("MCUBOOT_SWAP_SAVE_ENCTLV", None);
+        if !seal_enckey {
+            conf.define("MCUBOOT_SWAP_SAVE_ENCTLV", None);
+        }
 
         conf.file("../../boot/bootutil/src/encrypted.c");
         conf.file("csupport/keys.c");
@@ -219,7 +350,9 @@ fn main() {
         conf.define("MCUBOOT_ENCRYPT_X25519", None);
         conf.define("MCUBOOT_ENC_IMAGES", None);
         conf.define("MCUBOOT_USE_TINYCRYPT", None);
-        conf.define("MCUBOOT_SWAP_SAVE_ENCTLV", None);
+        if !seal_enckey {
+            conf.define("MCUBOOT_SWAP_SAVE_ENCTLV", None);
+        }
 
         conf.file("../../boot/bootutil/src/encrypted.c");
         conf.file("csupport/keys.c");
@@ -259,6 +392,7 @@ fn main() {
         conf.file("../../boot/bootutil/src/image_rsa.c");
     } else if sig_ecdsa {
         conf.file("../../boot/bootutil/src/image_ec256.c");
+        conf.file("../../boot/bootutil/src/ec256_fixed_base.c");
     } else if sig_ed25519 {
         conf.file("../../boot/bootutil/src/image_ed25519.c");
     }
@@ -266,6 +400,9 @@ fn main() {
     conf.file("../../boot/bootutil/src/swap_misc.c");
     conf.file("../../boot/bootutil/src/swap_scratch.c");
     conf.file("../../boot/bootutil/src/swap_move.c");
+    conf.file("../../boot/bootutil/src/swap_delta.c");
+    conf.file("../../boot/bootutil/src/swap_ram.c");
+    conf.file("../../boot/bootutil/src/decompress.c");
     conf.file("../../boot/bootutil/src/caps.c");
     conf.file("../../boot/bootutil/src/bootutil_misc.c");
     conf.file("../../boot/bootutil/src/tlv.c");
@@ -50,6 +50,80 @@ const unsigned char root_pub_der[] = {
     0xc9, 0x02, 0x03, 0x01, 0x00, 0x01
 };
 const unsigned int root_pub_der_len = 270;
+const unsigned char root_pub_der_hash[] = {
+    0xfc, 0x57, 0x01, 0xdc, 0x61, 0x35, 0xe1, 0x32, 0x38, 0x47, 0xbd, 0xc4,
+    0x0f, 0x04, 0xd2, 0xe5, 0xbe, 0xe5, 0x83, 0x3b, 0x23, 0xc2, 0x9f, 0x93,
+    0x59, 0x3d, 0x00, 0x01, 0x8c, 0xfa, 0x99, 0x94,
+};
+#if defined(MCUBOOT_RSA_PRECOMP)
+/* The modulus and RR = 2^4096 mod N. */
+const unsigned char root_pub_der_table[] = {
+    0xd1, 0x06, 0x08, 0x1a, 0x18, 0x44, 0x2c, 0x18,
+    0xe8, 0xfb, 0xfd, 0xf7, 0x0d, 0xa3, 0x4f, 0x1f,
+    0xbb, 0xee, 0x5e, 0xf9, 0xaa, 0xd2, 0x4b, 0x18,
+    0xd3, 0x5a, 0xe9, 0x6d, 0x18, 0x80, 0x19, 0xf9,
+    0xf0, 0x9c, 0x34, 0x1b, 0xcb, 0xf3, 0xbc, 0x74,
+    0xdb, 0x42, 0xe7, 0x8c, 0x7f, 0x10, 0x53, 0x7e,
+    0x43, 0x5e, 0x0d, 0x57, 0x2c, 0x44, 0xd1, 0x67,
+    0x08, 0x0f, 0x0d, 0xbb, 0x5c, 0xee, 0xec, 0xb3,
+    0x99, 0xdf, 0xe0, 0x4d, 0x84, 0x0b, 0xaa, 0x77,
+    0x41, 0x60, 0xed, 0x15, 0x28, 0x49, 0xa7, 0x01,
+    0xb4, 0x3c, 0x10, 0xe6, 0x69, 0x8c, 0x2f, 0x5f,
+    0xac, 0x41, 0x4d, 0x9e, 0x5c, 0x14, 0xdf, 0xf2,
+    0xf8, 0xcf, 0x3d, 0x1e, 0x6f, 0xe7, 0x5b, 0xba,
+    0xb4, 0xa9, 0xc8, 0x88, 0x7e, 0x47, 0x3c, 0x94,
+    0xc3, 0x77, 0x67, 0x54, 0x4b, 0xaa, 0x8d, 0x38,
+    0x35, 0xca, 0x62, 0x61, 0x7e, 0xb7, 0xe1, 0x15,
+    0xdb, 0x77, 0x73, 0xd4, 0xbe, 0x7b, 0x72, 0x21,
+    0x89, 0x69, 0x24, 0xfb, 0xf8, 0x65, 0x6e, 0x64,
+    0x3e, 0xc8, 0x0e, 0xd7, 0x85, 0xd5, 0x5c, 0x4a,
+    0xe4, 0x53, 0x0d, 0x2f, 0xff, 0xb7, 0xfd, 0xf3,
+    0x13, 0x39, 0x83, 0x3f, 0xa3, 0xae, 0xd2, 0x0f,
+    0xa7, 0x6a, 0x9d, 0xf9, 0xfe, 0xb8, 0xce, 0xfa,
+    0x2a, 0xbe, 0xaf, 0xb8, 0xe0, 0xfa, 0x82, 0x37,
+    0x54, 0xf4, 0x3e, 0xe1, 0x2b, 0xd0, 0xd3, 0x08,
+    0x58, 0x18, 0xf6, 0x5e, 0x4c, 0xc8, 0x88, 0x81,
+    0x31, 0xad, 0x5f, 0xb0, 0x82, 0x17, 0xf2, 0x8a,
+    0x69, 0x27, 0x23, 0xf3, 0xab, 0x87, 0x3e, 0x93,
+    0x1a, 0x1d, 0xfe, 0xe8, 0xf8, 0x1a, 0x24, 0x66,
+    0x59, 0xf8, 0x1c, 0xab, 0xdc, 0xce, 0x68, 0x1b,
+    0x66, 0x64, 0x35, 0xec, 0xfa, 0x0d, 0x11, 0x9d,
+    0xaf, 0x5c, 0x3a, 0xa7, 0xd1, 0x67, 0xc6, 0x47,
+    0xef, 0xb1, 0x4b, 0x2c, 0x62, 0xe1, 0xd1, 0xc9,
+    0xa9, 0x20, 0xa3, 0xe8, 0xb9, 0x7f, 0x1d, 0x14,
+    0x00, 0x6e, 0x29, 0x8c, 0x1e, 0xf0, 0x51, 0xf7,
+    0x69, 0x6f, 0x8e, 0x30, 0xaf, 0xe3, 0xf5, 0xe1,
+    0x4f, 0xf5, 0x2c, 0xce, 0x61, 0x3d, 0x32, 0x17,
+    0x2e, 0x5d, 0x61, 0xf4, 0xa5, 0x7c, 0x2d, 0x5e,
+    0x15, 0xef, 0x71, 0x10, 0x44, 0x7c, 0xd5, 0xa9,
+    0xf9, 0x3f, 0x6a, 0x95, 0xa4, 0xca, 0x52, 0x44,
+    0xfc, 0x98, 0x16, 0x7d, 0xab, 0xe5, 0x0e, 0xda,
+    0x5e, 0xdb, 0x85, 0x06, 0x23, 0xf7, 0xbd, 0x3a,
+    0xc9, 0x7f, 0x93, 0xf7, 0x31, 0x66, 0xa9, 0x31,
+    0x39, 0xb5, 0x37, 0x06, 0xbc, 0xf6, 0xf0, 0x70,
+    0x79, 0x41, 0xf5, 0x44, 0x51, 0xc6, 0x6c, 0x09,
+    0xf9, 0xb8, 0xd1, 0x06, 0x35, 0x87, 0x55, 0x18,
+    0x05, 0x86, 0x30, 0x28, 0x9c, 0x26, 0x77, 0x9b,
+    0x65, 0x57, 0xf8, 0x7a, 0x52, 0x12, 0x46, 0x03,
+    0xef, 0x1a, 0x0c, 0x45, 0xba, 0x88, 0x10, 0x7e,
+    0xbb, 0x62, 0xbd, 0x84, 0xfc, 0x9e, 0xf7, 0x74,
+    0xf4, 0xc4, 0x0b, 0xbe, 0x1f, 0x61, 0x72, 0x38,
+    0x2f, 0xb5, 0x8c, 0x91, 0x93, 0x6a, 0x5c, 0xd7,
+    0xda, 0xe1, 0x58, 0xdc, 0x52, 0x49, 0xdd, 0x8c,
+    0xed, 0x49, 0xb3, 0x41, 0xfa, 0x31, 0x58, 0x6c,
+    0xa7, 0x1a, 0x32, 0xcb, 0xc2, 0x5d, 0x85, 0x81,
+    0x7e, 0xf3, 0x22, 0x96, 0x77, 0x60, 0xb7, 0x79,
+    0x9d, 0x94, 0x22, 0xc6, 0xb7, 0xee, 0x04, 0x65,
+    0xfa, 0xbd, 0xab, 0xfa, 0x05, 0xa7, 0x31, 0x4e,
+    0xb9, 0xc7, 0xf1, 0x22, 0xd7, 0x60, 0x7b, 0x1c,
+    0x6a, 0x3d, 0x59, 0x6a, 0xb6, 0x20, 0xcc, 0x9e,
+    0x49, 0x33, 0xb1, 0x56, 0xc1, 0x64, 0x8e, 0x24,
+    0x9f, 0x4c, 0xf4, 0x9b, 0x72, 0x3e, 0xae, 0xa3,
+    0x6f, 0x68, 0x95, 0xe7, 0xb8, 0xce, 0xc2, 0xe8,
+    0xa0, 0xbf, 0x6f, 0x48, 0x1a, 0xf6, 0xc6, 0x1d,
+    0x61, 0xd8, 0x87, 0xb3, 0xa4, 0x6d, 0x7e, 0x40,
+};
+#endif
 #elif MCUBOOT_SIGN_RSA_LEN == 3072
 #define HAVE_KEYS
 const unsigned char root_pub_der[] = {
@@ -105,6 +179,113 @@ const unsigned char root_pub_der[] = {
     0x3b, 0x02, 0x03, 0x01, 0x00, 0x01,
 };
 const unsigned int root_pub_der_len = 398;
+const unsigned char root_pub_der_hash[] = {
+    0x44, 0x97, 0x93, 0xfb, 0x65, 0xcd, 0x76, 0x98,
+    0x75, 0x3d, 0x5b, 0x3f, 0x35, 0xfa, 0xb1, 0x5f,
+    0x1e, 0x3a, 0x45, 0x11, 0x1f, 0xf2, 0x4e, 0x1d,
+    0x46, 0x74, 0x1d, 0xe5, 0xae, 0x12, 0xd5, 0x9e,
+};
+#if defined(MCUBOOT_RSA_PRECOMP)
+/* The modulus and RR = 2^6144 mod N. */
+const unsigned char root_pub_der_table[] = {
+    0xb4, 0x2c, 0x0e, 0x98, 0x58, 0x10, 0xa4, 0xa7,
+    0x58, 0x99, 0x7c, 0x01, 0xdd, 0x08, 0x2a, 0x28,
+    0x34, 0x33, 0xf8, 0x96, 0x1a, 0x34, 0x20, 0x5d,
+    0x45, 0xc8, 0x71, 0x26, 0x25, 0xe5, 0xd2, 0x96,
+    0xea, 0x7b, 0xb1, 0x15, 0xaa, 0xa6, 0x8a, 0x63,
+    0x22, 0x8b, 0x2d, 0x4e, 0x81, 0x73, 0xbf, 0x6e,
+    0x15, 0x68, 0x8c, 0x1a, 0xf4, 0xef, 0x2a, 0x8f,
+    0x8c, 0x22, 0x9e, 0x71, 0x57, 0x4b, 0xde, 0x0f,
+    0x7e, 0x72, 0xd3, 0x7a, 0xb8, 0xa7, 0x1d, 0x44,
+    0xad, 0x87, 0x00, 0x83, 0x5c, 0xfd, 0x73, 0x05,
+    0x72, 0x46, 0x3f, 0x8b, 0xf9, 0x10, 0x00, 0xd8,
+    0x6e, 0xcc, 0x85, 0xed, 0xf9, 0x49, 0xdb, 0x78,
+    0x36, 0x80, 0x49, 0x38, 0x76, 0xdd, 0x5f, 0x54,
+    0x04, 0xda, 0x8c, 0x34, 0xa7, 0x2b, 0x13, 0x25,
+    0x6f, 0xd1, 0x15, 0x4f, 0xad, 0xc2, 0xe1, 0xa5,
+    0xd2, 0x4e, 0x57, 0x0c, 0x7e, 0x9c, 0x9b, 0xba,
+    0x4e, 0x68, 0xb2, 0xe0, 0x25, 0x02, 0xaa, 0x00,
+    0xd3, 0xb4, 0xcc, 0x2f, 0x78, 0xe5, 0xbe, 0x47,
+    0x67, 0x1f, 0xc8, 0x6e, 0x22, 0x6c, 0x5e, 0x61,
+    0xb6, 0x9a, 0xcd, 0xe5, 0xa8, 0xba, 0x7a, 0x80,
+    0x13, 0x1b, 0x17, 0x2e, 0x96, 0xed, 0xcf, 0xb3,
+    0x9b, 0xe4, 0x1c, 0xe8, 0xad, 0xa7, 0xf6, 0x3a,
+    0x51, 0x66, 0x5e, 0x99, 0x8e, 0x87, 0xee, 0x60,
+    0x25, 0xf8, 0x8d, 0xbe, 0xce, 0xa4, 0xa8, 0xca,
+    0x93, 0x6c, 0xd7, 0xbf, 0xd4, 0x73, 0x33, 0x8d,
+    0x44, 0x85, 0xcc, 0x73, 0x30, 0x08, 0x9c, 0x4d,
+    0xb2, 0xaa, 0x5a, 0x6c, 0x6f, 0x7b, 0xab, 0xb7,
+    0xb3, 0x7c, 0xc3, 0xfb, 0xe7, 0xca, 0xc4, 0xf8,
+    0x9a, 0x6f, 0xcb, 0xbb, 0x5b, 0x82, 0xe7, 0x7a,
+    0xe8, 0x19, 0xfd, 0x2f, 0x11, 0x22, 0xfb, 0x7f,
+    0x76, 0x8c, 0x6b, 0x94, 0xa4, 0x09, 0x4f, 0xa5,
+    0x6a, 0x77, 0x51, 0xeb, 0xa7, 0x7e, 0xda, 0x87,
+    0x06, 0xee, 0xdc, 0xbe, 0xd1, 0xea, 0x1a, 0x40,
+    0x1d, 0x1b, 0xff, 0x1a, 0xb1, 0x51, 0x7c, 0x12,
+    0xb0, 0xf3, 0xf6, 0x83, 0x01, 0x9c, 0xe7, 0x0c,
+    0x99, 0xbf, 0xac, 0x68, 0x58, 0x72, 0xa4, 0xb0,
+    0x59, 0x85, 0xee, 0x85, 0xac, 0x2a, 0x22, 0xf4,
+    0xcf, 0x15, 0x08, 0x80, 0x1f, 0x0d, 0xd0, 0x1e,
+    0xa0, 0xa0, 0x94, 0xc8, 0xf7, 0xfa, 0x65, 0xdd,
+    0x52, 0xe8, 0x96, 0x37, 0x23, 0x30, 0x57, 0x36,
+    0xe6, 0x9d, 0xf4, 0x0c, 0x4a, 0x05, 0x75, 0x1f,
+    0xad, 0x01, 0xca, 0xb7, 0x6d, 0x8c, 0x43, 0x74,
+    0x06, 0x0a, 0x81, 0xf3, 0x01, 0x62, 0xff, 0xf7,
+    0xf5, 0x5f, 0xaf, 0xe7, 0x2b, 0x0e, 0xf8, 0x81,
+    0xb5, 0x65, 0xdd, 0x01, 0xd9, 0x9f, 0x07, 0x17,
+    0x8a, 0x18, 0xcf, 0x23, 0x6e, 0x88, 0x65, 0x91,
+    0xb5, 0x7b, 0xd3, 0xb0, 0x2d, 0xaf, 0x93, 0x66,
+    0x63, 0x74, 0xac, 0x5a, 0xe6, 0x73, 0xde, 0x3b,
+    0x0b, 0x94, 0x00, 0x21, 0xa6, 0xd2, 0xf0, 0x92,
+    0x07, 0x17, 0xef, 0x99, 0x62, 0x86, 0x26, 0x73,
+    0x3d, 0x43, 0x38, 0xf5, 0x43, 0x75, 0x15, 0x95,
+    0xb1, 0xdb, 0x1f, 0xcf, 0x18, 0x4b, 0x19, 0xfc,
+    0x65, 0xfa, 0x9b, 0x83, 0x50, 0x4c, 0x87, 0x2d,
+    0x29, 0x59, 0x87, 0x98, 0x8a, 0x82, 0x95, 0xd9,
+    0xb2, 0x39, 0xdb, 0x53, 0xeb, 0x13, 0x28, 0xd3,
+    0xd3, 0x0b, 0x11, 0xc5, 0x2b, 0x96, 0x6e, 0x7b,
+    0x4a, 0x34, 0x32, 0x9a, 0xc7, 0x7b, 0xb7, 0xfe,
+    0x9d, 0xc4, 0xdb, 0x1b, 0xc3, 0xd2, 0x50, 0x6c,
+    0xf9, 0x91, 0xdb, 0xbc, 0xd6, 0x1e, 0x94, 0x16,
+    0x14, 0xa5, 0xc5, 0xc5, 0xaf, 0x38, 0x71, 0x0c,
+    0x85, 0xaa, 0x9f, 0x1c, 0x7e, 0x27, 0x62, 0xdf,
+    0x99, 0x70, 0x52, 0xd1, 0x82, 0xda, 0x2b, 0xec,
+    0xbd, 0x60, 0xe1, 0xfb, 0xd1, 0x4c, 0xbd, 0x50,
+    0x4e, 0x2c, 0x2b, 0xea, 0x47, 0x48, 0x96, 0x02,
+    0xf7, 0x72, 0x66, 0x75, 0x54, 0x71, 0x5f, 0x22,
+    0xbb, 0x07, 0x51, 0x58, 0x3e, 0x9d, 0x92, 0xe1,
+    0x0e, 0x49, 0x95, 0x45, 0x23, 0x87, 0x01, 0xa7,
+    0x07, 0xa0, 0x97, 0x92, 0x60, 0xf5, 0x86, 0x7d,
+    0x95, 0xbc, 0xfe, 0x91, 0x93, 0xc4, 0x4e, 0xee,
+    0xf0, 0x00, 0xfe, 0x77, 0xae, 0xef, 0xc4, 0x1f,
+    0x49, 0x8f, 0xc1, 0x66, 0xb0, 0x98, 0xe8, 0xd7,
+    0x84, 0xf4, 0xf9, 0x32, 0x79, 0x80, 0x03, 0xc8,
+    0xcd, 0x0b, 0x6e, 0x0a, 0x18, 0x68, 0xdf, 0x5b,
+    0xbb, 0xb2, 0x33, 0x2b, 0xdc, 0x80, 0x58, 0x93,
+    0x16, 0xd3, 0x27, 0x4a, 0x91, 0xdb, 0x40, 0xc5,
+    0xed, 0x2a, 0x7b, 0xec, 0xd5, 0xee, 0xb4, 0xd1,
+    0x54, 0xec, 0x83, 0x29, 0xd8, 0xa8, 0x3c, 0x6f,
+    0x1d, 0x4f, 0xed, 0xc3, 0x9a, 0xb1, 0x67, 0xb2,
+    0x7c, 0x55, 0x23, 0x0a, 0x94, 0xe7, 0x2b, 0xb3,
+    0x33, 0xcd, 0x40, 0x27, 0xd3, 0x10, 0x2d, 0xf5,
+    0x9d, 0x2f, 0xb3, 0xb0, 0x66, 0x55, 0xe8, 0x82,
+    0xb9, 0x73, 0x4c, 0xc0, 0xf1, 0x3c, 0x6f, 0x69,
+    0x9b, 0xdb, 0xaf, 0xc1, 0x4a, 0xf6, 0xe5, 0x91,
+    0x31, 0x87, 0xa3, 0x04, 0xd5, 0xbc, 0x22, 0x23,
+    0x2d, 0x60, 0x25, 0x49, 0xb7, 0x29, 0xa6, 0xa8,
+    0xa5, 0xa3, 0xc4, 0xa7, 0x03, 0x2b, 0xca, 0x90,
+    0x7d, 0x5a, 0x6a, 0x66, 0xfe, 0x4c, 0xab, 0x9d,
+    0x42, 0xb3, 0x32, 0xaa, 0xc5, 0x36, 0xbc, 0x01,
+    0x00, 0xbf, 0x7f, 0xe1, 0x1a, 0x3e, 0x39, 0x6d,
+    0xd3, 0x26, 0xe8, 0x31, 0x05, 0x08, 0xb1, 0x68,
+    0x3b, 0xc0, 0xbb, 0x80, 0xf5, 0xbd, 0x5f, 0x21,
+    0xfb, 0xa0, 0x82, 0xe4, 0x04, 0x08, 0x3d, 0xcf,
+    0x8a, 0x5b, 0xb3, 0x39, 0x9a, 0xc7, 0x68, 0x8c,
+    0x2e, 0xf5, 0xde, 0xec, 0x55, 0x12, 0x3f, 0xc5,
+    0xe0, 0xdd, 0x62, 0x59, 0x7c, 0xa6, 0x1b, 0x2d,
+    0x3a, 0x87, 0x90, 0x48, 0xa0, 0x46, 0x38, 0xd4,
+};
+#endif
 #endif
 #elif defined(MCUBOOT_SIGN_EC256)
 #define HAVE_KEYS
@@ -122,6 +303,138 @@ const unsigned char root_pub_der[] = {
     0x8b, 0x68, 0x34, 0xcc, 0x3a, 0x6a, 0xfc, 0x53,
     0x8e, 0xfa, 0xc1, };
 const unsigned int root_pub_der_len = 91;
+const unsigned char root_pub_der_hash[] = {
+    0xe3, 0x04, 0x66, 0xf6, 0xb8, 0x47, 0x0c, 0x1f,
+    0x29, 0x07, 0x0b, 0x17, 0xf1, 0xe2, 0xd3, 0xe9,
+    0x4d, 0x44, 0x5e, 0x3f, 0x60, 0x80, 0x87, 0xfd,
+    0xc7, 0x11, 0xe4, 0x38, 0x2b, 0xb5, 0x38, 0xb6,
+};
+#if defined(MCUBOOT_EC256_FIXED_BASE)
+/* Precomputed multiples of the key, with a width of 4. */
+const unsigned char root_pub_der_table[] = {
+    0x04, 0x00, 0x00, 0x00, 0x2a, 0xcb, 0x40, 0x3c,
+    0xe8, 0xfe, 0xed, 0x5b, 0xa4, 0x49, 0x95, 0xa1,
+    0xa9, 0x1d, 0xae, 0xe8, 0xdb, 0xbe, 0x19, 0x37,
+    0xcd, 0x14, 0xfb, 0x2f, 0x24, 0x57, 0x37, 0xe5,
+    0x95, 0x39, 0x88, 0xd9, 0x94, 0xb9, 0xd6, 0x5a,
+    0xeb, 0xd7, 0xcd, 0xd5, 0x30, 0x8a, 0xd6, 0xfe,
+    0x48, 0xb2, 0x4a, 0x6a, 0x81, 0x0e, 0xe5, 0xf0,
+    0x7d, 0x8b, 0x68, 0x34, 0xcc, 0x3a, 0x6a, 0xfc,
+    0x53, 0x8e, 0xfa, 0xc1, 0x40, 0x14, 0x12, 0xb1,
+    0xf1, 0xc4, 0x9e, 0x0c, 0xdd, 0x08, 0xfd, 0xc4,
+    0xa4, 0xbf, 0xdf, 0xf6, 0xb9, 0x38, 0x81, 0x9c,
+    0x90, 0x76, 0xf8, 0x7e, 0x37, 0xfe, 0xa7, 0x7a,
+    0xe0, 0xde, 0x8d, 0x08, 0x18, 0xff, 0xad, 0xa2,
+    0x41, 0x0f, 0xd6, 0x9b, 0x7b, 0x5a, 0xcd, 0x96,
+    0xfc, 0xb3, 0x4a, 0x59, 0x24, 0x87, 0x3c, 0x84,
+    0x25, 0x4c, 0x59, 0xc4, 0x75, 0xe1, 0x5e, 0x4d,
+    0x44, 0x8d, 0x02, 0xf8, 0xff, 0x9d, 0xbd, 0x73,
+    0xe9, 0x4b, 0x8a, 0x0f, 0x6f, 0x8f, 0x80, 0xb3,
+    0x8b, 0x1a, 0x64, 0xa2, 0xb6, 0x85, 0xc3, 0xa2,
+    0x9f, 0x52, 0x54, 0xfe, 0xba, 0x51, 0x09, 0x1c,
+    0x09, 0x5d, 0x64, 0x04, 0x99, 0xdd, 0xb9, 0xbd,
+    0x29, 0xb3, 0x3c, 0x7c, 0xae, 0x04, 0xa2, 0xe4,
+    0x6c, 0xf4, 0x8f, 0x1f, 0x5e, 0x09, 0x89, 0x3c,
+    0x56, 0xe6, 0x38, 0x64, 0x3d, 0x94, 0xab, 0x64,
+    0x87, 0x57, 0x0f, 0xf8, 0x47, 0xe4, 0x7a, 0x7f,
+    0x3c, 0x83, 0xbb, 0xb4, 0x05, 0x17, 0x5d, 0x0d,
+    0x80, 0x9e, 0x67, 0x50, 0x66, 0x49, 0x6f, 0x5d,
+    0x19, 0xc0, 0xac, 0x3d, 0xae, 0x87, 0x63, 0x4a,
+    0x73, 0x84, 0x20, 0xb4, 0x82, 0x98, 0x0e, 0x0b,
+    0xfd, 0x6d, 0x88, 0x09, 0x27, 0xe5, 0x36, 0x8e,
+    0xbe, 0x69, 0x87, 0x3b, 0xe0, 0x63, 0x1d, 0x97,
+    0xb1, 0xfa, 0xa3, 0x6b, 0xcc, 0x45, 0x00, 0xc5,
+    0x3e, 0x35, 0xf5, 0x6a, 0x0e, 0x7b, 0x50, 0xaf,
+    0x8d, 0x6c, 0xe2, 0x0e, 0xd9, 0x8d, 0x20, 0x55,
+    0x7d, 0x33, 0xc2, 0x59, 0x17, 0x70, 0x29, 0x7b,
+    0xda, 0x37, 0x36, 0xca, 0xa4, 0xdd, 0xec, 0x1d,
+    0x92, 0x4f, 0x90, 0x52, 0xbb, 0xae, 0x20, 0xef,
+    0xfa, 0x8e, 0xa1, 0x76, 0x95, 0x85, 0xc0, 0xdd,
+    0x24, 0x60, 0x24, 0x91, 0xea, 0x27, 0xdf, 0xbb,
+    0xb8, 0x93, 0x08, 0x65, 0xe4, 0x05, 0x7c, 0x36,
+    0x86, 0xbc, 0xb5, 0xab, 0x3e, 0x46, 0x09, 0x7f,
+    0x8c, 0x25, 0x66, 0xdf, 0x85, 0xf0, 0x9c, 0x08,
+    0x75, 0x75, 0x2b, 0x58, 0x12, 0x77, 0x6b, 0x49,
+    0xe7, 0xf6, 0xcc, 0x50, 0x64, 0x13, 0x30, 0xfe,
+    0xc1, 0xf3, 0x48, 0xab, 0x05, 0x9c, 0xed, 0xb5,
+    0x14, 0x1f, 0xea, 0x38, 0x83, 0xdc, 0x4f, 0xe4,
+    0xc6, 0x71, 0x3f, 0xaa, 0xb7, 0x21, 0x14, 0xa7,
+    0x34, 0x71, 0x62, 0x14, 0x9c, 0xbf, 0x86, 0xbf,
+    0xe7, 0x4c, 0xc6, 0x8a, 0x09, 0x4f, 0xf5, 0x67,
+    0x3b, 0x4f, 0x06, 0x26, 0x51, 0x18, 0xa6, 0xb3,
+    0xef, 0x2c, 0x11, 0xd0, 0x32, 0xd5, 0xdd, 0xc4,
+    0xdc, 0x94, 0x76, 0x07, 0x7a, 0xc5, 0x93, 0x35,
+    0xbb, 0x3b, 0xf6, 0x2d, 0xd0, 0x20, 0xf7, 0xd5,
+    0x0a, 0x1a, 0xac, 0xf0, 0xdb, 0xfa, 0x74, 0x18,
+    0x59, 0xd8, 0xbb, 0x88, 0xfc, 0x27, 0xa1, 0x7c,
+    0x17, 0x55, 0x63, 0xa8, 0x6f, 0xc4, 0xa6, 0x73,
+    0x76, 0x30, 0xe5, 0xcd, 0x8a, 0x8a, 0x1e, 0x17,
+    0xa2, 0x78, 0x90, 0x66, 0xe1, 0x99, 0xf0, 0x83,
+    0x10, 0x57, 0x16, 0x17, 0x83, 0xf5, 0x35, 0x55,
+    0xce, 0xf1, 0xa9, 0x4a, 0xb5, 0x7c, 0x5e, 0x3c,
+    0x0b, 0x3d, 0xe0, 0x29, 0x73, 0xfa, 0xe4, 0x10,
+    0x2f, 0xde, 0x32, 0x00, 0x31, 0x07, 0xec, 0x54,
+    0xf4, 0x8e, 0x4f, 0x8c, 0x82, 0xd5, 0x0a, 0xe8,
+    0xa3, 0x90, 0x9b, 0xdd, 0xa4, 0xb9, 0xb5, 0xec,
+    0x9c, 0xe8, 0xd2, 0xd9, 0xa2, 0xe4, 0x0f, 0x39,
+    0x2f, 0x22, 0xc3, 0x27, 0x62, 0x17, 0xa2, 0x4a,
+    0xd2, 0xdb, 0xcd, 0x89, 0xad, 0xe1, 0x5d, 0x2c,
+    0x99, 0x5f, 0xc6, 0x72, 0xa6, 0x2b, 0x1d, 0x7f,
+    0x7d, 0x66, 0x4d, 0x50, 0x62, 0xf5, 0x6c, 0x26,
+    0x03, 0x03, 0xc5, 0x65, 0x88, 0xf2, 0xb5, 0xe1,
+    0x88, 0x43, 0xc7, 0x7d, 0x26, 0xbc, 0x6f, 0xc0,
+    0x64, 0xaf, 0xbe, 0xa5, 0xd1, 0x9a, 0xfc, 0xc0,
+    0xec, 0xae, 0xd1, 0xfc, 0x82, 0x91, 0x83, 0x29,
+    0x67, 0x56, 0x16, 0x2c, 0x00, 0xb8, 0xb8, 0x7b,
+    0xdc, 0x06, 0x01, 0xba, 0xe1, 0x5c, 0x86, 0xf9,
+    0x2a, 0xfc, 0xb7, 0x0b, 0x79, 0x5a, 0xf5, 0x9e,
+    0x63, 0xc4, 0xa0, 0x52, 0x71, 0x8e, 0x39, 0xa0,
+    0x20, 0x24, 0xd0, 0x52, 0xab, 0x1a, 0x49, 0xbd,
+    0x6b, 0x8f, 0xae, 0x89, 0xcb, 0x86, 0xd4, 0x4c,
+    0x43, 0x09, 0x4a, 0xea, 0x76, 0xe7, 0x21, 0x25,
+    0x63, 0x28, 0xeb, 0x26, 0x4e, 0x47, 0x12, 0x00,
+    0x7d, 0x7d, 0xf9, 0x77, 0x85, 0x19, 0xe9, 0xaa,
+    0x5d, 0x08, 0xa3, 0x19, 0x3c, 0x4f, 0x9b, 0x79,
+    0x90, 0xec, 0x37, 0xcd, 0x9d, 0x24, 0xb0, 0xb3,
+    0x82, 0x4f, 0x1c, 0x58, 0x6d, 0xbb, 0x61, 0x72,
+    0xf7, 0xa3, 0xfb, 0x4d, 0x59, 0xb9, 0xae, 0xd5,
+    0xfa, 0xd8, 0xe7, 0x19, 0x39, 0xe6, 0x7b, 0x7b,
+    0x44, 0x84, 0xed, 0xc8, 0x9b, 0x28, 0xd1, 0xaf,
+    0x2c, 0x35, 0x1c, 0x95, 0x24, 0x1a, 0x04, 0x81,
+    0x27, 0xdc, 0x12, 0x91, 0x80, 0x1d, 0x39, 0xcf,
+    0x3f, 0xab, 0xa4, 0x53, 0xc3, 0x8d, 0x9f, 0x8e,
+    0x00, 0xea, 0x1d, 0x92, 0xe0, 0x72, 0xce, 0xd5,
+    0xae, 0xca, 0x25, 0x2a, 0x68, 0xea, 0x1b, 0x7a,
+    0x8b, 0x01, 0xd2, 0x25, 0xbe, 0xad, 0x00, 0xd9,
+    0xe3, 0xb2, 0xfc, 0xf3, 0xd3, 0xc2, 0x71, 0x46,
+    0x46, 0xb8, 0x20, 0x97, 0x19, 0xc5, 0x2e, 0xc0,
+    0x7e, 0x3d, 0x40, 0xe4, 0xe9, 0xc7, 0x0a, 0x59,
+    0x9b, 0x0a, 0x3c, 0xc0, 0xd0, 0x39, 0x99, 0x77,
+    0xf4, 0x86, 0xfc, 0x0e, 0x00, 0x49, 0x89, 0x1c,
+    0x62, 0xd5, 0xba, 0x6c, 0x92, 0x8f, 0x76, 0x0d,
+    0x0c, 0xcf, 0x4b, 0x2e, 0xb1, 0x83, 0x4d, 0x05,
+    0x88, 0x03, 0x11, 0xc7, 0xd4, 0x2b, 0xd1, 0x6f,
+    0xe3, 0xa8, 0x6e, 0xb1, 0xcc, 0x20, 0x47, 0xe3,
+    0xab, 0xea, 0xf1, 0xc4, 0xda, 0x5d, 0xae, 0x89,
+    0x03, 0x29, 0x0a, 0x89, 0xa5, 0x68, 0x2b, 0x32,
+    0x8d, 0xe7, 0xf3, 0x3a, 0xc7, 0xc8, 0x66, 0x17,
+    0xf8, 0x47, 0xe9, 0xfc, 0xbb, 0xa1, 0x29, 0x14,
+    0x9d, 0x35, 0xc7, 0x50, 0x0d, 0x35, 0xeb, 0xf4,
+    0x3b, 0xee, 0x9b, 0xa7, 0x25, 0x15, 0x2a, 0x50,
+    0x9b, 0xf4, 0x14, 0x45, 0xe7, 0x49, 0x53, 0x72,
+    0xa0, 0xa0, 0xd7, 0x7f, 0x77, 0x10, 0x1d, 0xb6,
+    0x55, 0xa1, 0x66, 0x9c, 0x63, 0xce, 0x98, 0xfb,
+    0xb6, 0xc9, 0x68, 0xc4, 0x0a, 0x92, 0xea, 0x41,
+    0xf0, 0x32, 0x64, 0x62, 0x7b, 0x9b, 0x4d, 0xf3,
+    0xb7, 0x81, 0x69, 0x5f, 0xa7, 0x9f, 0x13, 0x6c,
+    0x0c, 0x8b, 0xe5, 0x2c, 0xa3, 0x6a, 0x74, 0x92,
+    0xf0, 0x1e, 0xad, 0x1e, 0xf1, 0x7e, 0x2c, 0xae,
+    0xf9, 0x44, 0x3c, 0xdd, 0x48, 0x68, 0x6a, 0x75,
+    0xa5, 0x46, 0x4d, 0xbd, 0x13, 0xca, 0xe4, 0xe0,
+    0xa0, 0xbb, 0x34, 0x2f, 0x43, 0x82, 0x24, 0x50,
+    0x65, 0x0c, 0x8e, 0x03,
+};
+#endif
 #elif defined(MCUBOOT_SIGN_ED25519)
 #define HAVE_KEYS
 const unsigned char root_pub_der[] = {
@@ -133,6 +446,405 @@ const unsigned char root_pub_der[] = {
     0x20, 0xff, 0xb4, 0xe0,
 };
 const unsigned int root_pub_der_len = 44;
+const unsigned char root_pub_der_hash[] = {
+    0xc1, 0x90, 0x7f, 0xa4, 0xea, 0xc7, 0xfa, 0xe3,
+    0x84, 0x0a, 0x78, 0x90, 0x2b, 0x6f, 0x07, 0x10,
+    0xb0, 0x37, 0xe9, 0x96, 0x8e, 0x5c, 0x62, 0x74,
+    0xa1, 0x2a, 0x28, 0x79, 0x0c, 0x7d, 0x4e, 0x3c,
+};
+#if defined(MCUBOOT_ED25519_FIXED_BASE)
+/* Precomputed multiples of the key. */
+const unsigned char root_pub_der_table[] = {
+    0xd4, 0xb3, 0x1b, 0xa4, 0x9a, 0x3a, 0xdd, 0x3f,
+    0x82, 0x5d, 0x10, 0xca, 0x7f, 0x31, 0xb5, 0x0b,
+    0x0d, 0xe8, 0x7f, 0x37, 0xcc, 0xc4, 0x9f, 0x1a,
+    0x40, 0x3a, 0x5c, 0x13, 0x20, 0xff, 0xb4, 0xe0,
+    0x5e, 0x67, 0x88, 0x47, 0xc8, 0xcf, 0xf5, 0xb9,
+    0x20, 0xfc, 0x67, 0x8f, 0x52, 0xa3, 0xb3, 0x31,
+    0x1e, 0xb1, 0x12, 0x9f, 0xa2, 0x10, 0xd4, 0x80,
+    0x24, 0xac, 0x0b, 0xe3, 0xbf, 0xb5, 0xc3, 0x5d,
+    0x4a, 0x00, 0xaf, 0x00, 0x6d, 0xa5, 0xc4, 0xc5,
+    0xe3, 0xbe, 0xb8, 0x04, 0xad, 0xbf, 0xb6, 0xe5,
+    0xfb, 0x1e, 0xed, 0xcf, 0xf5, 0x78, 0x6b, 0xb4,
+    0x5b, 0xc8, 0xac, 0x43, 0x80, 0x48, 0xa6, 0x63,
+    0xbe, 0x71, 0x9c, 0x08, 0xd0, 0x10, 0xb3, 0x1f,
+    0xdb, 0xd0, 0x9d, 0xc0, 0xce, 0xbb, 0x58, 0x37,
+    0x35, 0xce, 0x5a, 0xd3, 0x4b, 0xdc, 0x22, 0xf8,
+    0xf5, 0x87, 0x27, 0xe9, 0xfa, 0x00, 0xcc, 0x2b,
+    0x48, 0x2b, 0x15, 0x72, 0x53, 0xcc, 0x4c, 0x37,
+    0xa3, 0x7e, 0x0c, 0x13, 0x42, 0x08, 0xac, 0x5b,
+    0x42, 0x3c, 0x99, 0x32, 0xab, 0x84, 0x98, 0x79,
+    0x03, 0x04, 0x44, 0x4d, 0xc2, 0xb9, 0xff, 0x4f,
+    0x40, 0x67, 0x82, 0x02, 0xc6, 0xaf, 0x4d, 0xc3,
+    0x70, 0x33, 0x13, 0x1e, 0x62, 0x2c, 0x4b, 0x59,
+    0x88, 0xf8, 0x99, 0x40, 0x45, 0x83, 0x73, 0xeb,
+    0x15, 0x0e, 0xb2, 0xf6, 0x85, 0x37, 0x25, 0x0f,
+    0x1d, 0x96, 0x2a, 0x39, 0xdd, 0x78, 0xd8, 0xf0,
+    0x35, 0x0f, 0xa4, 0xd4, 0x32, 0x1a, 0x1a, 0x08,
+    0x8a, 0x2c, 0x03, 0x61, 0x7f, 0x0f, 0x2d, 0xcf,
+    0x9f, 0x7d, 0xe0, 0xe8, 0x96, 0x3f, 0x22, 0x41,
+    0x25, 0x4b, 0x10, 0xb1, 0xf3, 0x1d, 0x94, 0x60,
+    0x14, 0x0a, 0x2b, 0xba, 0xd3, 0x94, 0xd9, 0x89,
+    0x53, 0x67, 0x26, 0x5d, 0x29, 0x81, 0x0d, 0x9a,
+    0xce, 0x7b, 0xdf, 0x70, 0x8a, 0x04, 0x5c, 0x06,
+    0x64, 0xb2, 0xc1, 0x00, 0xe6, 0x89, 0xdb, 0xf5,
+    0x05, 0xba, 0x38, 0xaa, 0xba, 0x76, 0x67, 0x21,
+    0x3c, 0x5c, 0xdd, 0x8b, 0xa0, 0xac, 0x7e, 0x34,
+    0x6b, 0xc9, 0xee, 0xa0, 0xfe, 0x60, 0xb5, 0x7f,
+    0x9d, 0x80, 0x8a, 0xb2, 0x04, 0xeb, 0xdd, 0x07,
+    0xf5, 0x4d, 0xb8, 0xe4, 0xd9, 0xd0, 0xd9, 0x2e,
+    0x74, 0x8c, 0x66, 0x73, 0x62, 0x7e, 0xee, 0xd6,
+    0x98, 0x84, 0x34, 0x41, 0xf9, 0xd5, 0x21, 0x2a,
+    0x48, 0x95, 0xf8, 0x22, 0x2e, 0xef, 0x08, 0x24,
+    0x89, 0x82, 0xdc, 0x53, 0xf9, 0x36, 0x77, 0xb5,
+    0x6d, 0x03, 0x5e, 0x07, 0x57, 0xdb, 0x9c, 0xed,
+    0x62, 0x6a, 0xee, 0xc9, 0xd2, 0xe4, 0x29, 0x1d,
+    0xd2, 0x26, 0xd3, 0xa5, 0x80, 0x70, 0xed, 0x08,
+    0xd3, 0x27, 0xe3, 0xee, 0x40, 0x17, 0x0d, 0x87,
+    0x5e, 0x61, 0x6f, 0xca, 0xe0, 0xd5, 0xc3, 0xab,
+    0x65, 0x83, 0xb5, 0x35, 0xba, 0x83, 0x8f, 0x7a,
+    0xb3, 0x07, 0xa4, 0xa5, 0xbb, 0x2e, 0x32, 0x75,
+    0xc0, 0x69, 0x45, 0xe5, 0x10, 0x0e, 0xe4, 0xde,
+    0x1d, 0x93, 0xd6, 0x23, 0x6b, 0x03, 0xcc, 0xa6,
+    0x29, 0x0c, 0xd8, 0xcb, 0x65, 0xc3, 0x1d, 0x04,
+    0x19, 0xc2, 0xeb, 0x89, 0xe4, 0x92, 0xe0, 0xa2,
+    0x5d, 0x40, 0x4d, 0x09, 0x7d, 0x0c, 0x92, 0x95,
+    0xe0, 0xe3, 0x63, 0xaa, 0x9a, 0x78, 0x78, 0x45,
+    0xa6, 0x14, 0x39, 0xf5, 0x80, 0xf6, 0xe8, 0x37,
+    0xbe, 0x24, 0x6a, 0x30, 0x07, 0x74, 0xce, 0xb1,
+    0xa3, 0xcf, 0x99, 0x31, 0x77, 0x09, 0x61, 0xd1,
+    0xd9, 0x54, 0xce, 0xa3, 0xdd, 0x7a, 0xa9, 0x41,
+    0xf0, 0x0e, 0x0b, 0xc7, 0x5e, 0xcd, 0xae, 0x66,
+    0xac, 0x45, 0x97, 0x24, 0x1a, 0xcf, 0x06, 0xfd,
+    0x87, 0x05, 0x3a, 0xac, 0x23, 0x1c, 0xe0, 0x82,
+    0xec, 0x2f, 0x7e, 0x84, 0x49, 0x5d, 0xb2, 0x78,
+    0x8f, 0x37, 0x83, 0xd6, 0x3e, 0xd5, 0x1a, 0x78,
+    0x72, 0x43, 0xd0, 0x33, 0x6a, 0x55, 0x8f, 0xe2,
+    0x83, 0xea, 0x27, 0x83, 0x44, 0x0c, 0x65, 0xfc,
+    0x29, 0xa4, 0x57, 0x61, 0xa0, 0xc9, 0x64, 0x80,
+    0x9f, 0x41, 0x0d, 0xc2, 0xea, 0x93, 0xf9, 0x1f,
+    0xee, 0xa1, 0x95, 0x7e, 0x35, 0x5a, 0x9a, 0xfd,
+    0x3f, 0xd3, 0xf6, 0xf2, 0xe1, 0x97, 0xee, 0xb6,
+    0x0a, 0xad, 0xf3, 0xa6, 0xbc, 0xd2, 0x6b, 0x5f,
+    0x5a, 0xcf, 0xf2, 0x07, 0x16, 0x29, 0x4b, 0x5b,
+    0x00, 0x11, 0x0e, 0xab, 0x1e, 0xbc, 0x8c, 0x2d,
+    0x79, 0x5e, 0x09, 0x80, 0x9f, 0xd3, 0x8e, 0x3c,
+    0x8f, 0x5b, 0x3c, 0x52, 0xc8, 0x30, 0xff, 0xbb,
+    0xde, 0xb4, 0x30, 0x7c, 0xdd, 0xf0, 0xdd, 0x04,
+    0x75, 0xa1, 0xba, 0xae, 0x0e, 0xb9, 0xbf, 0x23,
+    0x57, 0x62, 0x1d, 0x59, 0xbf, 0x4a, 0x61, 0x16,
+    0x6a, 0xed, 0x87, 0x36, 0x5b, 0xbb, 0xa6, 0x5e,
+    0x13, 0xaa, 0xc2, 0x01, 0x84, 0x9d, 0x90, 0x0c,
+    0x22, 0x5e, 0xf4, 0x10, 0x33, 0x40, 0x80, 0xe3,
+    0x35, 0xcb, 0x67, 0x57, 0xf4, 0xb8, 0xfb, 0x90,
+    0xc0, 0xf9, 0xc1, 0x46, 0xd2, 0x77, 0x78, 0xeb,
+    0xa4, 0x7e, 0x4a, 0xa8, 0x9a, 0xad, 0xbf, 0x5d,
+    0x69, 0x4f, 0xae, 0x77, 0xd4, 0xb1, 0xf7, 0xd5,
+    0x60, 0xe7, 0x4e, 0x3d, 0xe8, 0x84, 0x48, 0xe0,
+    0x95, 0x61, 0xa9, 0x2d, 0x76, 0x53, 0xd9, 0x02,
+    0x6a, 0x9f, 0xa5, 0x50, 0xa3, 0x91, 0x28, 0x54,
+    0xbf, 0x19, 0x77, 0x4d, 0x01, 0xe1, 0x83, 0xed,
+    0x3a, 0x44, 0xb5, 0x0c, 0xc5, 0xd5, 0xa5, 0xb3,
+    0xd6, 0x53, 0x7d, 0x49, 0xfc, 0x48, 0x9a, 0x68,
+    0x7e, 0xe4, 0xa0, 0x95, 0x7e, 0xb3, 0xf9, 0x3a,
+    0xdd, 0x79, 0x7e, 0x6c, 0x2d, 0x7d, 0xe2, 0xf2,
+    0x26, 0x82, 0x9d, 0x01, 0x6b, 0x3b, 0xb0, 0x81,
+    0xda, 0xa9, 0x18, 0xf2, 0xfb, 0x0e, 0x69, 0x95,
+    0xd3, 0x94, 0x66, 0x01, 0x14, 0xbe, 0xc9, 0x5e,
+    0x8f, 0xd9, 0x4c, 0xeb, 0xb3, 0x07, 0x2b, 0xd2,
+    0x80, 0x10, 0x31, 0x46, 0x3f, 0x51, 0x2e, 0xce,
+    0xed, 0xa1, 0x00, 0x3b, 0x47, 0xbd, 0xb2, 0x58,
+    0x47, 0xa7, 0xf2, 0xd9, 0x6c, 0x9e, 0xad, 0x3c,
+    0xf0, 0x13, 0x26, 0x14, 0xcb, 0x97, 0xd1, 0x58,
+    0x2e, 0x92, 0x5f, 0x96, 0x79, 0x9c, 0xac, 0x14,
+    0xbe, 0x06, 0xff, 0x92, 0x29, 0x63, 0x76, 0x84,
+    0xaa, 0x39, 0x9f, 0x5e, 0xd2, 0x22, 0xb8, 0x05,
+    0xa4, 0x97, 0xdf, 0xb5, 0xc9, 0x85, 0xb6, 0xaa,
+    0x6e, 0xb5, 0x56, 0x2c, 0xa5, 0x6e, 0x22, 0x0c,
+    0xc4, 0xf4, 0xab, 0x27, 0x63, 0x64, 0xed, 0xbc,
+    0xa7, 0x3a, 0x95, 0x14, 0xb5, 0x94, 0x7a, 0x06,
+    0x54, 0xb8, 0xe0, 0x86, 0x16, 0x2e, 0xca, 0x3c,
+    0xab, 0x14, 0x8c, 0x9c, 0x60, 0x96, 0x8e, 0x7b,
+    0x71, 0xd2, 0x1c, 0x7d, 0x67, 0xc7, 0x31, 0x1c,
+    0xe2, 0x59, 0xf7, 0xdc, 0x90, 0xa6, 0x67, 0x0d,
+    0xc8, 0xd1, 0x3e, 0x1a, 0x2d, 0xbc, 0xd0, 0x3f,
+    0x96, 0x1c, 0xc0, 0x7f, 0xf0, 0x00, 0x7b, 0x1a,
+    0x60, 0x65, 0x23, 0x6c, 0x38, 0xe3, 0x3a, 0xbf,
+    0xc1, 0x8b, 0xfd, 0x41, 0x2c, 0xe1, 0xc8, 0x10,
+    0xd5, 0xbc, 0xec, 0x8b, 0xdb, 0x0b, 0xf9, 0xbb,
+    0xdd, 0x42, 0x3c, 0x5c, 0x4c, 0xd5, 0xee, 0xcf,
+    0xe2, 0x18, 0x6f, 0x50, 0xe7, 0x9b, 0x38, 0xe5,
+    0x70, 0xb1, 0xa7, 0x6f, 0x37, 0xb7, 0x59, 0x1a,
+    0x9e, 0x74, 0x03, 0xd3, 0x6b, 0x1c, 0xfa, 0xe5,
+    0xd2, 0x77, 0xc4, 0x18, 0x46, 0x2f, 0xae, 0xcd,
+    0xce, 0x2f, 0xd4, 0xbd, 0xdc, 0xa0, 0x2c, 0x76,
+    0x25, 0xd1, 0x4b, 0x49, 0x85, 0x5c, 0xba, 0x54,
+    0x4d, 0xd6, 0xbb, 0x92, 0x9c, 0x8d, 0xc9, 0x05,
+    0x20, 0xab, 0xaf, 0xb6, 0x69, 0x0a, 0x4a, 0xeb,
+    0x96, 0xbe, 0xad, 0x57, 0x03, 0x24, 0x39, 0x55,
+    0xfd, 0x12, 0xe2, 0xa2, 0xbb, 0xaf, 0xfd, 0x39,
+    0x93, 0xac, 0x1c, 0xa5, 0x8f, 0x8f, 0x02, 0x95,
+    0x91, 0xda, 0x11, 0x2c, 0xd7, 0x93, 0xd2, 0x7f,
+    0x10, 0xe4, 0xb0, 0x7d, 0x2e, 0x5a, 0xfe, 0x96,
+    0x12, 0x29, 0xaa, 0xc1, 0x13, 0x89, 0xef, 0x0c,
+    0x00, 0xf8, 0x3e, 0x82, 0x9b, 0xef, 0xca, 0x87,
+    0x14, 0x49, 0x2e, 0x07, 0x67, 0x3b, 0x84, 0x7a,
+    0x9d, 0xf2, 0xfe, 0xaf, 0xcf, 0x18, 0xee, 0x23,
+    0x97, 0xe3, 0xb8, 0x76, 0x3a, 0x68, 0xbd, 0x43,
+    0xb1, 0xe6, 0xa3, 0x77, 0x91, 0x37, 0x9d, 0xe9,
+    0x2a, 0xe3, 0x19, 0xde, 0x90, 0xa2, 0x3c, 0xfb,
+    0xc8, 0xbb, 0x64, 0x68, 0x9c, 0xc0, 0x0a, 0x24,
+    0xf4, 0x50, 0xb2, 0xb1, 0x11, 0x79, 0xf2, 0x4c,
+    0xd2, 0x16, 0x64, 0x4f, 0xed, 0xe6, 0x7c, 0x73,
+    0xa9, 0x4e, 0x5e, 0x8e, 0x3d, 0x63, 0xec, 0xac,
+    0x20, 0x0d, 0x8b, 0x8c, 0x57, 0x5b, 0x56, 0xf0,
+    0xb2, 0xdd, 0x35, 0xa6, 0xca, 0x4a, 0xe0, 0x03,
+    0x95, 0x82, 0x14, 0xa0, 0x6e, 0x92, 0x12, 0x48,
+    0xf2, 0xe1, 0x78, 0xfa, 0x07, 0xec, 0x3e, 0x97,
+    0xc0, 0x50, 0xf2, 0xdf, 0x15, 0xc0, 0x13, 0x10,
+    0x18, 0x45, 0x46, 0x47, 0x9e, 0xde, 0x87, 0x4b,
+    0xd1, 0x74, 0x75, 0x37, 0x52, 0xaa, 0x98, 0x9c,
+    0x74, 0xac, 0x7f, 0x68, 0x05, 0xf7, 0x1e, 0x5d,
+    0xcc, 0x72, 0x1d, 0xed, 0x36, 0x61, 0x87, 0x34,
+    0x0d, 0x27, 0x20, 0xba, 0xa0, 0x4d, 0x97, 0x43,
+    0x6e, 0xc5, 0x1a, 0xe9, 0x71, 0x05, 0x00, 0x22,
+    0x58, 0x87, 0x07, 0x11, 0x05, 0x38, 0x86, 0x5a,
+    0x92, 0xd9, 0x39, 0x20, 0x79, 0x57, 0xf0, 0xd6,
+    0xce, 0xb2, 0xf0, 0x6c, 0x9a, 0x02, 0xbf, 0x52,
+    0xb0, 0xe7, 0x66, 0x0b, 0x8b, 0x78, 0x1b, 0x23,
+    0x89, 0x8b, 0x65, 0xf8, 0x44, 0xbe, 0x4f, 0x6f,
+    0x3a, 0xf1, 0x65, 0x85, 0xc5, 0x18, 0xe7, 0xdc,
+    0x83, 0xd0, 0x24, 0xda, 0xdf, 0x46, 0x4d, 0x19,
+    0xec, 0x0c, 0x25, 0x70, 0x7e, 0x52, 0xcd, 0xeb,
+    0x16, 0xb2, 0x7a, 0x6d, 0x8d, 0x61, 0xc1, 0x46,
+    0x01, 0xef, 0xe5, 0x1a, 0xf0, 0xae, 0xe1, 0xd6,
+    0xc8, 0x8c, 0x7e, 0x65, 0xe1, 0xe6, 0x0c, 0x2a,
+    0xb5, 0x19, 0xa1, 0x02, 0x21, 0xe2, 0x93, 0x71,
+    0xec, 0xc7, 0xb4, 0xe2, 0xe8, 0x0e, 0xe3, 0xfe,
+    0x6d, 0x5f, 0x36, 0xa9, 0x7c, 0x1e, 0x5a, 0x19,
+    0xe4, 0x6b, 0xb5, 0x2a, 0x42, 0x18, 0x69, 0x6d,
+    0xb7, 0x50, 0x64, 0x36, 0x73, 0x18, 0x0b, 0xac,
+    0x9c, 0x26, 0x41, 0x08, 0x65, 0x98, 0x58, 0x52,
+    0x45, 0xe6, 0x71, 0x8d, 0xef, 0x80, 0x03, 0x2f,
+    0x32, 0x62, 0x64, 0xac, 0x25, 0xc4, 0xc0, 0x2a,
+    0xd2, 0xa0, 0xdb, 0xc8, 0x24, 0x50, 0xeb, 0x75,
+    0x79, 0x74, 0x7f, 0x34, 0x9f, 0xcf, 0x05, 0xc1,
+    0x74, 0x89, 0x2b, 0xa8, 0x7b, 0x29, 0x15, 0x98,
+    0xb2, 0x88, 0x74, 0x7a, 0x03, 0x2f, 0xf4, 0x00,
+    0x57, 0x3c, 0xc0, 0x4e, 0xdd, 0x1d, 0x3d, 0x7f,
+    0x5f, 0x7c, 0x7f, 0xc3, 0x9b, 0x42, 0x38, 0xb7,
+    0xd7, 0x3d, 0xfe, 0xf3, 0x4a, 0x49, 0xeb, 0x65,
+    0x99, 0x1a, 0x02, 0x9b, 0xe4, 0xf9, 0x9c, 0x25,
+    0x8f, 0xfd, 0x8b, 0xb0, 0x88, 0x7d, 0x6f, 0x6a,
+    0x1e, 0xba, 0x46, 0xb0, 0xe7, 0x77, 0x63, 0x9b,
+    0x45, 0x53, 0x8a, 0xe9, 0x38, 0xeb, 0xb8, 0xba,
+    0xe9, 0x9e, 0x26, 0xc9, 0xa5, 0xe9, 0x4c, 0x51,
+    0x53, 0xb1, 0x06, 0x1b, 0xfe, 0x83, 0x36, 0xd0,
+    0x95, 0xdc, 0xb7, 0xb6, 0x40, 0x06, 0x74, 0xec,
+    0x0b, 0xa1, 0xc9, 0x52, 0xe0, 0x1d, 0xfd, 0x4d,
+    0xb4, 0xab, 0xb0, 0x89, 0xe9, 0xf6, 0x30, 0x7b,
+    0xe4, 0x2c, 0x1a, 0xd6, 0x60, 0x6e, 0x4c, 0xb5,
+    0x3c, 0xa8, 0x91, 0x91, 0xeb, 0x33, 0xce, 0x01,
+    0x1d, 0x56, 0x0f, 0x10, 0xc6, 0x59, 0xd8, 0xdb,
+    0xd3, 0x94, 0x3d, 0x0b, 0xbe, 0xb3, 0x7c, 0x3b,
+    0x08, 0x1c, 0x3b, 0x07, 0x19, 0x8e, 0x67, 0x5a,
+    0x61, 0x9f, 0xae, 0x90, 0xbc, 0x74, 0xe4, 0x13,
+    0xf8, 0x65, 0x28, 0xa6, 0xb3, 0xcf, 0xbf, 0x1b,
+    0xb6, 0x02, 0x66, 0x5b, 0xf2, 0x82, 0xf1, 0x11,
+    0xbe, 0x7e, 0xdb, 0xdb, 0x98, 0x09, 0x0c, 0x45,
+    0xf9, 0xf6, 0x65, 0x85, 0x7c, 0x65, 0x81, 0xa0,
+    0x65, 0xb0, 0xa1, 0x5e, 0x2c, 0x62, 0xdc, 0xd6,
+    0xa9, 0x56, 0xb3, 0x90, 0x5c, 0xf1, 0x10, 0x41,
+    0xdd, 0x3c, 0x9e, 0x67, 0xed, 0x59, 0x20, 0x70,
+    0xce, 0x3f, 0xac, 0xeb, 0xa0, 0xaf, 0x9f, 0x13,
+    0xbf, 0xdf, 0x09, 0x1d, 0x0c, 0x6d, 0xef, 0xe8,
+    0xe9, 0xd9, 0xb7, 0x0b, 0x45, 0x2b, 0x8d, 0x4e,
+    0x27, 0x33, 0x19, 0x14, 0x14, 0x74, 0x07, 0xf8,
+    0x25, 0x67, 0xc3, 0x5b, 0xc7, 0x77, 0x67, 0xca,
+    0xec, 0x05, 0xa2, 0x38, 0x83, 0xa8, 0x3d, 0xa8,
+    0x2b, 0x5a, 0x4c, 0xcb, 0xc9, 0x96, 0x55, 0x7d,
+    0xf9, 0x3b, 0x52, 0x56, 0xe9, 0x81, 0x5e, 0xad,
+    0x5c, 0x89, 0x84, 0xbf, 0x08, 0x75, 0xb0, 0xee,
+    0xb7, 0xf9, 0x3b, 0x3f, 0xa3, 0xd9, 0xbf, 0xcb,
+    0x47, 0xfc, 0x85, 0x43, 0xa8, 0xc2, 0x65, 0x5a,
+    0x2a, 0x58, 0x5a, 0xa2, 0x97, 0xba, 0xf7, 0xd1,
+    0xea, 0xb7, 0xc5, 0xe0, 0xa5, 0xe2, 0x51, 0x5b,
+    0x01, 0x3d, 0xcb, 0x36, 0x50, 0x8b, 0x30, 0xf9,
+    0x40, 0xa1, 0x2d, 0x62, 0x70, 0xee, 0x84, 0x42,
+    0x1a, 0xb1, 0xc8, 0xe9, 0x34, 0xf9, 0xe5, 0xd6,
+    0xb9, 0x3c, 0xd2, 0x7d, 0xb4, 0xfc, 0x5d, 0x47,
+    0xad, 0x57, 0xa8, 0x0f, 0xd3, 0x40, 0xb5, 0x09,
+    0x1f, 0xf3, 0xbe, 0x0b, 0x83, 0xd0, 0x6f, 0x3c,
+    0xa0, 0x8d, 0xcc, 0x59, 0x08, 0x35, 0xfc, 0x7f,
+    0x29, 0x58, 0xd1, 0x0f, 0x7e, 0x8c, 0x02, 0xe0,
+    0xef, 0x54, 0x28, 0xfa, 0xbf, 0x5b, 0xa1, 0xa7,
+    0x3e, 0x2b, 0x4b, 0x14, 0x43, 0xbc, 0x85, 0x2b,
+    0xac, 0x1c, 0x18, 0xf0, 0x10, 0xd5, 0xcd, 0x60,
+    0xc5, 0xb5, 0xbc, 0xca, 0x00, 0xa1, 0x5e, 0xed,
+    0xf8, 0x6b, 0xc0, 0xf2, 0xfe, 0x2b, 0x2f, 0x83,
+    0xd6, 0x53, 0x95, 0x78, 0xfe, 0x2e, 0x71, 0x40,
+    0x92, 0xe6, 0xa9, 0xe5, 0x1c, 0xd1, 0xbd, 0xdc,
+    0xc3, 0x58, 0xc3, 0x6f, 0xb8, 0x1a, 0x79, 0xf9,
+    0x71, 0xa1, 0x1d, 0xfd, 0x32, 0x7d, 0x9c, 0x91,
+    0x1a, 0xf3, 0x8c, 0xd2, 0xb8, 0xae, 0x2f, 0x1a,
+    0x4e, 0xaa, 0xdb, 0x1f, 0xd0, 0x3c, 0xf0, 0xf7,
+    0x86, 0x9e, 0x1a, 0x6f, 0xdc, 0x51, 0x49, 0xd8,
+    0x79, 0xcd, 0xc8, 0x3e, 0x2c, 0xb5, 0x7e, 0x42,
+    0xc8, 0xea, 0x6a, 0x54, 0xba, 0x57, 0x53, 0x74,
+    0x0f, 0x09, 0x55, 0xd4, 0xa1, 0x5a, 0x64, 0x6c,
+    0xc7, 0x09, 0x4e, 0x72, 0x3c, 0xec, 0xf1, 0x87,
+    0xde, 0x60, 0x08, 0xf8, 0x07, 0x35, 0x5f, 0xa0,
+    0x2b, 0x97, 0x6f, 0x32, 0xb5, 0x0d, 0xb0, 0x48,
+    0xd4, 0x2c, 0x39, 0xd7, 0x4b, 0x2a, 0x42, 0x47,
+    0x64, 0x42, 0x35, 0x42, 0x82, 0x0f, 0x56, 0xf6,
+    0x0e, 0x44, 0xfb, 0x79, 0xe1, 0x74, 0xf7, 0x86,
+    0x28, 0x00, 0x89, 0x6d, 0x61, 0x3e, 0xf5, 0x50,
+    0xaa, 0x9c, 0x63, 0xe2, 0x4f, 0xcf, 0xe8, 0xf6,
+    0x35, 0x31, 0x32, 0x4e, 0x07, 0x38, 0x7e, 0xbb,
+    0x69, 0xc9, 0x01, 0xf9, 0x34, 0xa9, 0x97, 0x39,
+    0xbf, 0xe6, 0x3f, 0x5f, 0x4d, 0x1c, 0xc5, 0x3f,
+    0x69, 0x25, 0xb2, 0xa1, 0x3c, 0x42, 0x10, 0x2c,
+    0xa6, 0x3e, 0x0c, 0x81, 0x87, 0x4d, 0x81, 0x8e,
+    0x5e, 0xce, 0x99, 0x45, 0xd6, 0x75, 0xe8, 0x5d,
+    0x8f, 0x23, 0x39, 0x1d, 0xb9, 0x1a, 0x3c, 0x32,
+    0x7f, 0x34, 0x8c, 0x99, 0x60, 0xf4, 0xb3, 0x24,
+    0x77, 0x28, 0x46, 0xf7, 0x3b, 0x60, 0x44, 0x5f,
+    0x41, 0x97, 0x10, 0x3e, 0xf5, 0xe5, 0x3c, 0x36,
+    0x0a, 0xa0, 0xce, 0x5a, 0xdb, 0xc2, 0x81, 0x0c,
+    0x27, 0xfb, 0x3e, 0x6e, 0x6a, 0x81, 0x96, 0x41,
+    0x03, 0x7e, 0xc2, 0xbe, 0xc2, 0x2d, 0x6b, 0x43,
+    0x37, 0x42, 0x9e, 0x3d, 0x2a, 0x1a, 0x9f, 0x0d,
+    0xfb, 0x44, 0x2b, 0xdf, 0xf6, 0xba, 0xed, 0x66,
+    0xf9, 0x48, 0x96, 0x4e, 0x7e, 0x13, 0x2f, 0xdc,
+    0xda, 0x10, 0xcd, 0x6a, 0xbc, 0xdd, 0xe3, 0x70,
+    0x3f, 0x4a, 0xcd, 0x2e, 0x83, 0x2d, 0x11, 0x96,
+    0xcc, 0xf0, 0x5b, 0x48, 0x13, 0x7a, 0xf9, 0x2f,
+    0x23, 0xc6, 0x4f, 0x81, 0xfb, 0xe6, 0x59, 0xa5,
+    0xab, 0xa4, 0x49, 0xdf, 0xab, 0xdf, 0xa2, 0xf9,
+    0x8b, 0x84, 0x6b, 0x0c, 0x18, 0xa0, 0xa8, 0x6b,
+    0xa2, 0x9c, 0x32, 0xed, 0xfc, 0xdb, 0xee, 0x76,
+    0x56, 0xaf, 0x51, 0x13, 0x25, 0x48, 0x24, 0x73,
+    0x18, 0x38, 0x03, 0xa3, 0x7a, 0xb5, 0x8c, 0x4b,
+    0x92, 0x4a, 0x74, 0xf6, 0xc9, 0x4e, 0x58, 0xf0,
+    0xea, 0xa0, 0x66, 0xae, 0x52, 0x72, 0xc9, 0x70,
+    0x30, 0xd8, 0xd7, 0x0a, 0x81, 0x40, 0x5b, 0x7c,
+    0x9c, 0x55, 0x06, 0x75, 0x77, 0x6c, 0x8b, 0x0d,
+    0xe0, 0x0a, 0x75, 0xfe, 0xc6, 0x63, 0x90, 0xef,
+    0x16, 0x0f, 0x53, 0x56, 0xc1, 0x00, 0xd7, 0x5e,
+    0x1d, 0xc0, 0x4b, 0xbc, 0xa3, 0xe1, 0x3e, 0x3d,
+    0x86, 0x76, 0x01, 0x87, 0x29, 0x64, 0xdc, 0x87,
+    0x9c, 0xf2, 0x2b, 0xba, 0xc8, 0x79, 0x80, 0x79,
+    0x83, 0x8c, 0x6f, 0x54, 0x28, 0x40, 0xb2, 0x68,
+    0x7d, 0xc7, 0xfc, 0x10, 0xe9, 0x2e, 0x0f, 0xce,
+    0xd9, 0x66, 0x33, 0xfa, 0x1f, 0x58, 0x5b, 0xcd,
+    0x87, 0xcf, 0xfa, 0xa5, 0x98, 0x9a, 0x3d, 0x61,
+    0x56, 0x8c, 0x4f, 0x6c, 0x0a, 0x1e, 0x6c, 0x72,
+    0xae, 0x07, 0xff, 0x23, 0xdd, 0x0c, 0x66, 0x8c,
+    0x41, 0xdb, 0x9d, 0x13, 0x4f, 0x9c, 0x30, 0x50,
+    0xc5, 0x77, 0x40, 0xbf, 0x05, 0x7a, 0x1f, 0x93,
+    0x76, 0x79, 0xa9, 0x8b, 0x36, 0x84, 0x7d, 0x04,
+    0xb0, 0x4a, 0xa1, 0xf6, 0x81, 0xc6, 0x8d, 0x9c,
+    0x85, 0xf2, 0x35, 0x44, 0x68, 0x4b, 0x90, 0x9d,
+    0x5a, 0xfe, 0xab, 0x6d, 0x30, 0xf0, 0x44, 0xa8,
+    0xb9, 0x06, 0xed, 0x53, 0xd4, 0x67, 0x2a, 0x57,
+    0xa4, 0xc9, 0x5e, 0x3d, 0xe7, 0xff, 0x8d, 0xdd,
+    0x55, 0x9d, 0x13, 0xc1, 0xc9, 0x4b, 0x4b, 0xae,
+    0xe8, 0x73, 0x68, 0x47, 0x9f, 0x1e, 0x04, 0x8d,
+    0x91, 0x15, 0x82, 0xb4, 0x24, 0x80, 0x2b, 0x01,
+    0xe2, 0xff, 0xda, 0xbd, 0x00, 0xfb, 0xd6, 0xf4,
+    0x40, 0xd4, 0xfb, 0x30, 0x73, 0xb9, 0x9f, 0xcc,
+    0x5b, 0x7b, 0x64, 0xa6, 0xd8, 0x0c, 0x72, 0x7e,
+    0x84, 0x43, 0xc0, 0xd4, 0xac, 0xd2, 0x99, 0x3b,
+    0x08, 0xd2, 0x68, 0xe0, 0xf3, 0xb4, 0x03, 0x41,
+    0xbc, 0xb9, 0x69, 0x1c, 0x15, 0x62, 0x6d, 0x20,
+    0xe7, 0xdd, 0x63, 0x82, 0x02, 0x93, 0x59, 0xea,
+    0xd2, 0x06, 0xb4, 0x15, 0x5e, 0x53, 0x94, 0x35,
+    0x54, 0xc2, 0x1a, 0x58, 0x52, 0xf5, 0x72, 0xcd,
+    0x9f, 0xe4, 0xfa, 0x0e, 0x27, 0x5e, 0xa9, 0x3e,
+    0x42, 0xea, 0x54, 0x27, 0x23, 0x3e, 0x72, 0x03,
+    0x1b, 0x08, 0x66, 0x88, 0xf1, 0x51, 0xbd, 0x35,
+    0xea, 0x55, 0xf5, 0x17, 0xa5, 0x38, 0xea, 0x39,
+    0x67, 0xb2, 0x38, 0x78, 0x82, 0xc2, 0x1d, 0x38,
+    0x67, 0xa9, 0x9b, 0x71, 0xe4, 0x20, 0x8e, 0xb5,
+    0x59, 0x3a, 0x53, 0x67, 0x64, 0xf6, 0x2e, 0x2a,
+    0x0d, 0x1f, 0x37, 0xe6, 0xe8, 0x2b, 0x37, 0x4d,
+    0x1b, 0xbf, 0xc9, 0x92, 0x7b, 0xaf, 0x17, 0x2b,
+    0xcc, 0x5a, 0xbe, 0x92, 0x60, 0x3a, 0x39, 0xbe,
+    0xd5, 0xf0, 0x0c, 0x60, 0xc0, 0x37, 0x78, 0x5f,
+    0xdb, 0x04, 0x3c, 0xfe, 0xe9, 0x13, 0x9a, 0x77,
+    0xf5, 0x3b, 0xe9, 0xfb, 0xe9, 0xd7, 0xec, 0x7d,
+    0x69, 0x78, 0x04, 0xc9, 0xf5, 0x15, 0xa3, 0xc5,
+    0xfb, 0xdc, 0x18, 0x23, 0x75, 0x3e, 0x2a, 0x42,
+    0x2e, 0x54, 0x02, 0x8e, 0x9f, 0x48, 0xb3, 0xc5,
+    0xa4, 0xec, 0x4b, 0x81, 0x8a, 0x2c, 0x6c, 0x79,
+    0xd0, 0xa8, 0xcc, 0xb7, 0xb6, 0xfd, 0x23, 0x74,
+    0xf2, 0x60, 0x10, 0xfd, 0x63, 0xe9, 0x75, 0x6a,
+    0x35, 0xd2, 0xec, 0x7c, 0x21, 0xab, 0x83, 0x54,
+    0x7c, 0x2c, 0xdf, 0x20, 0x81, 0x0a, 0x6c, 0x55,
+    0x18, 0x9d, 0xd3, 0xf0, 0x8d, 0xc1, 0xd5, 0x6a,
+    0x5b, 0xa6, 0x48, 0x4b, 0x8a, 0xa2, 0xbe, 0x5f,
+    0x27, 0xdb, 0xd6, 0xac, 0xea, 0xfa, 0x87, 0x15,
+    0x9b, 0xd9, 0x9a, 0xa7, 0xf7, 0x19, 0x9f, 0x26,
+    0xb9, 0x39, 0xf7, 0xfc, 0x96, 0x4e, 0xdd, 0x21,
+    0xb9, 0x1a, 0x0c, 0xa0, 0xfb, 0x0c, 0xd0, 0x22,
+    0xc6, 0x67, 0xfd, 0xa6, 0x16, 0xe8, 0xfd, 0x31,
+    0xe8, 0x6c, 0x9c, 0x86, 0xee, 0x4c, 0xb9, 0x80,
+    0x0f, 0xf6, 0x6d, 0xe7, 0x17, 0x31, 0x63, 0x96,
+    0xac, 0x66, 0x96, 0x1e, 0x53, 0x84, 0xca, 0x57,
+    0xcb, 0x8f, 0xe0, 0x41, 0xce, 0xee, 0xd0, 0x3e,
+    0x93, 0xa3, 0x3e, 0x1d, 0xbf, 0xf1, 0x83, 0x81,
+    0xf5, 0x48, 0x66, 0x39, 0xc3, 0x81, 0x08, 0x8a,
+    0x3e, 0x3e, 0xf4, 0xc5, 0x25, 0x4d, 0x0f, 0x5e,
+    0x3c, 0x7c, 0xbe, 0xff, 0xfa, 0x82, 0xfc, 0xd9,
+    0x94, 0x86, 0xd7, 0xcd, 0xd6, 0x37, 0x35, 0x8a,
+    0xf4, 0xe1, 0x64, 0x63, 0xbb, 0x22, 0xed, 0x3d,
+    0x31, 0xe2, 0xc6, 0x76, 0xba, 0x1b, 0x28, 0x3b,
+    0xd4, 0xd0, 0x0c, 0x14, 0xbc, 0x8f, 0x24, 0xbf,
+    0x59, 0x44, 0x99, 0x35, 0x02, 0x03, 0x19, 0xc8,
+    0x7d, 0x1b, 0x5f, 0xb2, 0x2b, 0x6e, 0xf9, 0xc1,
+    0x4e, 0xad, 0x82, 0x7a, 0xad, 0x4f, 0x62, 0x32,
+    0x4d, 0x6c, 0x5f, 0x58, 0x72, 0x95, 0xc9, 0xdc,
+    0x86, 0xd6, 0x3e, 0x5d, 0x73, 0x66, 0xba, 0xaa,
+    0x08, 0x3c, 0x04, 0xf9, 0xb0, 0x83, 0xb9, 0xad,
+    0x4e, 0xee, 0xde, 0xac, 0xb5, 0x75, 0xdc, 0x71,
+    0x9b, 0xfe, 0xaa, 0x4e, 0x11, 0x6a, 0x01, 0xc9,
+    0x70, 0x44, 0xa1, 0x5a, 0x64, 0xa2, 0xaa, 0xc3,
+    0x92, 0x7a, 0xe7, 0x0b, 0x2b, 0xd5, 0x63, 0x99,
+    0x00, 0x24, 0xd6, 0xeb, 0x2a, 0xff, 0x2a, 0x53,
+    0x9b, 0x4d, 0x5d, 0x1a, 0xcc, 0x4f, 0xdf, 0xdb,
+    0x5a, 0xb9, 0x13, 0xa2, 0x95, 0xec, 0x4c, 0x98,
+    0x2f, 0x59, 0x92, 0x03, 0x2b, 0x5b, 0xbc, 0x44,
+    0x4c, 0xd1, 0x6c, 0xe2, 0xe0, 0xae, 0x10, 0x05,
+    0xad, 0xc2, 0xd7, 0x6e, 0x73, 0x20, 0x92, 0xd2,
+    0xf0, 0x11, 0x5b, 0xc9, 0x3d, 0x34, 0x62, 0x77,
+    0xd8, 0xf0, 0x9a, 0x6f, 0xc2, 0x8e, 0x6f, 0x3f,
+    0x75, 0x4f, 0x34, 0xa7, 0xbc, 0x4f, 0xc2, 0x03,
+    0x07, 0x05, 0x6f, 0x0e, 0xd1, 0x26, 0xe7, 0xe2,
+    0x6b, 0x79, 0x94, 0x1a, 0x09, 0x59, 0x80, 0x4f,
+    0x01, 0x83, 0x89, 0x83, 0x91, 0xb8, 0x33, 0x15,
+    0xdc, 0x46, 0x9d, 0x3c, 0xbf, 0xf6, 0x33, 0x5f,
+    0x0e, 0x53, 0xfb, 0xe4, 0x14, 0x23, 0x45, 0x7c,
+    0x62, 0xb7, 0x1e, 0x5e, 0x84, 0x73, 0x4c, 0x7d,
+    0xf2, 0x5c, 0xef, 0x2e, 0x40, 0xd5, 0xfd, 0x07,
+    0x0a, 0x6e, 0x43, 0x0f, 0x10, 0x8c, 0x91, 0x59,
+    0x3c, 0x67, 0xe6, 0xfa, 0x39, 0x5e, 0x9f, 0x7c,
+    0x5f, 0xa0, 0x03, 0x99, 0xb2, 0x68, 0x1c, 0x80,
+    0x1f, 0xce, 0x53, 0x30, 0x28, 0xe1, 0x4f, 0x0f,
+    0x84, 0x4d, 0x8e, 0x9a, 0x60, 0xef, 0xe1, 0x16,
+    0x87, 0xd4, 0x4f, 0xf9, 0xc6, 0x71, 0x59, 0x0b,
+    0x16, 0xa0, 0x5c, 0x35, 0x67, 0x51, 0xbe, 0x0f,
+    0x07, 0x59, 0x89, 0x6c, 0xc6, 0x95, 0x18, 0x48,
+    0xa3, 0x59, 0xc3, 0x79, 0xf1, 0x59, 0x39, 0x12,
+    0x90, 0x86, 0x5a, 0xd2, 0xe7, 0x76, 0x8e, 0x25,
+    0x46, 0xa0, 0x04, 0x17, 0x75, 0x83, 0x24, 0x0a,
+    0x9a, 0x03, 0x3d, 0x5c, 0xbd, 0xd3, 0xa9, 0x9f,
+    0x45, 0x5b, 0x7d, 0xbd, 0xad, 0x31, 0xe3, 0x30,
+    0x55, 0x4f, 0xf3, 0x96, 0x63, 0x9b, 0x4b, 0x1b,
+    0x0b, 0x58, 0x35, 0x17, 0xef, 0x7c, 0xc8, 0xf6,
+    0x8c, 0x70, 0x02, 0x6d, 0x85, 0x6d, 0x53, 0x33,
+    0x29, 0x4e, 0x65, 0x2c, 0x6c, 0xfe, 0x7c, 0x0e,
+};
+#endif
 #endif
 
 #if defined(HAVE_KEYS)
@@ -140,6 +852,12 @@ const struct bootutil_key bootutil_keys[] = {
     {
         .key = root_pub_der,
         .len = &root_pub_der_len,
+        .hash = root_pub_der_hash,
+#if (defined(MCUBOOT_SIGN_RSA) && defined(MCUBOOT_RSA_PRECOMP)) || \
+    (defined(MCUBOOT_SIGN_EC256) && defined(MCUBOOT_EC256_FIXED_BASE)) || \
+    (defined(MCUBOOT_SIGN_ED25519) && defined(MCUBOOT_ED25519_FIXED_BASE))
+        .table = root_pub_der_table,
+#endif
     },
 };
 const int bootutil_key_cnt = 1;
@@ -297,3 +1015,19 @@ const struct bootutil_key bootutil_enc_key = {
     .len = &enc_key_len,
 };
 #endif
+
+#if MCUBOOT_SWAP_SEAL_ENCKEY
+#include <string.h>
+#include <bootutil/enc_key.h>
+
+static const unsigned char seal_key[BOOT_ENC_KEY_SIZE] = {
+  0x5e, 0xa1, 0xed, 0x0b, 0x07, 0x1a, 0x9c, 0x42, 0x8e, 0x3d, 0xf6, 0x21,
+  0xc4, 0x67, 0x90, 0xab
+};
+
+int boot_enc_get_seal_key(uint8_t *kek)
+{
+    memcpy(kek, seal_key, sizeof seal_key);
+    return 0;
+}
+#endif
@@ -42,6 +42,15 @@ extern int sim_flash_read(uint8_t flash_id, uint32_t offset, uint8_t *dest,
         uint32_t size);
 extern int sim_flash_write(uint8_t flash_id, uint32_t offset, const uint8_t *src,
         uint32_t size);
+extern int sim_flash_get_ptr(uint8_t flash_id, uint32_t offset, uint32_t size,
+        const uint8_t **ptr);
+extern int sim_flash_erase_start(uint8_t flash_id, uint32_t offset,
+        uint32_t size);
+extern int sim_flash_write_start(uint8_t flash_id, uint32_t offset,
+        const uint8_t *src, uint32_t size);
+extern int sim_flash_poll(uint8_t flash_id);
+extern void sim_flash_wait(uint8_t flash_id);
+extern uint32_t sim_flash_erase_block_size(uint8_t flash_id);
 extern uint8_t sim_flash_align(uint8_t flash_id);
 extern uint8_t sim_flash_erased_val(uint8_t flash_id);
 
@@ -248,6 +257,8 @@ int invoke_boot_go(struct sim_context *ctx, struct area_desc *adesc)
         /* printf("boot_go off: %d (0x%08x)\n", res, rsp.br_image_off); */
         return res;
     } else {
+        /* The boot was cut short, so the trailer cache was not released. */
+        boot_trailer_cache_stop();
         sim_reset_flash_areas();
         sim_reset_context();
         free(state);
@@ -337,7 +348,7 @@ int flash_area_erase(const struct flash_area *area, uint32_t off, uint32_t len)
 int flash_area_read_is_empty(const struct flash_area *area, uint32_t off,
         void *dst, uint32_t len)
 {
-    uint8_t i;
+    uint32_t i;
     uint8_t *u8dst;
     int rc;
 
@@ -357,6 +368,113 @@ int flash_area_read_is_empty(const struct flash_area *area, uint32_t off,
     return 1;
 }
 
+#ifdef MCUBOOT_COPY_DOUBLE_BUF
+/*
+ * The simulated flash has no background reads: the read is done when it is
+ * started, and its result handed back when waited for.
+ */
+static int sim_read_rc;
+
+int flash_area_read_start(const struct flash_area *area, uint32_t off,
+        void *dst, uint32_t len)
+{
+    BOOT_LOG_SIM("%s: area=%d, off=%x, len=%x", __func__, area->fa_id, off, len);
+    sim_read_rc = sim_flash_read(area->fa_device_id, area->fa_off + off, dst,
+            len);
+    return 0;
+}
+
+int flash_area_read_wait(const struct flash_area *area)
+{
+    (void)area;
+    return sim_read_rc;
+}
+#endif
+
+#ifdef MCUBOOT_FLASH_ASYNC
+/*
+ * Writes and erases are applied when they are started, as failures are
+ * injected by counting them; the simulated flash keeps the device busy for
+ * as long as they would take, so that waiting for them can be timed.
+ */
+static int sim_op_rc[256];
+
+int flash_area_write_start(const struct flash_area *area, uint32_t off,
+        const void *src, uint32_t len)
+{
+    BOOT_LOG_SIM("%s: area=%d, off=%x, len=%x", __func__,
+                 area->fa_id, off, len);
+    struct sim_context *ctx = sim_get_context();
+    if (--(ctx->flash_counter) == 0) {
+        ctx->jumped++;
+        longjmp(ctx->boot_jmpbuf, 1);
+    }
+    sim_op_rc[area->fa_id] = sim_flash_write_start(area->fa_device_id,
+            area->fa_off + off, src, len);
+    return 0;
+}
+
+int flash_area_erase_start(const struct flash_area *area, uint32_t off,
+        uint32_t len)
+{
+    BOOT_LOG_SIM("%s: area=%d, off=%x, len=%x", __func__,
+                 area->fa_id, off, len);
+    struct sim_context *ctx = sim_get_context();
+    if (--(ctx->flash_counter) == 0) {
+        ctx->jumped++;
+        longjmp(ctx->boot_jmpbuf, 1);
+    }
+    sim_op_rc[area->fa_id] = sim_flash_erase_start(area->fa_device_id,
+            area->fa_off + off, len);
+    return 0;
+}
+
+int flash_area_poll(const struct flash_area *area)
+{
+    return sim_flash_poll(area->fa_device_id);
+}
+
+int flash_area_wait(const struct flash_area *area)
+{
+    int rc;
+
+    sim_flash_wait(area->fa_device_id);
+    rc = sim_op_rc[area->fa_id];
+    sim_op_rc[area->fa_id] = 0;
+    return rc;
+}
+#endif
+
+#ifdef MCUBOOT_FLASH_BLOCK_ERASE
+uint32_t flash_area_erase_block_size(const struct flash_area *area)
+{
+    return sim_flash_erase_block_size(area->fa_device_id);
+}
+#endif
+
+#ifdef MCUBOOT_FLASH_AREA_GET_PTR
+int flash_area_get_ptr(const struct flash_area *area, uint32_t off,
+        uint32_t len, const void **ptr)
+{
+    const uint8_t *p;
+    int rc;
+
+    BOOT_LOG_SIM("%s: area=%d, off=%x, len=%x", __func__, area->fa_id, off, len);
+
+    if (off > area->fa_size || len > area->fa_size - off) {
+        return -1;
+    }
+
+    rc = sim_flash_get_ptr(area->fa_device_id, area->fa_off + off, len, &p);
+    if (rc) {
+        return rc;
+    }
+
+    *ptr = p;
+    return 0;
+}
+#endif
+
 int flash_area_to_sectors(int idx, int *cnt, struct flash_area *ret)
 {
     uint32_t i;
@@ -138,6 +138,48 @@ uint8_t flash_area_erased_val(const struct flash_area *);
 int flash_area_read_is_empty(const struct flash_area *fa, uint32_t off,
         void *dst, uint32_t len);
 
+/*
+ * Starts reading len bytes at off into dst.  The read may complete in the
+ * background; flash_area_read_wait() returns once it has, with the result of
+ * the read.  Only one read may be in flight for a given area.
+ */
+int flash_area_read_start(const struct flash_area *fa, uint32_t off,
+        void *dst, uint32_t len);
+int flash_area_read_wait(const struct flash_area *fa);
+
+/*
+ * Start writing len bytes of src at off, or erasing len bytes at off.  The
+ * operation may complete in the background, and src must be left untouched
+ * until it has.  flash_area_poll() returns non-zero while it is in progress,
+ * and flash_area_wait() returns once it has completed, with its result, or 0
+ * if there was none.  Only one write or erase may be in flight for a given
+ * area, which is not accessed otherwise until it has been waited for; other
+ * areas, even on the same device, may be.
+ */
+int flash_area_write_start(const struct flash_area *fa, uint32_t off,
+        const void *src, uint32_t len);
+int flash_area_erase_start(const struct flash_area *fa, uint32_t off,
+        uint32_t len);
+int flash_area_poll(const struct flash_area *fa);
+int flash_area_wait(const struct flash_area *fa);
+
+/*
+ * Returns the size of the largest erase command of the device holding the
+ * area, or 0 if it only erases sectors.  Such blocks start at multiples of
+ * their size on the device, and flash_area_erase() uses the command for
+ * regions that start and end on them.
+ */
+uint32_t flash_area_erase_block_size(const struct flash_area *fa);
+
+/*
+ * Points *ptr at len bytes of the flash area at off, when they can be read
+ * in place through the memory map.
+ *
+ * Returns 0 on success, or non-zero if flash_area_read() has to be used.
+ */
+int flash_area_get_ptr(const struct flash_area *fa, uint32_t off,
+        uint32_t len, const void **ptr);
+
 /*
  * Given flash area ID, return info about sectors within the area.
  */
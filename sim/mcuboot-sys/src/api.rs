@@ -8,9 +8,10 @@
 use crate::area::CAreaDesc;
 use libc;
 use log::{Level, log_enabled, warn};
-use simflash::{Result, Flash, FlashPtr};
+use simflash::{Result, Flash, FlashOp, FlashPtr};
 use std::{
     cell::RefCell,
+    cmp,
     collections::HashMap,
     mem,
     ptr,
@@ -23,6 +24,7 @@ pub type FlashMap = HashMap<u8, FlashPtr>;
 pub struct FlashParamsStruct {
     align: u8,
     erased_val: u8,
+    erase_block: u32,
 }
 
 pub type FlashParams = HashMap<u8, FlashParamsStruct>;
@@ -35,6 +37,10 @@ pub struct FlashContext {
     flash_map: FlashMap,
     flash_params: FlashParams,
     flash_areas: CAreaDescPtr,
+    /// Simulated time, in nanoseconds, spent waiting on the flash.
+    clock: u64,
+    /// When the operation started on each device will be done.
+    busy: HashMap<u8, u64>,
 }
 
 impl FlashContext {
@@ -43,10 +49,43 @@ impl FlashContext {
             flash_map: HashMap::new(),
             flash_params: HashMap::new(),
             flash_areas: CAreaDescPtr{ptr: ptr::null()},
+            clock: 0,
+            busy: HashMap::new(),
         }
     }
+
+    /// Account for an operation taking `cost` on a device.  It can only start once the previous
+    /// one on that device is done; a synchronous operation holds the clock until it finishes,
+    /// while a started one only keeps the device busy.
+    fn charge(&mut self, dev_id: u8, cost: u64, start: bool) {
+        let busy = self.busy.get(&dev_id).cloned().unwrap_or(0);
+        let begin = cmp::max(self.clock, busy);
+        if start {
+            self.busy.insert(dev_id, begin + cost);
+        } else {
+            self.clock = begin + cost;
+        }
+    }
+}
+
+/// Time spent on flash operations since the last `reset_flash_time`, in nanoseconds.
+pub fn flash_time() -> u64 {
+    THREAD_CTX.with(|ctx| {
+        ctx.borrow().clock
+    })
+}
+
+pub fn reset_flash_time() {
+    THREAD_CTX.with(|ctx| {
+        let mut ctx = ctx.borrow_mut();
+        ctx.clock = 0;
+        ctx.busy.clear();
+    });
 }
 
+/// Time the bootloader waits between two polls of a busy device.
+const POLL_INTERVAL: u64 = 10_000;
+
 #[repr(C)]
 #[derive(Debug, Default)]
 pub struct CSimContext {
@@ -83,6 +122,7 @@ pub unsafe fn set_flash(dev_id: u8, dev: &mut dyn Flash) {
         ctx.borrow_mut().flash_params.insert(dev_id, FlashParamsStruct {
             align: dev.align() as u8,
             erased_val: dev.erased_val(),
+            erase_block: dev.erase_block_size() as u32,
         });
         let dev: &'static mut dyn Flash = mem::transmute(dev);
         ctx.borrow_mut().flash_map.insert(
@@ -142,12 +182,26 @@ pub extern fn sim_reset_context() {
 
 #[no_mangle]
 pub extern fn sim_flash_erase(dev_id: u8, offset: u32, size: u32) -> libc::c_int {
+    flash_erase(dev_id, offset, size, false)
+}
+
+/// Start an erase.  The data is erased right away, but the device stays busy for as long as the
+/// erase would take.
+#[no_mangle]
+pub extern fn sim_flash_erase_start(dev_id: u8, offset: u32, size: u32) -> libc::c_int {
+    flash_erase(dev_id, offset, size, true)
+}
+
+fn flash_erase(dev_id: u8, offset: u32, size: u32, start: bool) -> libc::c_int {
     let mut rc: libc::c_int = -19;
+    let mut cost = 0;
     THREAD_CTX.with(|ctx| {
         if let Some(flash) = ctx.borrow().flash_map.get(&dev_id) {
             let dev = unsafe { &mut *(flash.ptr) };
             rc = map_err(dev.erase(offset as usize, size as usize));
+            cost = dev.op_time(FlashOp::Erase, offset as usize, size as usize);
         }
+        ctx.borrow_mut().charge(dev_id, cost, start);
     });
     rc
 }
@@ -155,11 +209,32 @@ pub extern fn sim_flash_erase(dev_id: u8, offset: u32, size: u32) -> libc::c_int
 #[no_mangle]
 pub extern fn sim_flash_read(dev_id: u8, offset: u32, dest: *mut u8, size: u32) -> libc::c_int {
     let mut rc: libc::c_int = -19;
+    let mut cost = 0;
     THREAD_CTX.with(|ctx| {
         if let Some(flash) = ctx.borrow().flash_map.get(&dev_id) {
             let mut buf: &mut[u8] = unsafe { slice::from_raw_parts_mut(dest, size as usize) };
             let dev = unsafe { &mut *(flash.ptr) };
             rc = map_err(dev.read(offset as usize, &mut buf));
+            cost = dev.op_time(FlashOp::Read, offset as usize, size as usize);
+        }
+        ctx.borrow_mut().charge(dev_id, cost, false);
+    });
+    rc
+}
+
+#[no_mangle]
+pub extern fn sim_flash_get_ptr(dev_id: u8, offset: u32, size: u32, ptr: *mut *const u8) -> libc::c_int {
+    let mut rc: libc::c_int = -19;
+    THREAD_CTX.with(|ctx| {
+        if let Some(flash) = ctx.borrow().flash_map.get(&dev_id) {
+            let dev = unsafe { &*(flash.ptr) };
+            rc = match dev.slice(offset as usize, size as usize) {
+                Ok(sub) => {
+                    unsafe { *ptr = sub.as_ptr() };
+                    0
+                }
+                Err(e) => map_err(Err(e)),
+            };
         }
     });
     rc
@@ -167,17 +242,56 @@ pub extern fn sim_flash_read(dev_id: u8, offset: u32, dest: *mut u8, size: u32)
 
 #[no_mangle]
 pub extern fn sim_flash_write(dev_id: u8, offset: u32, src: *const u8, size: u32) -> libc::c_int {
+    flash_write(dev_id, offset, src, size, false)
+}
+
+/// Start a write, which like `sim_flash_erase_start` takes effect right away.
+#[no_mangle]
+pub extern fn sim_flash_write_start(dev_id: u8, offset: u32, src: *const u8, size: u32) -> libc::c_int {
+    flash_write(dev_id, offset, src, size, true)
+}
+
+fn flash_write(dev_id: u8, offset: u32, src: *const u8, size: u32, start: bool) -> libc::c_int {
     let mut rc: libc::c_int = -19;
+    let mut cost = 0;
     THREAD_CTX.with(|ctx| {
         if let Some(flash) = ctx.borrow().flash_map.get(&dev_id) {
             let buf: &[u8] = unsafe { slice::from_raw_parts(src, size as usize) };
             let dev = unsafe { &mut *(flash.ptr) };
             rc = map_err(dev.write(offset as usize, &buf));
+            cost = dev.op_time(FlashOp::Write, offset as usize, size as usize);
         }
+        ctx.borrow_mut().charge(dev_id, cost, start);
     });
     rc
 }
 
+/// Returns non-zero while an operation started on the device is still running.  Each poll lets
+/// some time pass, as the bootloader would spend it between polls.
+#[no_mangle]
+pub extern fn sim_flash_poll(dev_id: u8) -> libc::c_int {
+    THREAD_CTX.with(|ctx| {
+        let mut ctx = ctx.borrow_mut();
+        let busy = ctx.busy.get(&dev_id).cloned().unwrap_or(0);
+        if busy > ctx.clock {
+            ctx.clock += POLL_INTERVAL;
+            1
+        } else {
+            0
+        }
+    })
+}
+
+/// Wait for the operation started on the device to finish.
+#[no_mangle]
+pub extern fn sim_flash_wait(dev_id: u8) {
+    THREAD_CTX.with(|ctx| {
+        let mut ctx = ctx.borrow_mut();
+        let busy = ctx.busy.get(&dev_id).cloned().unwrap_or(0);
+        ctx.clock = cmp::max(ctx.clock, busy);
+    });
+}
+
 #[no_mangle]
 pub extern fn sim_flash_align(id: u8) -> u8 {
     THREAD_CTX.with(|ctx| {
@@ -192,6 +306,13 @@ pub extern fn sim_flash_erased_val(id: u8) -> u8 {
     })
 }
 
+#[no_mangle]
+pub extern fn sim_flash_erase_block_size(id: u8) -> u32 {
+    THREAD_CTX.with(|ctx| {
+        ctx.borrow().flash_params.get(&id).unwrap().erase_block
+    })
+}
+
 fn map_err(err: Result<()>) -> libc::c_int {
     match err {
         Ok(()) => 0,
@@ -42,6 +42,15 @@ pub fn boot_go(multiflash: &mut SimMultiFlash, areadesc: &AreaDesc,
     (result, asserts)
 }
 
+/// Simulated time spent on the flash since the last `reset_flash_time`, in nanoseconds.
+pub fn flash_time() -> u64 {
+    api::flash_time()
+}
+
+pub fn reset_flash_time() {
+    api::reset_flash_time()
+}
+
 pub fn boot_trailer_sz(align: u32) -> u32 {
     unsafe { raw::boot_trailer_sz(align) }
 }
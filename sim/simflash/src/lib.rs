@@ -56,10 +56,59 @@ pub struct FlashPtr {
 }
 unsafe impl Send for FlashPtr {}
 
+/// The kinds of flash operations, for timing them.
+#[derive(Clone, Copy, Debug, PartialEq)]
+pub enum FlashOp {
+    Read,
+    Write,
+    Erase,
+}
+
+/// How long the operations of a flash device take, in nanoseconds.  This does not change what
+/// the device does, but lets the simulator measure how long an upgrade would take.
+#[derive(Clone, Copy, Debug)]
+pub struct Latency {
+    /// Reading, per byte.
+    pub read: u64,
+    /// Programming, per byte.
+    pub write: u64,
+    /// Erasing, per sector.
+    pub erase: u64,
+    /// Size of the larger blocks the device can erase at once, or 0 if it can't.
+    pub block_size: usize,
+    /// Erasing, per block.
+    pub block_erase: u64,
+}
+
+impl Latency {
+    /// Typical on-chip NOR flash of a microcontroller.
+    pub fn internal() -> Latency {
+        Latency {
+            read: 25,
+            write: 2_500,
+            erase: 20_000_000,
+            block_size: 0,
+            block_erase: 0,
+        }
+    }
+
+    /// Typical external SPI NOR flash.
+    pub fn spi_nor() -> Latency {
+        Latency {
+            read: 125,
+            write: 2_750,
+            erase: 45_000_000,
+            block_size: 65536,
+            block_erase: 150_000_000,
+        }
+    }
+}
+
 pub trait Flash {
     fn erase(&mut self, offset: usize, len: usize) -> Result<()>;
     fn write(&mut self, offset: usize, payload: &[u8]) -> Result<()>;
     fn read(&self, offset: usize, data: &mut [u8]) -> Result<()>;
+    fn slice(&self, offset: usize, len: usize) -> Result<&[u8]>;
 
     fn add_bad_region(&mut self, offset: usize, len: usize, rate: f32) -> Result<()>;
     fn reset_bad_regions(&mut self);
@@ -71,6 +120,11 @@ pub trait Flash {
 
     fn align(&self) -> usize;
     fn erased_val(&self) -> u8;
+
+    fn erase_block_size(&self) -> usize;
+
+    fn set_latency(&mut self, latency: Latency);
+    fn op_time(&self, op: FlashOp, offset: usize, len: usize) -> u64;
 }
 
 fn ebounds<T: AsRef<str>>(message: T) -> FlashError {
@@ -99,6 +153,7 @@ pub struct SimFlash {
     align: usize,
     verify_writes: bool,
     erased_val: u8,
+    latency: Latency,
 }
 
 impl SimFlash {
@@ -117,6 +172,7 @@ impl SimFlash {
             align: align,
             verify_writes: true,
             erased_val: erased_val,
+            latency: Latency::internal(),
         }
     }
 
@@ -232,6 +288,15 @@ impl Flash for SimFlash {
         Ok(())
     }
 
+    /// Gives direct access to the contents, as memory-mapped flash would.
+    fn slice(&self, offset: usize, len: usize) -> Result<&[u8]> {
+        if offset + len > self.data.len() {
+            bail!(ebounds("Read outside of device"));
+        }
+
+        Ok(&self.data[offset .. offset + len])
+    }
+
     /// Adds a new flash bad region. Writes to this area fail with a chance
     /// given by `rate`.
     fn add_bad_region(&mut self, offset: usize, len: usize, rate: f32) -> Result<()> {
@@ -272,6 +337,33 @@ impl Flash for SimFlash {
     fn erased_val(&self) -> u8 {
         self.erased_val
     }
+
+    fn erase_block_size(&self) -> usize {
+        self.latency.block_size
+    }
+
+    fn set_latency(&mut self, latency: Latency) {
+        self.latency = latency;
+    }
+
+    /// The time the given operation takes; erases take as long for each sector they touch, unless
+    /// they cover whole blocks.
+    fn op_time(&self, op: FlashOp, offset: usize, len: usize) -> u64 {
+        let block = self.latency.block_size;
+        match op {
+            FlashOp::Read => self.latency.read * len as u64,
+            FlashOp::Write => self.latency.write * len as u64,
+            FlashOp::Erase if block > 0 && offset % block == 0 && len % block == 0 => {
+                self.latency.block_erase * (len / block) as u64
+            }
+            FlashOp::Erase => {
+                let count = self.sector_iter()
+                    .filter(|s| s.base < offset + len && offset < s.base + s.size)
+                    .count();
+                self.latency.erase * count as u64
+            }
+        }
+    }
 }
 
 /// It is possible to iterate over the sectors in the device, each element returning this.
@@ -24,6 +24,11 @@ pub enum Caps {
     SwapUsingMove        = (1 << 11),
     DowngradePrevention  = (1 << 12),
     EncX25519            = (1 << 13),
+    DirectXip            = (1 << 14),
+    DeltaUpgrade         = (1 << 15),
+    CompressedImages     = (1 << 16),
+    ImageManifest        = (1 << 17),
+    SwapUsingRam         = (1 << 18),
 }
 
 impl Caps {
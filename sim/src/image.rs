@@ -18,6 +18,7 @@ use rand::{
     distributions::{IndependentSample, Range},
     Rng, SeedableRng, XorShiftRng,
 };
+use ring::digest;
 use std::{
     collections::HashSet,
     io::{Cursor, Write},
@@ -33,7 +34,7 @@ use aes_ctr::{
     },
 };
 
-use simflash::{Flash, SimFlash, SimMultiFlash};
+use simflash::{Flash, Latency, SimFlash, SimMultiFlash};
 use mcuboot_sys::{c, AreaDesc, FlashId};
 use crate::{
     ALL_DEVICES,
@@ -49,7 +50,7 @@ use crate::depends::{
     PairDep,
     UpgradeInfo,
 };
-use crate::tlv::{ManifestGen, TlvGen, TlvFlags};
+use crate::tlv::{ManifestGen, TlvGen, TlvFlags, TlvKinds};
 
 /// A builder for Images.  This describes a single run of the simulator,
 /// capturing the configuration of a particular set of devices, including
@@ -68,9 +69,40 @@ pub struct Images {
     flash: SimMultiFlash,
     areadesc: AreaDesc,
     images: Vec<OneImage>,
+    kind: UpgradeKind,
     total_count: Option<i32>,
 }
 
+/// How the upgrades are stored in the secondary slot.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum UpgradeKind {
+    /// The full image.
+    Full,
+    /// A patch against the image in the primary slot (delta-upgrade).
+    Delta,
+    /// The full image, compressed (compressed-images).
+    Compressed,
+    /// The full images, the first one listing the hashes of the others,
+    /// which are not signed (image-manifest).
+    Manifest,
+}
+
+impl UpgradeKind {
+    /// Whether the bootloader, as built, can install this kind of upgrade.
+    fn is_supported(self) -> bool {
+        let encrypted = Caps::EncRsa.present() || Caps::EncKw.present() ||
+            Caps::EncEc256.present() || Caps::EncX25519.present();
+        match self {
+            UpgradeKind::Full => true,
+            UpgradeKind::Delta => Caps::DeltaUpgrade.present() && !encrypted,
+            UpgradeKind::Compressed => Caps::CompressedImages.present() &&
+                Caps::OverwriteUpgrade.present() && !encrypted,
+            UpgradeKind::Manifest => Caps::ImageManifest.present() &&
+                Caps::get_num_images() > 1 && !encrypted,
+        }
+    }
+}
+
 /// When doing multi-image, there is an instance of this information for
 /// each of the images.  Single image there will be one of these.
 struct OneImage {
@@ -172,9 +204,16 @@ impl ImagesBuilder {
 
     /// Construct an `Images` that doesn't expect an upgrade to happen.
     pub fn make_no_upgrade_image(self, deps: &DepTest) -> Images {
+        self.make_no_upgrade_image_of(deps, UpgradeKind::Full)
+    }
+
+    fn make_no_upgrade_image_of(self, deps: &DepTest, kind: UpgradeKind) -> Images {
         let num_images = self.num_images();
         let mut flash = self.flash;
-        let images = self.slots.into_iter().enumerate().map(|(image_num, slots)| {
+        // The manifest image lists the upgrades of the other images, so these
+        // are installed first.
+        let mut manifest: Vec<(TlvKinds, Vec<u8>)> = vec![];
+        let mut images: Vec<OneImage> = self.slots.into_iter().enumerate().rev().map(|(image_num, slots)| {
             let dep: Box<dyn Depender> = if num_images > 1 {
                 Box::new(PairDep::new(num_images, image_num, deps))
             } else {
@@ -183,18 +222,21 @@ impl ImagesBuilder {
             let primaries = install_image(&mut flash, &slots[0], 42784, &*dep, false);
             let upgrades = match deps.depends[image_num] {
                 DepType::NoUpgrade => install_no_image(),
-                _ => install_image(&mut flash, &slots[1], 46928, &*dep, false)
+                _ => install_upgrade(&mut flash, &slots[1], &primaries, 46928,
+                                     &*dep, kind, image_num, &mut manifest)
             };
             OneImage {
                 slots: slots,
                 primaries: primaries,
                 upgrades: upgrades,
             }}).collect();
+        images.reverse();
         install_ptable(&mut flash, &self.areadesc);
         Images {
             flash: flash,
             areadesc: self.areadesc,
             images: images,
+            kind: kind,
             total_count: None,
         }
     }
@@ -205,21 +247,49 @@ impl ImagesBuilder {
             mark_upgrade(&mut images.flash, &image.slots[1]);
         }
 
-        // upgrades without fails, counts number of flash operations
-        let total_count = match images.run_basic_upgrade(permanent) {
-            Ok(v)  => v,
-            Err(_) =>
-                if deps.upgrades.iter().any(|u| *u == UpgradeInfo::Held) {
-                    0
-                } else {
-                    panic!("Unable to perform basic upgrade");
-                }
+        // upgrades without fails, counts number of flash operations.  With
+        // direct-XIP, nothing is copied, so there is no upgrade to count, and
+        // swap using RAM refuses test upgrades.
+        let total_count = if Caps::DirectXip.present() ||
+            (Caps::SwapUsingRam.present() && !permanent) {
+            0
+        } else {
+            match images.run_basic_upgrade(permanent) {
+                Ok(v)  => v,
+                Err(_) =>
+                    if deps.upgrades.iter().any(|u| *u == UpgradeInfo::Held) {
+                        0
+                    } else {
+                        panic!("Unable to perform basic upgrade");
+                    }
+            }
         };
 
         images.total_count = Some(total_count);
         images
     }
 
+    /// Construct an `Images` for a permanent upgrade stored as the given
+    /// kind, or None if the bootloader was built without support for it.
+    pub fn make_packed_image(self, kind: UpgradeKind) -> Option<Images> {
+        if !kind.is_supported() {
+            return None;
+        }
+
+        let mut images = self.make_no_upgrade_image_of(&NO_DEPS, kind);
+        for image in &images.images {
+            mark_upgrade(&mut images.flash, &image.slots[1]);
+        }
+
+        let total_count = match images.run_basic_upgrade(true) {
+            Ok(v)  => v,
+            Err(_) => panic!("Unable to perform basic {:?} upgrade", kind),
+        };
+
+        images.total_count = Some(total_count);
+        Some(images)
+    }
+
     pub fn make_bad_secondary_slot_image(self) -> Images {
         let mut bad_flash = self.flash;
         let images = self.slots.into_iter().enumerate().map(|(image_num, slots)| {
@@ -235,6 +305,7 @@ impl ImagesBuilder {
             flash: bad_flash,
             areadesc: self.areadesc,
             images: images,
+            kind: UpgradeKind::Full,
             total_count: None,
         }
     }
@@ -257,7 +328,26 @@ impl ImagesBuilder {
 
                 let mut flash = SimMultiFlash::new();
                 flash.insert(dev_id, dev);
-                (flash, areadesc, &[Caps::SwapUsingMove])
+                (flash, areadesc, &[Caps::SwapUsingMove, Caps::SwapUsingRam])
+            }
+            DeviceName::Stm32f4Mixed => {
+                // STM style flash, with the small sectors at the start of the
+                // primary slot, so that the slots have different layouts.
+                let dev = SimFlash::new(vec![16 * 1024, 16 * 1024, 16 * 1024, 16 * 1024,
+                                        64 * 1024,
+                                        128 * 1024, 128 * 1024, 128 * 1024, 128 * 1024,
+                                        128 * 1024, 128 * 1024, 128 * 1024],
+                                        align as usize, erased_val);
+                let dev_id = 0;
+                let mut areadesc = AreaDesc::new();
+                areadesc.add_flash_sectors(dev_id, &dev);
+                areadesc.add_image(0x000000, 0x060000, FlashId::Image0, dev_id);
+                areadesc.add_image(0x060000, 0x060000, FlashId::Image1, dev_id);
+                areadesc.add_image(0x0c0000, 0x020000, FlashId::ImageScratch, dev_id);
+
+                let mut flash = SimMultiFlash::new();
+                flash.insert(dev_id, dev);
+                (flash, areadesc, &[Caps::SwapUsingRam])
             }
             DeviceName::K64f => {
                 // NXP style flash.  Small sectors, one small sector for scratch.
@@ -288,7 +378,7 @@ impl ImagesBuilder {
 
                 let mut flash = SimMultiFlash::new();
                 flash.insert(dev_id, dev);
-                (flash, areadesc, &[Caps::SwapUsingMove])
+                (flash, areadesc, &[Caps::SwapUsingMove, Caps::SwapUsingRam])
             }
             DeviceName::Nrf52840 => {
                 // Simulating the flash on the nrf52840 with partitions set up so that the scratch size
@@ -310,7 +400,8 @@ impl ImagesBuilder {
                 // Simulate nrf52840 with external SPI flash. The external SPI flash
                 // has a larger sector size so for now store scratch on that flash.
                 let dev0 = SimFlash::new(vec![4096; 128], align as usize, erased_val);
-                let dev1 = SimFlash::new(vec![8192; 64], align as usize, erased_val);
+                let mut dev1 = SimFlash::new(vec![8192; 64], align as usize, erased_val);
+                dev1.set_latency(Latency::spi_nor());
 
                 let mut areadesc = AreaDesc::new();
                 areadesc.add_flash_sectors(0, &dev0);
@@ -323,7 +414,7 @@ impl ImagesBuilder {
                 let mut flash = SimMultiFlash::new();
                 flash.insert(0, dev0);
                 flash.insert(1, dev1);
-                (flash, areadesc, &[Caps::SwapUsingMove])
+                (flash, areadesc, &[Caps::SwapUsingRam])
             }
             DeviceName::K64fMulti => {
                 // NXP style flash, but larger, to support multiple images.
@@ -356,8 +447,10 @@ impl Images {
     /// Returns the number of flash operations which can later be used to
     /// inject failures at chosen steps.
     pub fn run_basic_upgrade(&self, permanent: bool) -> Result<i32, ()> {
+        c::reset_flash_time();
         let (flash, total_count) = self.try_upgrade(None, permanent);
         info!("Total flash operation count={}", total_count);
+        info!("Total flash time={}us", c::flash_time() / 1000);
 
         if !self.verify_images(&flash, 0, 1) {
             warn!("Image mismatch after first boot");
@@ -376,11 +469,20 @@ impl Images {
     }
 
     fn is_swap_upgrade(&self) -> bool {
+        // A patch is applied in place, leaving nothing to swap back.
+        (Caps::SwapUsingScratch.present() || Caps::SwapUsingMove.present() ||
+            Caps::SwapUsingRam.present()) && self.kind != UpgradeKind::Delta
+    }
+
+    /// Whether an interrupted swap always leaves the old image intact in the
+    /// secondary slot.  Swap using RAM may lose the sector it holds in RAM.
+    fn keeps_old_image(&self) -> bool {
         Caps::SwapUsingScratch.present() || Caps::SwapUsingMove.present()
     }
 
     pub fn run_basic_revert(&self) -> bool {
-        if Caps::OverwriteUpgrade.present() {
+        if Caps::OverwriteUpgrade.present() || Caps::DirectXip.present() ||
+            Caps::SwapUsingRam.present() {
             return false;
         }
 
@@ -402,6 +504,10 @@ impl Images {
     }
 
     pub fn run_perm_with_fails(&self) -> bool {
+        if Caps::DirectXip.present() {
+            return false;
+        }
+
         let mut fails = 0;
         let total_flash_ops = self.total_count.unwrap();
 
@@ -427,7 +533,7 @@ impl Images {
                 fails += 1;
             }
 
-            if self.is_swap_upgrade() {
+            if self.keeps_old_image() {
                 if !self.verify_images(&flash, 1, 0) {
                     warn!("Secondary slot FAIL at step {} of {}",
                           i, total_flash_ops);
@@ -445,13 +551,17 @@ impl Images {
     }
 
     pub fn run_perm_with_random_fails(&self, total_fails: usize) -> bool {
+        if Caps::DirectXip.present() {
+            return false;
+        }
+
         let mut fails = 0;
         let total_flash_ops = self.total_count.unwrap();
         let (flash, total_counts) = self.try_random_fails(total_flash_ops, total_fails);
         info!("Random interruptions at reset points={:?}", total_counts);
 
         let primary_slot_ok = self.verify_images(&flash, 0, 1);
-        let secondary_slot_ok = if self.is_swap_upgrade() {
+        let secondary_slot_ok = if self.keeps_old_image() {
             // TODO: This result is ignored.
             self.verify_images(&flash, 1, 0)
         } else {
@@ -483,13 +593,14 @@ impl Images {
     }
 
     pub fn run_revert_with_fails(&self) -> bool {
-        if Caps::OverwriteUpgrade.present() {
+        if Caps::OverwriteUpgrade.present() || Caps::DirectXip.present() ||
+            Caps::SwapUsingRam.present() {
             return false;
         }
 
         let mut fails = 0;
 
-        if self.is_swap_upgrade() {
+        if self.keeps_old_image() {
             for i in 1 .. self.total_count.unwrap() {
                 info!("Try interruption at {}", i);
                 if self.try_revert_with_fail_at(i) {
@@ -503,7 +614,8 @@ impl Images {
     }
 
     pub fn run_norevert(&self) -> bool {
-        if Caps::OverwriteUpgrade.present() {
+        if Caps::OverwriteUpgrade.present() || Caps::DirectXip.present() ||
+            Caps::SwapUsingRam.present() {
             return false;
         }
 
@@ -605,6 +717,10 @@ impl Images {
     // image_ok set while there is no image on the secondary slot, so no revert
     // should ever happen...
     pub fn run_norevert_newimage(&self) -> bool {
+        if Caps::DirectXip.present() {
+            return false;
+        }
+
         let mut flash = self.flash.clone();
         let mut fails = 0;
 
@@ -654,6 +770,10 @@ impl Images {
     // image_ok set while there is no image on the secondary slot, so no revert
     // should ever happen...
     pub fn run_signfail_upgrade(&self) -> bool {
+        if Caps::DirectXip.present() {
+            return false;
+        }
+
         let mut flash = self.flash.clone();
         let mut fails = 0;
 
@@ -694,6 +814,189 @@ impl Images {
         fails > 0
     }
 
+    /// Runs the images in place, and checks that the newest image with a
+    /// trailer is selected, even when the image without one is newer.
+    /// Nothing must be copied.  Assumes that the image in the secondary slot
+    /// is the newest one.
+    pub fn run_direct_xip_select(&self) -> bool {
+        if !Caps::DirectXip.present() {
+            return false;
+        }
+
+        let mut fails = 0;
+
+        info!("Try direct-XIP selection of a test image");
+
+        let mut flash = self.flash.clone();
+        self.mark_upgrades(&mut flash, 1);
+
+        let (result, _) = c::boot_go(&mut flash, &self.areadesc, None, false);
+        if result != 0 {
+            warn!("Failed first boot");
+            fails += 1;
+        }
+
+        if !self.verify_images(&flash, 0, 0) || !self.verify_images(&flash, 1, 1) {
+            warn!("Images were modified");
+            fails += 1;
+        }
+        if !self.verify_trailers(&flash, 0, BOOT_MAGIC_UNSET,
+                                 BOOT_FLAG_UNSET, BOOT_FLAG_UNSET) {
+            warn!("Mismatched trailer for the primary slot");
+            fails += 1;
+        }
+        if !self.verify_trailers(&flash, 1, BOOT_MAGIC_GOOD,
+                                 BOOT_FLAG_UNSET, BOOT_FLAG_SET) {
+            warn!("Test image in the secondary slot was not selected");
+            fails += 1;
+        }
+
+        info!("Try direct-XIP with a newer image without a trailer");
+
+        let mut flash = self.flash.clone();
+        self.mark_upgrades(&mut flash, 0);
+        self.mark_permanent_upgrades(&mut flash, 0);
+
+        let (result, _) = c::boot_go(&mut flash, &self.areadesc, None, false);
+        if result != 0 {
+            warn!("Failed first boot");
+            fails += 1;
+        }
+
+        if !self.verify_trailers(&flash, 0, BOOT_MAGIC_GOOD,
+                                 BOOT_FLAG_SET, BOOT_FLAG_SET) {
+            warn!("Confirmed image in the primary slot was not selected");
+            fails += 1;
+        }
+        if !self.verify_trailers(&flash, 1, BOOT_MAGIC_UNSET,
+                                 BOOT_FLAG_UNSET, BOOT_FLAG_UNSET) {
+            warn!("Mismatched trailer for the secondary slot");
+            fails += 1;
+        }
+
+        if fails > 0 {
+            error!("Error selecting the image to run in place");
+        }
+
+        fails > 0
+    }
+
+    /// Checks that a newer image which fails validation is never selected,
+    /// and that the image in the other slot is run instead, whether or not
+    /// it has a trailer.
+    pub fn run_direct_xip_fallback(&self) -> bool {
+        if !Caps::DirectXip.present() {
+            return false;
+        }
+
+        let mut fails = 0;
+
+        for &confirmed in &[false, true] {
+            info!("Try direct-XIP fallback, confirmed primary={}", confirmed);
+
+            let mut flash = self.flash.clone();
+            if confirmed {
+                self.mark_upgrades(&mut flash, 0);
+                self.mark_permanent_upgrades(&mut flash, 0);
+            }
+            self.mark_upgrades(&mut flash, 1);
+
+            let (result, _) = c::boot_go(&mut flash, &self.areadesc, None, false);
+            if result != 0 {
+                warn!("Failed first boot");
+                fails += 1;
+            }
+
+            if !self.verify_images(&flash, 0, 0) {
+                warn!("Failed image verification");
+                fails += 1;
+            }
+            if confirmed && !self.verify_trailers(&flash, 0, BOOT_MAGIC_GOOD,
+                                                  BOOT_FLAG_SET, BOOT_FLAG_SET) {
+                warn!("Image in the primary slot was not selected");
+                fails += 1;
+            }
+            if !self.verify_trailers(&flash, 1, BOOT_MAGIC_GOOD,
+                                     BOOT_FLAG_UNSET, BOOT_FLAG_UNSET) {
+                warn!("Image with a bad signature was selected");
+                fails += 1;
+            }
+        }
+
+        if fails > 0 {
+            error!("Expected a fallback when the image has a bad signature");
+        }
+
+        fails > 0
+    }
+
+    /// Checks that a test image which is not confirmed before the next reset
+    /// is erased, and the image in the other slot run instead, while one that
+    /// is confirmed keeps being run.
+    pub fn run_direct_xip_revert(&self) -> bool {
+        if !Caps::DirectXip.present() {
+            return false;
+        }
+
+        let mut fails = 0;
+
+        for &confirm in &[false, true] {
+            info!("Try direct-XIP revert, confirm={}", confirm);
+
+            let mut flash = self.flash.clone();
+            self.mark_upgrades(&mut flash, 1);
+
+            let (result, _) = c::boot_go(&mut flash, &self.areadesc, None, false);
+            if result != 0 {
+                warn!("Failed first boot");
+                fails += 1;
+            }
+
+            // What boot_set_confirmed() does from the running image.
+            if confirm {
+                self.mark_permanent_upgrades(&mut flash, 1);
+            }
+
+            let (result, _) = c::boot_go(&mut flash, &self.areadesc, None, false);
+            if result != 0 {
+                warn!("Failed second boot");
+                fails += 1;
+            }
+
+            if !self.verify_images(&flash, 0, 0) {
+                warn!("Image in the primary slot was modified");
+                fails += 1;
+            }
+            if !self.verify_trailers(&flash, 0, BOOT_MAGIC_UNSET,
+                                     BOOT_FLAG_UNSET, BOOT_FLAG_UNSET) {
+                warn!("Mismatched trailer for the primary slot");
+                fails += 1;
+            }
+
+            if confirm {
+                if !self.verify_images(&flash, 1, 1) ||
+                   !self.verify_trailers(&flash, 1, BOOT_MAGIC_GOOD,
+                                         BOOT_FLAG_SET, BOOT_FLAG_SET) {
+                    warn!("Confirmed image in the secondary slot was lost");
+                    fails += 1;
+                }
+            } else {
+                if self.verify_images(&flash, 1, 1) ||
+                   !self.verify_trailers(&flash, 1, BOOT_MAGIC_UNSET,
+                                         BOOT_FLAG_UNSET, BOOT_FLAG_UNSET) {
+                    warn!("Unconfirmed image in the secondary slot was not erased");
+                    fails += 1;
+                }
+            }
+        }
+
+        if fails > 0 {
+            error!("Error reverting a test image run in place");
+        }
+
+        fails > 0
+    }
+
     fn trailer_sz(&self, align: usize) -> usize {
         c::boot_trailer_sz(align as u32) as usize
     }
@@ -706,7 +1009,7 @@ impl Images {
     /// allowing for fails in the status area. This should run to the end
     /// and warn that write fails were detected...
     pub fn run_with_status_fails_complete(&self) -> bool {
-        if !Caps::ValidatePrimarySlot.present() {
+        if !Caps::ValidatePrimarySlot.present() || Caps::DirectXip.present() {
             return false;
         }
 
@@ -761,7 +1064,7 @@ impl Images {
     /// allowing for fails in the status area. This should run to the end
     /// and warn that write fails were detected...
     pub fn run_with_status_fails_with_reset(&self) -> bool {
-        if Caps::OverwriteUpgrade.present() {
+        if Caps::OverwriteUpgrade.present() || Caps::DirectXip.present() {
             false
         } else if Caps::ValidatePrimarySlot.present() {
 
@@ -1138,16 +1441,21 @@ fn install_image(flash: &mut SimMultiFlash, slot: &SlotInfo, len: usize,
         tlv.add_dependency(deps.other_id(), &dep);
     }
 
-    const HDR_SIZE: usize = 32;
+    // Images run in place are linked for the slot they are installed to.
+    let (load_addr, flags) = if Caps::DirectXip.present() {
+        (offset as u32, tlv.get_flags() | TlvFlags::ROM_FIXED as u32)
+    } else {
+        (0, tlv.get_flags())
+    };
 
     // Generate a boot header.  Note that the size doesn't include the header.
     let header = ImageHeader {
         magic: tlv.get_magic(),
-        load_addr: 0,
+        load_addr: load_addr,
         hdr_size: HDR_SIZE as u16,
         protect_tlv_size: tlv.protect_size(),
         img_size: len as u32,
-        flags: tlv.get_flags(),
+        flags: flags,
         ver: deps.my_version(offset, slot.index),
         _pad2: 0,
     };
@@ -1277,6 +1585,311 @@ fn install_image(flash: &mut SimMultiFlash, slot: &SlotInfo, len: usize,
     }
 }
 
+/// Install the upgrade of the given image into the given slot, stored as the
+/// given kind.  The manifest collects the entries the manifest image lists.
+/// Returns a copy of the image the upgrade installs in the primary slot.
+fn install_upgrade(flash: &mut SimMultiFlash, slot: &SlotInfo, base: &ImageData,
+                   len: usize, deps: &dyn Depender, kind: UpgradeKind,
+                   image_num: usize, manifest: &mut Vec<(TlvKinds, Vec<u8>)>) -> ImageData {
+    match kind {
+        UpgradeKind::Full => install_image(flash, slot, len, deps, false),
+        UpgradeKind::Delta => install_patch(flash, slot, base, len, deps),
+        UpgradeKind::Compressed => install_compressed(flash, slot, len, deps),
+        UpgradeKind::Manifest => install_listed(flash, slot, len, deps, image_num, manifest),
+    }
+}
+
+/// Build a signed image around the given payload: the header, with the given
+/// flags added, the payload itself and the TLVs, including the given
+/// protected ones.
+fn make_signed_image(slot: &SlotInfo, payload: &[u8], flags: u32,
+                     protected: &[(TlvKinds, Vec<u8>)],
+                     deps: &dyn Depender) -> Vec<u8> {
+    make_image_with(Box::new(make_tlv()), slot, payload, flags, protected, deps)
+}
+
+/// Build an image around the given payload, as make_signed_image does, with
+/// the TLVs made by the given generator.
+fn make_image_with(mut tlv: Box<dyn ManifestGen>, slot: &SlotInfo, payload: &[u8],
+                   flags: u32, protected: &[(TlvKinds, Vec<u8>)],
+                   deps: &dyn Depender) -> Vec<u8> {
+    for dep in deps.my_deps(slot.base_off, slot.index) {
+        tlv.add_dependency(deps.other_id(), &dep);
+    }
+    for (kind, data) in protected {
+        tlv.add_protected(*kind, data);
+    }
+
+    let header = ImageHeader {
+        magic: tlv.get_magic(),
+        load_addr: 0,
+        hdr_size: HDR_SIZE as u16,
+        protect_tlv_size: tlv.protect_size(),
+        img_size: payload.len() as u32,
+        flags: tlv.get_flags() | flags,
+        ver: deps.my_version(slot.base_off, slot.index),
+        _pad2: 0,
+    };
+
+    let mut buf = header.as_raw().to_vec();
+    buf.extend_from_slice(payload);
+    tlv.add_bytes(&buf);
+    buf.append(&mut tlv.make_tlv());
+    buf
+}
+
+/// Write an image to the given slot, padded to a multiple of the flash
+/// alignment.
+fn write_image(flash: &mut SimMultiFlash, slot: &SlotInfo, image: &[u8]) {
+    let dev = flash.get_mut(&slot.dev_id).unwrap();
+
+    let mut buf = image.to_vec();
+    while buf.len() % dev.align() != 0 {
+        buf.push(dev.erased_val());
+    }
+
+    dev.write(slot.base_off, &buf).unwrap();
+}
+
+/// A copy of the image as written to the given slot, padded to a multiple of
+/// the flash alignment.
+fn padded_image(flash: &SimMultiFlash, slot: &SlotInfo, image: Vec<u8>) -> ImageData {
+    let dev = flash.get(&slot.dev_id).unwrap();
+
+    let mut plain = image;
+    while plain.len() % dev.align() != 0 {
+        plain.push(dev.erased_val());
+    }
+
+    ImageData {
+        plain: plain,
+        cipher: None,
+    }
+}
+
+/// Bytes of the new image produced by a patch: either copied from the image
+/// in the primary slot, or given.
+enum PatchCmd {
+    Copy { src_off: usize, len: usize },
+    Literal(Vec<u8>),
+}
+
+/// Set in the first word of a command for the bytes to follow it.
+const DELTA_LITERAL: u32 = 0x80000000;
+
+/// Install into the given slot a patch against the image in the primary slot
+/// (delta-upgrade).  The new image keeps most of the current payload, but
+/// drops a few blocks of it, so that the rest is copied from further along,
+/// and replaces a few others.  Returns a copy of the image the patch
+/// produces in the primary slot.
+fn install_patch(flash: &mut SimMultiFlash, slot: &SlotInfo, base: &ImageData,
+                 len: usize, deps: &dyn Depender) -> ImageData {
+    const BLOCK: usize = 1024;
+
+    let base = &base.plain;
+    let hdr_size = u16::from_le_bytes([base[8], base[9]]) as usize;
+    let protect_size = u16::from_le_bytes([base[10], base[11]]) as usize;
+    let img_size = u32::from_le_bytes([base[12], base[13], base[14], base[15]]) as usize;
+    let base_payload = &base[hdr_size .. hdr_size + img_size];
+
+    // The patch only applies to the image it was made against.
+    let base_hash = digest::digest(&digest::SHA256,
+                                   &base[.. hdr_size + img_size + protect_size]);
+
+    let mut cmds: Vec<PatchCmd> = vec![];
+    let mut payload: Vec<u8> = vec![];
+    for (i, block) in base_payload.chunks(BLOCK).enumerate() {
+        match i % 7 {
+            3 => (),
+            5 => {
+                let mut data = vec![0; block.len()];
+                splat(&mut data, slot.base_off + i);
+                payload.extend_from_slice(&data);
+                cmds.push(PatchCmd::Literal(data));
+            },
+            _ => {
+                payload.extend_from_slice(block);
+                cmds.push(PatchCmd::Copy { src_off: hdr_size + i * BLOCK,
+                                           len: block.len() });
+            },
+        }
+    }
+    if payload.len() < len {
+        let mut data = vec![0; len - payload.len()];
+        splat(&mut data, slot.base_off);
+        payload.extend_from_slice(&data);
+        cmds.push(PatchCmd::Literal(data));
+    }
+
+    // The header and the TLVs of the new image differ from the current ones.
+    let image = make_signed_image(slot, &payload, 0, &[], deps);
+    cmds.insert(0, PatchCmd::Literal(image[.. HDR_SIZE].to_vec()));
+    cmds.push(PatchCmd::Literal(image[HDR_SIZE + payload.len() ..].to_vec()));
+
+    let mut b_patch: Vec<u8> = vec![];
+    for cmd in &cmds {
+        match cmd {
+            PatchCmd::Copy { src_off, len } => {
+                b_patch.write_u32::<LittleEndian>(*len as u32).unwrap();
+                b_patch.write_u32::<LittleEndian>(*src_off as u32).unwrap();
+            },
+            PatchCmd::Literal(data) => {
+                b_patch.write_u32::<LittleEndian>(DELTA_LITERAL | data.len() as u32).unwrap();
+                b_patch.extend_from_slice(data);
+            },
+        }
+    }
+
+    let patch = make_signed_image(slot, &b_patch, TlvFlags::DELTA as u32,
+                                  &[(TlvKinds::DELTABASE, base_hash.as_ref().to_vec())],
+                                  deps);
+    write_image(flash, slot, &patch);
+
+    // The patched image is padded with erased bytes when written.
+    padded_image(flash, slot, image)
+}
+
+/// Install into the given slot a compressed image (compressed-images).  Every
+/// other block of the payload repeats the one before it, so that the
+/// compressor finds matches.  Returns a copy of the image decompressed into
+/// the primary slot.
+fn install_compressed(flash: &mut SimMultiFlash, slot: &SlotInfo, len: usize,
+                      deps: &dyn Depender) -> ImageData {
+    const BLOCK: usize = 512;
+
+    let mut payload = vec![0; len];
+    splat(&mut payload, slot.base_off);
+    for i in 0 .. len {
+        if (i / BLOCK) % 2 == 1 {
+            payload[i] = payload[i - BLOCK];
+        }
+    }
+
+    let image = make_signed_image(slot, &payload, 0, &[], deps);
+    let image_hash = digest::digest(&digest::SHA256, &image);
+
+    let mut image_size: Vec<u8> = vec![];
+    image_size.write_u32::<LittleEndian>(image.len() as u32).unwrap();
+
+    let compressed = make_signed_image(slot, &lz4_compress(&image),
+                                       TlvFlags::COMPRESSED as u32,
+                                       &[(TlvKinds::DECOMPSIZE, image_size),
+                                         (TlvKinds::DECOMPSHA256, image_hash.as_ref().to_vec())],
+                                       deps);
+    write_image(flash, slot, &compressed);
+
+    // The decompressed image is padded with erased bytes when written.
+    padded_image(flash, slot, image)
+}
+
+/// The shortest match a sequence of an LZ4 block encodes.
+const LZ4_MIN_MATCH: usize = 4;
+
+/// How far back a match may reach, as bounded by the window of the
+/// bootloader's decompressor.
+const LZ4_WINDOW_SZ: usize = 4096;
+
+/// Compress the data into a single LZ4 block, greedily taking the match the
+/// last occurrence of the next four bytes gives.  The last sequence only
+/// holds literals.
+fn lz4_compress(data: &[u8]) -> Vec<u8> {
+    const HASH_BITS: u32 = 12;
+
+    // One more than the offset of the last four bytes with a given hash.
+    let mut last = vec![0usize; 1 << HASH_BITS];
+    let mut out: Vec<u8> = vec![];
+    let mut lit_start = 0;
+    let mut pos = 0;
+
+    while pos + LZ4_MIN_MATCH <= data.len() {
+        let key = u32::from_le_bytes([data[pos], data[pos + 1],
+                                      data[pos + 2], data[pos + 3]]);
+        let hash = (key.wrapping_mul(2654435761) >> (32 - HASH_BITS)) as usize;
+        let cand = last[hash];
+        last[hash] = pos + 1;
+
+        if cand > 0 && pos - (cand - 1) <= LZ4_WINDOW_SZ &&
+            data[cand - 1 .. cand - 1 + LZ4_MIN_MATCH] == data[pos .. pos + LZ4_MIN_MATCH] {
+            let src = cand - 1;
+            let mut len = LZ4_MIN_MATCH;
+            while pos + len < data.len() && data[src + len] == data[pos + len] {
+                len += 1;
+            }
+            lz4_sequence(&mut out, &data[lit_start .. pos], Some((pos - src, len)));
+            pos += len;
+            lit_start = pos;
+        } else {
+            pos += 1;
+        }
+    }
+    lz4_sequence(&mut out, &data[lit_start ..], None);
+
+    out
+}
+
+/// Append a sequence to an LZ4 block: the literals, then the match, given as
+/// its distance and length, if any.
+fn lz4_sequence(out: &mut Vec<u8>, literals: &[u8], matched: Option<(usize, usize)>) {
+    let lit_len = literals.len();
+    let match_len = matched.map_or(0, |(_, len)| len - LZ4_MIN_MATCH);
+
+    out.push(((lit_len.min(15) << 4) | match_len.min(15)) as u8);
+    if lit_len >= 15 {
+        lz4_length(out, lit_len - 15);
+    }
+    out.extend_from_slice(literals);
+
+    if let Some((dist, _)) = matched {
+        out.write_u16::<LittleEndian>(dist as u16).unwrap();
+        if match_len >= 15 {
+            lz4_length(out, match_len - 15);
+        }
+    }
+}
+
+/// Append the rest of a length whose nibble in the token is saturated.
+fn lz4_length(out: &mut Vec<u8>, mut len: usize) {
+    while len >= 255 {
+        out.push(255);
+        len -= 255;
+    }
+    out.push(len as u8);
+}
+
+/// The image whose protected TLVs list the others, with image-manifest.
+const MANIFEST_IMAGE: usize = 0;
+
+/// Install the upgrade of an image of a set (image-manifest).  The images
+/// other than the manifest image only carry their hash, which they add to
+/// the manifest, and must be installed before the manifest image, which is
+/// signed and lists them.  Returns a copy of the image.
+fn install_listed(flash: &mut SimMultiFlash, slot: &SlotInfo, len: usize,
+                  deps: &dyn Depender, image_num: usize,
+                  manifest: &mut Vec<(TlvKinds, Vec<u8>)>) -> ImageData {
+    let mut payload = vec![0; len];
+    splat(&mut payload, slot.base_off);
+
+    let image = if image_num == MANIFEST_IMAGE {
+        make_signed_image(slot, &payload, 0, &manifest[..], deps)
+    } else {
+        let image = make_image_with(Box::new(TlvGen::new_hash_only()), slot, &payload,
+                                    0, &[], deps);
+
+        // The entry holds the hash of the SHA256 TLV: that of the header, the
+        // payload and the protected TLVs.
+        let protect_size = u16::from_le_bytes([image[10], image[11]]) as usize;
+        let hash = digest::digest(&digest::SHA256, &image[.. HDR_SIZE + len + protect_size]);
+
+        let mut entry: Vec<u8> = vec![image_num as u8, 0, 0, 0];
+        entry.extend_from_slice(hash.as_ref());
+        manifest.push((TlvKinds::MANIFEST, entry));
+        image
+    };
+    write_image(flash, slot, &image);
+
+    padded_image(flash, slot, image)
+}
+
 /// Install no image.  This is used when no upgrade happens.
 fn install_no_image() -> ImageData {
     ImageData {
@@ -1575,6 +2188,9 @@ fn splat(data: &mut [u8], seed: usize) {
     rng.fill_bytes(data);
 }
 
+/// The size of the image header written by the simulator.
+const HDR_SIZE: usize = 32;
+
 /// Return a read-only view into the raw bytes of this object
 trait AsRaw : Sized {
     fn as_raw<'a>(&'a self) -> &'a [u8] {
@@ -29,6 +29,7 @@ pub use crate::{
     image::{
         ImagesBuilder,
         Images,
+        UpgradeKind,
         show_sizes,
     },
 };
@@ -46,7 +47,7 @@ Options:
   -h, --help         Show this message
   --version          Version
   --device TYPE      MCU to simulate
-                     Valid values: stm32f4, k64f
+                     Valid values: stm32f4, stm32f4mixed, k64f
   --align SIZE       Flash write alignment
 ";
 
@@ -62,10 +63,11 @@ struct Args {
 }
 
 #[derive(Copy, Clone, Debug, Deserialize)]
-pub enum DeviceName { Stm32f4, K64f, K64fBig, K64fMulti, Nrf52840, Nrf52840SpiFlash, }
+pub enum DeviceName { Stm32f4, Stm32f4Mixed, K64f, K64fBig, K64fMulti, Nrf52840, Nrf52840SpiFlash, }
 
 pub static ALL_DEVICES: &'static [DeviceName] = &[
     DeviceName::Stm32f4,
+    DeviceName::Stm32f4Mixed,
     DeviceName::K64f,
     DeviceName::K64fBig,
     DeviceName::K64fMulti,
@@ -77,6 +79,7 @@ impl fmt::Display for DeviceName {
     fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
         let name = match *self {
             DeviceName::Stm32f4 => "stm32f4",
+            DeviceName::Stm32f4Mixed => "stm32f4mixed",
             DeviceName::K64f => "k64f",
             DeviceName::K64fBig => "k64fbig",
             DeviceName::K64fMulti => "k64fmulti",
@@ -195,9 +198,12 @@ impl RunStatus {
         let bad_secondary_slot_image = run.clone().make_bad_secondary_slot_image();
 
         failed |= bad_secondary_slot_image.run_signfail_upgrade();
+        failed |= bad_secondary_slot_image.run_direct_xip_fallback();
 
         let images = run.clone().make_no_upgrade_image(&NO_DEPS);
         failed |= images.run_norevert_newimage();
+        failed |= images.run_direct_xip_select();
+        failed |= images.run_direct_xip_revert();
 
         let images = run.make_image(&NO_DEPS, true);
 
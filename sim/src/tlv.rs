@@ -55,6 +55,10 @@ pub enum TlvKinds {
     ENCEC256 = 0x32,
     ENCX25519 = 0x33,
     DEPENDENCY = 0x40,
+    DELTABASE = 0x70,
+    DECOMPSIZE = 0x71,
+    DECOMPSHA256 = 0x72,
+    MANIFEST = 0x73,
 }
 
 #[allow(dead_code, non_camel_case_types)]
@@ -63,6 +67,9 @@ pub enum TlvFlags {
     NON_BOOTABLE = 0x02,
     ENCRYPTED = 0x04,
     RAM_LOAD = 0x20,
+    DELTA = 0x40,
+    COMPRESSED = 0x80,
+    ROM_FIXED = 0x100,
 }
 
 /// A generator for manifests.  The format of the manifest can be either a
@@ -82,6 +89,9 @@ pub trait ManifestGen {
     /// Add a dependency on another image.
     fn add_dependency(&mut self, id: u8, version: &ImageVersion);
 
+    /// Add a protected TLV of the given kind.
+    fn add_protected(&mut self, kind: TlvKinds, data: &[u8]);
+
     /// Add a sequence of bytes to the payload that the manifest is
     /// protecting.
     fn add_bytes(&mut self, bytes: &[u8]);
@@ -106,6 +116,7 @@ pub struct TlvGen {
     kinds: Vec<TlvKinds>,
     payload: Vec<u8>,
     dependencies: Vec<Dependency>,
+    protected: Vec<(TlvKinds, Vec<u8>)>,
     enc_key: Vec<u8>,
     /// Should this signature be corrupted.
     gen_corrupted: bool,
@@ -259,11 +270,15 @@ impl ManifestGen for TlvGen {
     }
 
     fn protect_size(&self) -> u16 {
-        if self.dependencies.is_empty() {
+        if self.dependencies.is_empty() && self.protected.is_empty() {
             0
         } else {
-            // Include the header and space for each dependency.
-            4 + (self.dependencies.len() as u16) * (4 + 4 + 8)
+            // Include the header and space for each dependency and each
+            // other protected TLV.
+            4 + (self.dependencies.len() as u16) * (4 + 4 + 8) +
+                self.protected.iter()
+                    .map(|(_, data)| 4 + data.len() as u16)
+                    .sum::<u16>()
         }
     }
 
@@ -274,6 +289,10 @@ impl ManifestGen for TlvGen {
         });
     }
 
+    fn add_protected(&mut self, kind: TlvKinds, data: &[u8]) {
+        self.protected.push((kind, data.to_vec()));
+    }
+
     fn corrupt_sig(&mut self) {
         self.gen_corrupted = true;
     }
@@ -302,6 +321,12 @@ impl ManifestGen for TlvGen {
                 protected_tlv.write_u32::<LittleEndian>(dep.version.build_num).unwrap();
             }
 
+            for (kind, data) in &self.protected {
+                protected_tlv.write_u16::<LittleEndian>(*kind as u16).unwrap();
+                protected_tlv.write_u16::<LittleEndian>(data.len() as u16).unwrap();
+                protected_tlv.extend_from_slice(data);
+            }
+
             assert_eq!(size, protected_tlv.len() as u16, "protected TLV length incorrect");
         }
 
@@ -11,6 +11,7 @@ use bootsim::{
     DepTest, DepType, UpgradeInfo,
     ImagesBuilder,
     Images,
+    UpgradeKind,
     NO_DEPS,
     REV_DEPS,
     testlog,
@@ -46,6 +47,19 @@ macro_rules! sim_test {
     };
 }
 
+/// A test of an upgrade stored as the given kind, only run when the
+/// bootloader was built with support for it.
+macro_rules! packed_test {
+    ($name:ident, $kind:expr, $test:ident($($targs:expr),*)) => {
+        test_shell!($name, r, {
+            if let Some(image) = r.make_packed_image($kind) {
+                dump_image(&image, stringify!($name));
+                assert!(!image.$test($($targs),*));
+            }
+        });
+    };
+}
+
 sim_test!(bad_secondary_slot, make_bad_secondary_slot_image(), run_signfail_upgrade());
 sim_test!(norevert_newimage, make_no_upgrade_image(&NO_DEPS), run_norevert_newimage());
 sim_test!(basic_revert, make_image(&NO_DEPS, true), run_basic_revert());
@@ -56,6 +70,15 @@ sim_test!(norevert, make_image(&NO_DEPS, true), run_norevert());
 sim_test!(status_write_fails_complete, make_image(&NO_DEPS, true), run_with_status_fails_complete());
 sim_test!(status_write_fails_with_reset, make_image(&NO_DEPS, true), run_with_status_fails_with_reset());
 sim_test!(downgrade_prevention, make_image(&REV_DEPS, true), run_nodowngrade());
+packed_test!(delta_perm_with_fails, UpgradeKind::Delta, run_perm_with_fails());
+packed_test!(delta_perm_with_random_fails, UpgradeKind::Delta, run_perm_with_random_fails(5));
+packed_test!(compressed_perm_with_fails, UpgradeKind::Compressed, run_perm_with_fails());
+packed_test!(compressed_perm_with_random_fails, UpgradeKind::Compressed, run_perm_with_random_fails(5));
+packed_test!(manifest_perm_with_fails, UpgradeKind::Manifest, run_perm_with_fails());
+packed_test!(manifest_perm_with_random_fails, UpgradeKind::Manifest, run_perm_with_random_fails(5));
+sim_test!(direct_xip_select, make_no_upgrade_image(&NO_DEPS), run_direct_xip_select());
+sim_test!(direct_xip_fallback, make_bad_secondary_slot_image(), run_direct_xip_fallback());
+sim_test!(direct_xip_revert, make_no_upgrade_image(&NO_DEPS), run_direct_xip_revert());
 
 // Test various combinations of incorrect dependencies.
 test_shell!(dependency_combos, r, {